@@ -31,7 +31,7 @@
 
 #include "CEGUI/String.h"
 #include "CEGUI/KeyFrame.h"
-#include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -257,11 +257,29 @@ private:
     //! curently used interpolator (has to be set for the Affector to work!)
     Interpolator* d_interpolator;
 
-    typedef std::map<float, KeyFrame*, std::less<float> > KeyFrameMap;
-    /** keyframes of this affector (if there are no keyframes, this affector
-     * won't do anything!)
+    typedef std::vector<KeyFrame*> KeyFrameList;
+    /** keyframes of this affector sorted by their position (if there are no
+     * keyframes, this affector won't do anything!)
      */
-    KeyFrameMap d_keyFrames;
+    KeyFrameList d_keyFrames;
+
+    //! returns the first keyframe at or after given position
+    KeyFrameList::iterator findKeyFrame(float position);
+    //! returns the first keyframe at or after given position
+    KeyFrameList::const_iterator findKeyFrame(float position) const;
+
+    /*!
+    \brief
+        Returns index of the last keyframe at or before given position
+
+    \param hint
+        Index returned by a previous call, when animations advance forward the
+        result is usually the same or the next index and no search is needed.
+
+    \return
+        The index or getNumKeyFrames() if all keyframes are after \a position
+    */
+    size_t findLeftKeyFrameIdx(float position, size_t hint) const;
 };
 
 } // End of  CEGUI namespace section
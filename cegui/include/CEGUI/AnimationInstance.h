@@ -31,6 +31,7 @@
 
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/Event.h"
+#include "CEGUI/Interpolator.h"
 #include <map>
 #include <vector>
 
@@ -359,6 +360,33 @@ public:
      */
     const String& getSavedPropertyValue(const String& propertyName);
 
+    /*!
+    \brief
+        Internal method, retrieves the native applier for given Affector
+
+        The applier is created on first use and cached for as long as the
+        target, the interpolator and the target property of \a affector, and
+        the Property instance the target holds under that name, stay the same.
+
+    \return
+        Pointer to the applier owned by this instance, or 0 if the values of
+        \a affector have to be applied using the String based interpolation.
+    */
+    Interpolator::NativeApplier* getNativeApplier(const Affector* affector);
+
+    //! destroys all cached native appliers
+    void purgeNativeAppliers(void);
+
+    /*!
+    \brief
+        Internal method, retrieves index of the keyframe segment last used
+        by given Affector for this instance
+
+        Affector uses this to avoid searching for neighbouring keyframes of
+        the current position on every step.
+    */
+    size_t& getKeyFrameCursor(const Affector* affector);
+
     /*!
     \brief
         Internal method, adds reference to created auto connection
@@ -440,6 +468,27 @@ private:
      */
     PropertyValueMap d_savedPropertyValues;
 
+    //! native applier cached for one Affector
+    struct NativeApplierEntry
+    {
+        //! interpolator the applier was created by
+        Interpolator* d_interpolator;
+        //! name of the property the applier was created for
+        String d_propertyName;
+        //! the property the applier sets, 0 if the target has none
+        Property* d_property;
+        //! the applier, 0 if the property can't be set natively
+        Interpolator::NativeApplier* d_applier;
+    };
+
+    typedef std::map<const Affector*, NativeApplierEntry> NativeApplierMap;
+    //! native appliers used to apply values of Affectors to the target
+    NativeApplierMap d_nativeAppliers;
+
+    typedef std::map<const Affector*, size_t> KeyFrameCursorMap;
+    //! keyframe segments last used by Affectors of this instance
+    KeyFrameCursorMap d_keyFrameCursors;
+
     typedef std::vector<Event::Connection> ConnectionTracker;
     //! tracks auto event connections we make.
     ConnectionTracker d_autoConnections;
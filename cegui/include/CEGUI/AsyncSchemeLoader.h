@@ -0,0 +1,255 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIAsyncSchemeLoader_h_
+#define _CEGUIAsyncSchemeLoader_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Loads schemes in the background, using a pool of worker threads to read
+    and prepare the files each scheme refers to.
+
+    For every requested scheme the workers read the scheme file, its
+    imagesets, fonts and looknfeels, convert the XML to the XMLCompiler form,
+    decode the imageset images through the ImageCodec and read FreeType font
+    files.  Everything that touches the Renderer or the managers - texture
+    creation and upload, font face creation, and the creation and
+    registration of the scheme and its resources - is done on the GUI thread
+    from update(), which should be called once per frame while requests are
+    outstanding.  During that step the usual loading code picks up the
+    prepared data (see takePreloadedXML, takePreloadedFile and
+    createPreloadedTexture) instead of reading and parsing files itself.
+
+    Preparation is purely an optimisation: when a file cannot be prepared
+    in the background, it is loaded on the GUI thread as normal and any
+    error is reported from there, so the result of an asynchronous load is
+    the same as that of SchemeManager::createFromFile.
+
+    Only one AsyncSchemeLoader may exist at a time.  The XMLParser module is
+    called from the worker threads, so it must be safe to use concurrently;
+    the stock XML parsers are.  The ResourceProvider is only called from the
+    workers when ResourceProvider::isThreadSafe returns true (as it does for
+    the DefaultResourceProvider and MappedFileResourceProvider); otherwise
+    update() loads the files on the GUI thread and hands copies of them to
+    the workers, and font files are not preloaded.  Images are
+    only decoded on the workers when ImageCodec::isThreadSafe returns true
+    for the current codec (as it does for the STB, TGA and PVR codecs);
+    otherwise they are decoded on the GUI thread as usual.
+
+    Errors met on the worker threads, including the messages logged when
+    exceptions are constructed, are logged from those threads.  The
+    DefaultLogger may be used from several threads at once; a custom Logger
+    must also be, or the AsyncSchemeLoader must not be used with it.
+*/
+class CEGUIEXPORT AsyncSchemeLoader : public Singleton<AsyncSchemeLoader>
+{
+public:
+    /*!
+    \brief
+        Handle to one scheme load started by AsyncSchemeLoader::loadScheme.
+        The state is updated by AsyncSchemeLoader::update.
+    */
+    class CEGUIEXPORT Request
+    {
+    public:
+        //! Return the name of the scheme file being loaded.
+        const String& getFilename() const { return d_filename; }
+
+        //! Return whether the load has finished, successfully or not.
+        bool isComplete() const { return d_complete; }
+
+        //! Return whether the load finished with an error.
+        bool hasFailed() const { return d_failed; }
+
+        //! Return the message of the error the load failed with.
+        const String& getErrorMessage() const { return d_errorMessage; }
+
+        //! Return the loaded Scheme, or 0 if the load is not complete or failed.
+        Scheme* getScheme() const { return d_scheme; }
+
+        /*!
+        \brief
+            Return the fraction, between 0 and 1, of the files referenced so
+            far by this scheme that have been prepared.
+        */
+        float getProgress() const { return d_progress; }
+
+    private:
+        friend class AsyncSchemeLoader;
+
+        Request(const String& filename, const String& resourceGroup);
+
+        String d_filename;
+        String d_resourceGroup;
+        Scheme* d_scheme;
+        bool d_complete;
+        bool d_failed;
+        String d_errorMessage;
+        float d_progress;
+    };
+
+    /*!
+    \brief
+        Create the loader and start its worker threads.
+
+    \param workerCount
+        Number of worker threads to start.  0 starts one per hardware thread.
+    */
+    explicit AsyncSchemeLoader(uint workerCount = 0);
+
+    /*!
+    \brief
+        Stop the worker threads and release all prepared data.  Requests
+        that have not completed are abandoned.
+    */
+    ~AsyncSchemeLoader();
+
+    /*!
+    \brief
+        Start loading a scheme in the background.
+
+    \param filename
+        Name of the scheme file, as for SchemeManager::createFromFile.
+
+    \param resourceGroup
+        Resource group of the scheme file.  The default group for schemes
+        is used if this is empty.
+
+    \return
+        Handle describing the state of the load.  It remains valid for the
+        lifetime of the AsyncSchemeLoader.
+    */
+    const Request& loadScheme(const String& filename,
+                              const String& resourceGroup = "");
+
+    /*!
+    \brief
+        Load the files the workers may not load themselves, and create the
+        schemes whose files have all been prepared.  This must be called from
+        the thread that runs the GUI.
+
+    \return
+        true if no requests remain outstanding.
+    */
+    bool update();
+
+    //! Return whether no requests are outstanding.
+    bool isIdle() const;
+
+    //! Return the number of worker threads in use.
+    uint getWorkerCount() const;
+
+    /*!
+    \brief
+        Set whether images are decoded on the worker threads.  Even when
+        enabled, which is the default, this is only done if the current
+        ImageCodec reports that it is thread safe.
+    */
+    void setDecodeImagesOnWorkers(bool setting);
+
+    /*!
+    \brief
+        Return whether images are decoded on the worker threads, which
+        requires both the setting and a thread safe ImageCodec.
+    */
+    bool isDecodingImagesOnWorkers() const;
+
+    /*!
+    \brief
+        Hand over the compiled form of an XML file prepared in the
+        background, if there is one.  Used by XMLParser::parseXMLFile.
+
+    \param filename
+        Name of the XML file.
+
+    \param resourceGroup
+        Resource group the file would be loaded from, with defaults already
+        applied.
+
+    \param output
+        RawDataContainer that receives the compiled data on success.  It
+        owns the data, which must be released with RawDataContainer::release
+        rather than through the ResourceProvider.
+
+    \return
+        true if prepared data was found and moved to \a output.
+    */
+    bool takePreloadedXML(const String& filename, const String& resourceGroup,
+                          RawDataContainer& output);
+
+    /*!
+    \brief
+        Hand over the content of a file read in the background, if there is
+        one.  The data was loaded through the ResourceProvider and must be
+        passed to ResourceProvider::unloadRawDataContainer when finished
+        with, exactly as if it had been loaded directly.
+    */
+    bool takePreloadedFile(const String& filename, const String& resourceGroup,
+                           RawDataContainer& output);
+
+    /*!
+    \brief
+        Create a texture named \a name from an image file decoded in the
+        background, if there is one.
+
+    \return
+        The new texture, or 0 if \a filename was not decoded in the
+        background; the caller should then create the texture from the
+        file as usual.
+    */
+    Texture* createPreloadedTexture(const String& name, const String& filename,
+                                    const String& resourceGroup);
+
+private:
+    AsyncSchemeLoader(const AsyncSchemeLoader&);
+    AsyncSchemeLoader& operator=(const AsyncSchemeLoader&);
+
+    struct Impl;
+    Impl* d_pimpl;
+
+    //! Handles for all requests made, in request order.
+    std::vector<Request*> d_requests;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIAsyncSchemeLoader_h_
@@ -34,6 +34,7 @@
 #include "CEGUI/Animation.h"
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
+#include "CEGUI/AsyncSchemeLoader.h"
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/BasicRenderedStringParser.h"
 #include "CEGUI/BidiVisualMapping.h"
@@ -47,6 +48,7 @@
 #include "CEGUI/DefaultLogger.h"
 #include "CEGUI/DefaultRenderedStringParser.h"
 #include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/MappedFileResourceProvider.h"
 #include "CEGUI/DynamicModule.h"
 #include "CEGUI/Element.h"
 #include "CEGUI/Event.h"
@@ -69,6 +71,7 @@
 #include "CEGUI/InputEvents.h"
 #include "CEGUI/InputEventReceiver.h"
 #include "CEGUI/InputAggregator.h"
+#include "CEGUI/InputEventQueue.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/JustifiedRenderedString.h"
 #include "CEGUI/KeyFrame.h"
@@ -126,6 +129,7 @@
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/XMLHandler.h"
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLCompiler.h"
 #include "CEGUI/XMLSerializer.h"
 
 // Model-view
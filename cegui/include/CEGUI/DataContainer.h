@@ -51,7 +51,8 @@ public:
 	*/
     RawDataContainer()
       : mData(0),
-        mSize(0)
+        mSize(0),
+        mOwnsData(true)
     {
     }
 
@@ -69,12 +70,30 @@ public:
 	*************************************************************************/
 	/*!
 	\brief
-		Set a pointer to the external data.
+		Set a pointer to the external data.  The container takes ownership of
+		the buffer, which must have been allocated with new[].
 
 	\param data
         Pointer to the uint8 data buffer.
 	*/
-    void setData(uint8* data) { mData = data; }
+    void setData(uint8* data) { mData = data; mOwnsData = true; }
+
+	/*!
+	\brief
+		Set a pointer to data that is owned elsewhere, such as a read-only
+		view of a memory mapped file.  The container never frees it; the
+		ResourceProvider that supplied it does so in unloadRawDataContainer.
+
+	\param data
+        Pointer to the uint8 data buffer.  The data must not be modified.
+	*/
+    void setExternalData(uint8* data) { mData = data; mOwnsData = false; }
+
+	/*!
+	\brief
+		Return whether the container owns its data and frees it on release.
+	*/
+    bool ownsData(void) const { return mOwnsData; }
 
 	/*!
 	\brief
@@ -106,7 +125,8 @@ public:
 
 	/*!
 	\brief
-		Release supplied data.
+		Release supplied data.  Data set with setExternalData is only
+		forgotten, not freed.
 	*/
     void release(void);
 
@@ -116,6 +136,7 @@ private:
 	*************************************************************************/
     uint8* mData;
     size_t mSize;
+    bool mOwnsData;
 };
 
 } // End of  CEGUI namespace section
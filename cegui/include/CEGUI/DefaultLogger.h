@@ -30,6 +30,8 @@
 #define _CEGUIDefaultLogger_h_
 
 #include "CEGUI/Logger.h"
+#include "CEGUI/Threading.h"
+#include <deque>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -45,10 +47,18 @@ namespace CEGUI
     If you want to redirect CEGUI logs to some place other than a text file,
     implement your own Logger implementation and create a object of the
     Logger type before creating the CEGUI::System singleton.
+
+    Messages may be logged from any thread.  By default each message is
+    written and flushed to the log file before logEvent returns; with
+    setAsynchronousWriting, formatted messages are instead queued for a
+    background thread that writes them in batches.
 */
 class CEGUIEXPORT DefaultLogger : public Logger
 {
 public:
+    //! Maximum number of messages queued for the writer thread.
+    static const size_t AsynchronousQueueCapacity;
+
     DefaultLogger(void);
     ~DefaultLogger(void);
 
@@ -56,19 +66,60 @@ public:
     void logEvent(const String& message, LoggingLevel level = Standard);
     void setLogFilename(const String& filename, bool append = false);
 
+    /*!
+    \brief
+        Set whether messages are written to the log file by a background
+        thread.  logEvent then only formats the message and adds it to a
+        bounded queue, waiting only if the queue is full.  Disabling this
+        waits until all queued messages have been written.
+
+        This has no effect on Android, where messages go to the system log.
+    */
+    void setAsynchronousWriting(bool setting);
+
+    //! Return whether messages are written to the log file by a background thread.
+    bool isWritingAsynchronously() const;
+
+    //! Wait until all messages logged so far have been written to the log file.
+    void flush();
+
 #ifndef __ANDROID__
 protected:
+    //! Write formatted log entries to d_ostream and flush it.
+    void writeEntries(const std::vector<std::string>& entries);
+    //! Start the writer thread.
+    void startWriterThread();
+    //! Write out all queued entries and stop the writer thread.
+    void stopWriterThread();
+    //! Body of the writer thread.
+    static void writerThreadMain(void* logger);
+
     //! Stream used to implement the logger
     std::ofstream d_ostream;
-    //! Used to build log entry strings. 
-    std::ostringstream d_workstream;
 
-    typedef std::pair<String, LoggingLevel> CacheItem;
+    typedef std::pair<std::string, LoggingLevel> CacheItem;
     typedef std::vector<CacheItem> Cache;
     //! Used to cache log entries before log file is created. 
     Cache d_cache;
     //! true while log entries are beign cached (prior to logfile creation)
     bool d_caching;
+
+    //! Protects d_cache, d_caching and the writer thread state below.
+    mutable Mutex d_mutex;
+    //! Serialises access to d_ostream.
+    Mutex d_streamMutex;
+    //! Signalled when entries are queued or the writer thread should stop.
+    Condition d_entriesQueued;
+    //! Signalled when the writer thread has taken entries from the queue.
+    Condition d_entriesTaken;
+    //! Formatted entries waiting for the writer thread.
+    std::deque<std::string> d_queue;
+    //! Number of queued entries taken but not yet written by the writer thread.
+    size_t d_entriesInProgress;
+    //! Writer thread, or 0 when writing synchronously.
+    Thread* d_writerThread;
+    //! true when the writer thread should write out the queue and exit.
+    bool d_stopWriter;
 #endif
 };
 
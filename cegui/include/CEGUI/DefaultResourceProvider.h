@@ -100,6 +100,12 @@ public:
 
     void loadRawDataContainer(const String& filename, RawDataContainer& output, const String& resourceGroup);
     void unloadRawDataContainer(RawDataContainer& data);
+    /*!
+    \brief
+        Return true, since files are only read while loading.  Subclasses
+        that load files in some other way must override this as well.
+    */
+    bool isThreadSafe() const;
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group);
@@ -437,6 +437,8 @@ protected:
     EventMap    d_events;
 
     bool d_muted;    //!< true if events for this EventSet have been muted.
+    //! changes whenever Event objects are added to or removed from d_events.
+    unsigned int d_eventsVersion;
 
 public:
     /*************************************************************************
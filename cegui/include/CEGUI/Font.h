@@ -94,7 +94,7 @@ public:
         false if it does not contain a mapping for \a cp.
     */
     bool isCodepointAvailable(utf32 cp) const
-    { return (d_cp_map.find(cp) != d_cp_map.end()); }
+    { return findIndexedGlyph(cp) != 0; }
 
     /*!
     \brief
@@ -190,6 +190,14 @@ public:
     */
     virtual void notifyDisplaySizeChanged(const Sizef& size);
 
+    /*!
+    \brief
+        Notify the Font that a new frame is about to be rendered.  Fonts that
+        cache glyph imagery use this to release it at a point where doing so
+        does not affect a frame that is partly drawn.
+    */
+    virtual void notifyFrameStarted();
+
     /*!
     \brief
         Return the pixel line spacing value for.
@@ -266,7 +274,21 @@ public:
 
     \see getTextAdvance
     */
-    float getTextExtent(const String& text, float x_scale = 1.0f) const;
+    float getTextExtent(const String& text, float x_scale = 1.0f) const
+    { return getTextExtent(text, 0, text.length(), x_scale); }
+
+    /*!
+    \brief
+        Return the pixel width of \a length characters of \a text, starting
+        at character index \a start_char, if rendered with this Font.
+
+        This allows measuring part of a larger String without having to
+        create a sub-string.
+
+    \see getTextExtent
+    */
+    float getTextExtent(const String& text, size_t start_char, size_t length,
+                        float x_scale = 1.0f) const;
 
     /*!
     \brief
@@ -296,7 +318,18 @@ public:
 
     \see getTextExtent
     */
-    float getTextAdvance(const String& text, float x_scale = 1.0f) const;
+    float getTextAdvance(const String& text, float x_scale = 1.0f) const
+    { return getTextAdvance(text, 0, text.length(), x_scale); }
+
+    /*!
+    \brief
+        Return the pixel advance of \a length characters of \a text, starting
+        at character index \a start_char, when rendered with this Font.
+
+    \see getTextAdvance
+    */
+    float getTextAdvance(const String& text, size_t start_char, size_t length,
+                         float x_scale = 1.0f) const;
 
     /*!
     \brief
@@ -450,6 +483,28 @@ protected:
     //! finds FontGlyph in map and returns it, or 0 if none.
     virtual const FontGlyph* findFontGlyph(const utf32 codepoint) const;
 
+    /*!
+    \brief
+        Add \a glyph as the glyph for \a codepoint, replacing any existing
+        glyph for it.  Glyphs must always be added this way rather than by
+        modifying d_cp_map directly, so that the glyph index is kept in step.
+
+    \return
+        Reference to the stored glyph.
+    */
+    FontGlyph& addFontGlyph(const utf32 codepoint, const FontGlyph& glyph);
+
+    //! Remove all glyphs from the font.
+    void clearFontGlyphs();
+
+    //! Return the glyph for \a codepoint via the glyph index, or 0 if none.
+    FontGlyph* findIndexedGlyph(const utf32 codepoint) const
+    {
+        const size_t page = codepoint / GlyphIndexPageSize;
+        return (page < d_glyphIndex.size() && d_glyphIndex[page]) ?
+            d_glyphIndex[page][codepoint % GlyphIndexPageSize] : 0;
+    }
+
     //! Name of this font.
     String d_name;
     //! Type name string for this font (not used internally)
@@ -499,6 +554,19 @@ protected:
     typedef std::map<utf32, FontGlyph, std::less<utf32> > CodepointMap;
     //! Contains mappings from code points to Image objects
     mutable CodepointMap d_cp_map;
+
+    //! Number of codepoints covered by each page of the glyph index.
+    static const utf32 GlyphIndexPageSize = 256;
+    /*!
+    \brief
+        Direct lookup table from codepoint to the glyphs in d_cp_map.
+
+        The table is split into pages of GlyphIndexPageSize entries, which are
+        only allocated for ranges of codepoints the font has glyphs for; so
+        the commonly used blocks are dense arrays, while the unused parts of
+        the codepoint space cost one null pointer per page.
+    */
+    std::vector<FontGlyph**> d_glyphIndex;
 };
 
 
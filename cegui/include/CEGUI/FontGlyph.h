@@ -46,7 +46,8 @@ public:
     FontGlyph(float advance = 0.0f, Image* image = 0, bool valid = false) :
         d_image(image),
         d_advance(advance),
-        d_valid(valid)
+        d_valid(valid),
+        d_pageIndex(0)
     {}
 
     //! Return the CEGUI::Image object rendered for this glyph.
@@ -104,6 +105,18 @@ public:
     bool isValid() const
     { return d_valid; }
 
+    /*!
+    \brief
+        Return the index of the texture page holding the image, for fonts
+        that spread their glyph images over several textures.
+    */
+    uint getPageIndex() const
+    { return d_pageIndex; }
+
+    //! Set the index of the texture page holding the image.
+    void setPageIndex(uint index)
+    { d_pageIndex = index; }
+
 private:
     //! The image which will be rendered for this glyph.
     Image* d_image;
@@ -111,6 +124,8 @@ private:
     float d_advance;
     //! says whether this glyph info is actually valid
     bool d_valid;
+    //! index of the texture page holding d_image.
+    uint d_pageIndex;
 };
 
 } // End of  CEGUI namespace section
@@ -171,6 +171,9 @@ public:
     */
     void notifyDisplaySizeChanged(const Sizef& size);
 
+    //! Notify all fonts that a new frame is about to be rendered.
+    void notifyFrameStarted();
+
     /*!
     \brief
         Writes a full XML font file for the specified Font to the given
@@ -48,7 +48,11 @@ namespace CEGUI
     like TTF and PS as well as on bitmap font formats like PCF and FON.
 
     Glyphs are rendered dynamically on demand, so a large font with lots
-    of glyphs won't slow application startup time.
+    of glyphs won't slow application startup time.  Each glyph is rasterised
+    individually the first time it is used and packed into one of a number of
+    glyph pages (textures), only the new glyph's area of which is uploaded.
+    When all pages are full, the least recently used page is cleared and
+    reused.
 */
 class FreeTypeFont : public Font
 {
@@ -114,6 +118,55 @@ public:
     //! return whether the freetype font is rendered anti-aliased.
     void setAntiAliased(const bool anti_alaised);
 
+    /*!
+    \brief
+        Rasterise the glyphs for all codepoints in \a codepoints now, rather
+        than the first time each of them is used.
+
+        This allows the cost of rasterising, for example, the characters of a
+        language's common character set to be taken at a convenient time
+        instead of while rendering a frame.
+    */
+    void prewarmGlyphs(const String& codepoints) const;
+
+    /*!
+    \brief
+        Rasterise the glyphs for all codepoints in the range \a start_codepoint
+        to \a end_codepoint (inclusive) that the font has glyphs for.
+    */
+    void prewarmGlyphs(utf32 start_codepoint, utf32 end_codepoint) const;
+
+    /*!
+    \brief
+        Set the maximum number of glyph pages (textures) the font may use.
+
+        Glyphs are never evicted while a frame is being rendered, since that
+        would invalidate geometry that has already been drawn.  Once all
+        pages are full, new glyphs go on an extra page instead, and at the
+        start of the next frame the least recently used pages beyond the
+        maximum are released.  Pages used during the previous frame are
+        kept, so a frame that needs more glyphs than fit in \a count pages
+        keeps the extra pages for as long as it does.
+
+        Pages already in use beyond the new maximum are released.
+    */
+    void setMaxGlyphPageCount(const uint count);
+
+    //! return the maximum number of glyph pages the font may use.
+    uint getMaxGlyphPageCount() const;
+
+    //! return the number of glyph pages currently in use.
+    uint getGlyphPageCount() const;
+
+    //! return the width and height, in pixels, of the glyph page textures.
+    uint getGlyphPageSize() const;
+
+    //! The default maximum number of glyph pages a FreeTypeFont may use.
+    static const uint DefaultMaxGlyphPageCount;
+
+    // overrides of functions in Font base class.
+    void notifyFrameStarted();
+
 protected:
     /*!
     \brief
@@ -132,17 +185,100 @@ protected:
     */
     void drawGlyphToBuffer(argb_t* buffer, uint buf_width) const;
 
+    //! A row of glyphs within a GlyphPage.
+    struct GlyphShelf
+    {
+        //! y position of the top of the shelf.
+        uint d_top;
+        //! height of the shelf, including padding.
+        uint d_height;
+        //! x position where the next glyph on the shelf will go.
+        uint d_used;
+    };
+
+    //! A texture along with the state needed to pack glyphs into it.
+    struct GlyphPage
+    {
+        //! The texture holding the glyph imagery.
+        Texture* d_texture;
+        //! Shelves allocated so far, from top to bottom.
+        std::vector<GlyphShelf> d_shelves;
+        //! Codepoints of the glyphs with imagery on this page.
+        std::vector<utf32> d_codepoints;
+        //! Value of d_glyphUseCounter when a glyph on the page was last used.
+        unsigned long d_lastUsed;
+        //! Position of the page in d_glyphPages, kept in its glyphs.
+        uint d_index;
+    };
+
     /*!
     \brief
-        Return the required texture size required to store imagery for the
-        glyphs from s to e
-    \param s
-        The first glyph in set
-    \param e
-        The last glyph in set
+        Compute a glyph page size that holds roughly one Font::getGlyphData
+        page worth of glyphs at the current size of the font.
     */
-    uint getTextureSize(CodepointMap::const_iterator s,
-                        CodepointMap::const_iterator e) const;
+    uint calculateGlyphPageSize() const;
+
+    //! Create a new, empty glyph page.
+    GlyphPage* createGlyphPage() const;
+
+    /*!
+    \brief
+        Clear \a page and reset the glyphs that had imagery on it.  Cached
+        rendering that may use the glyphs must be invalidated afterwards.
+    */
+    void evictGlyphPage(GlyphPage& page) const;
+
+    /*!
+    \brief
+        Release the least recently used glyph pages until no more than the
+        maximum are left, invalidating all cached rendering if any page was
+        released.
+
+    \param keep_recent
+        If true, pages used since the start of the current frame are kept
+        even if that leaves more pages than the maximum.
+    */
+    void releaseExcessGlyphPages(bool keep_recent);
+
+    //! Set the index of \a page, and the page index of the glyphs on it.
+    void setGlyphPageIndex(GlyphPage& page, uint index) const;
+
+    //! Reset the content of the texture of \a page to transparent.
+    void clearGlyphPageTexture(GlyphPage& page) const;
+
+    /*!
+    \brief
+        Find space for an area of \a width by \a height pixels (including
+        padding) on \a page.
+
+    \return
+        true if space was found, in which case \a x and \a y receive the
+        position of the area.  false if \a page has no space left.
+    */
+    static bool allocateGlyphArea(GlyphPage& page, uint page_size,
+                                  uint width, uint height, uint& x, uint& y);
+
+    /*!
+    \brief
+        Return the page that an area of \a width by \a height pixels will be
+        allocated on, with \a x and \a y receiving the position of the area.
+        This creates a new page if no existing page has room, even when that
+        exceeds the maximum page count.
+
+    \return
+        The page, or 0 if the area can never fit on a glyph page.
+    */
+    GlyphPage* findSpaceForGlyph(uint width, uint height, uint& x, uint& y) const;
+
+    //! Rasterise \a glyph for \a codepoint and store the imagery in a glyph page.
+    void rasteriseGlyph(const utf32 codepoint, FontGlyph& glyph) const;
+
+    //! Give \a glyph for \a codepoint an image for the area \a area of \a page.
+    void setGlyphImage(const utf32 codepoint, FontGlyph& glyph, GlyphPage& page,
+                       const Rectf& area, const glm::vec2& offset) const;
+
+    //! Mark the page holding the imagery of \a glyph as recently used.
+    void touchGlyphPage(const FontGlyph& glyph) const;
 
     //! Register all properties of this class.
     void addFreeTypeFontProperties();
@@ -150,7 +286,7 @@ protected:
     void free();
 
     //! initialise FontGlyph for given codepoint.
-    void initialiseFontGlyph(CodepointMap::iterator cp) const;
+    void initialiseFontGlyph(const utf32 codepoint, FontGlyph& glyph) const;
 
     void initialiseGlyphMap();
 
@@ -170,13 +306,20 @@ protected:
     FT_Face d_fontFace;
     //! Font file data
     RawDataContainer d_fontData;
-    //! Type definition for TextureVector.
-    typedef std::vector<Texture*> TextureVector;
-    //! Textures that hold the glyph imagery for this font.
-    mutable TextureVector d_glyphTextures;
-    typedef std::vector<BitmapImage*> ImageVector;
-    //! collection of images defined for this font.
-    mutable ImageVector d_glyphImages;
+    //! Type definition for GlyphPageVector.
+    typedef std::vector<GlyphPage*> GlyphPageVector;
+    //! Pages that hold the glyph imagery for this font.
+    mutable GlyphPageVector d_glyphPages;
+    //! Width and height of the glyph page textures.
+    uint d_glyphPageSize;
+    //! Maximum number of glyph pages to use.
+    uint d_maxGlyphPages;
+    //! Number of glyph pages created so far, used to name the textures.
+    mutable uint d_glyphPagesCreated;
+    //! Counter advanced on every glyph lookup, giving page use recency.
+    mutable unsigned long d_glyphUseCounter;
+    //! Value of d_glyphUseCounter when the current frame started.
+    unsigned long d_frameStartGlyphUse;
 };
 
 } // End of  CEGUI namespace section
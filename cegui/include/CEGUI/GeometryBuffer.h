@@ -66,7 +66,18 @@ enum VertexAttributeType
     //! Colour 0 attribute
     VAT_COLOUR0,
     //! Texture coordinate 0 attribute
-    VAT_TEXCOORD0
+    VAT_TEXCOORD0,
+    /*!
+        Colour 0 attribute stored as four normalised bytes (red, green, blue,
+        alpha, in memory order) in the space of a single float.
+    */
+    VAT_COLOUR0_PACKED,
+    /*!
+        Texture coordinate 0 attribute stored as two normalised 16 bit
+        unsigned integers in the space of a single float.  Only coordinates
+        in the range [0, 1] can be represented.
+    */
+    VAT_TEXCOORD0_PACKED
 };
 
 //----------------------------------------------------------------------------//
@@ -106,6 +117,23 @@ public:
     */
     virtual void draw() const = 0;
 
+    /*!
+    \brief
+        Draw this GeometryBuffer followed by other GeometryBuffers that are
+        draw compatible with it (see isDrawCompatible).  The result is the
+        same as calling draw on each buffer in turn, which is what the default
+        implementation does; renderers may override this to submit all of the
+        geometry with a single draw call.
+
+    \param others
+        Pointer to an array of GeometryBuffers to draw after this one.
+
+    \param count
+        Number of GeometryBuffers in \a others.
+    */
+    virtual void drawWith(const GeometryBuffer* const* others,
+                          std::size_t count) const;
+
     /*!
     \brief
         Set the translation to be applied to the geometry in the buffer when it
@@ -166,12 +194,25 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    /*!
+    \brief
+        Return the custom transformation matrix that is applied to the
+        geometry in the buffer after all the other transformations.
+    */
+    const glm::mat4x4& getCustomTransform() const;
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer.
     */
     virtual void setClippingRegion(const Rectf& region) = 0;
 
+    /*!
+    \brief
+        Return the clipping region that is used when rendering this buffer.
+    */
+    virtual const Rectf& getClippingRegion() const = 0;
+
     /*!
     \brief
         Sets the fill rule that should be used when rendering the geometry.
@@ -181,6 +222,12 @@ public:
     */
     void setStencilRenderingActive(PolygonFillRule fill_rule);
 
+    /*!
+    \brief
+        Returns the fill rule that is used when rendering the geometry.
+    */
+    PolygonFillRule getStencilRenderingFillRule() const;
+
     /*!
     \brief
         Sets the number of vertices that should be rendered after the stencil buffer was filled.
@@ -190,6 +237,13 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count);
 
+    /*!
+    \brief
+        Returns the number of vertices that are rendered after the stencil
+        buffer was filled.
+    */
+    unsigned int getStencilPostRenderingVertexCount() const;
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -203,6 +257,47 @@ public:
     */
     virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
 
+    /*!
+    \brief
+        Make room for \a vertex_count vertices at the end of the vertex data
+        and return a pointer to it, so that the vertices can be written in
+        place.  The data must be laid out according to the vertex attributes
+        of the buffer.  endAppendGeometry must be called once the data has
+        been written, before any other function of the buffer is used.
+
+    \param vertex_count
+        The number of vertices that will be written.
+
+    \return
+        Pointer to the first float of the new vertices.
+    */
+    float* beginAppendGeometry(std::size_t vertex_count);
+
+    /*!
+    \brief
+        Complete appending the vertices whose space was obtained with
+        beginAppendGeometry.
+    */
+    void endAppendGeometry();
+
+    /*!
+    \brief
+        Append textured quads to the buffer.
+
+        Each quad is given as four corners in the order top-left,
+        bottom-left, bottom-right and top-right, and is drawn as the two
+        triangles top-left, bottom-left, bottom-right and top-right,
+        top-left, bottom-right.  When indexed geometry is active this uses
+        four vertices and six indices per quad, otherwise six vertices.
+
+    \param corners
+        Pointer to an array of 4 * \a quad_count vertices.
+
+    \param quad_count
+        The number of quads to be added.
+    */
+    void appendQuads(const TexturedColouredVertex* corners, std::size_t quad_count);
+
     /*!
     \brief
         Append a single vertex to the buffer.
@@ -300,6 +395,45 @@ public:
     */
     virtual std::size_t getVertexCount() const;
 
+    /*!
+    \brief
+        Returns the vertex data of this GeometryBuffer, laid out according to
+        the vertex attributes of the buffer.
+
+    \return
+        The floats that have been appended to this GeometryBuffer.
+    */
+    const std::vector<float>& getVertexData() const;
+
+    /*!
+    \brief
+        Set whether the buffer draws its vertices through an index array.
+        This must be set before any geometry is added, and is normally set
+        by the Renderer when creating the buffer.
+
+        Indexed buffers store quads added with appendQuads as four vertices
+        instead of six; all other geometry receives one index per vertex.
+    */
+    void setIndexedGeometryActive(bool active);
+
+    //! Return whether the buffer draws its vertices through an index array.
+    bool isIndexedGeometryActive() const;
+
+    /*!
+    \brief
+        Returns the index data of this GeometryBuffer.  This is empty unless
+        indexed geometry is active.
+    */
+    const std::vector<uint32>& getIndexData() const;
+
+    /*!
+    \brief
+        Returns the number of vertices that are drawn for the buffer: the
+        number of indices if indexed geometry is active, otherwise the
+        number of vertices.  Stencil post rendering counts refer to this.
+    */
+    std::size_t getDrawCount() const;
+
     /*!
     \brief
         Returns the total number of floats used by the attributes of the
@@ -385,6 +519,52 @@ public:
     */
     virtual bool isClippingActive() const;
 
+    /*!
+    \brief
+        Return whether textured geometry with the given settings can be
+        appended to this GeometryBuffer so that both the existing and the new
+        geometry render exactly as they would from two separate buffers.
+
+        This is used to batch consecutive quads (i.e. the glyphs of a string or
+        the parts of a frame) into a single GeometryBuffer instead of creating
+        a new buffer and draw call for each one of them.
+
+    \param texture
+        The texture the new geometry will be sampled from.
+
+    \param clipping_active
+        Whether clipping is to be active for the new geometry.
+
+    \param clipping_region
+        The clipping region for the new geometry.  Only used if
+        \a clipping_active is true.
+
+    \param alpha
+        The alpha value that is to be applied to the new geometry.
+
+    \param blend_mode
+        The BlendMode that is to be used for the new geometry.
+
+    \return
+        - true if the geometry can be appended to this GeometryBuffer.
+        - false if a new GeometryBuffer must be used for the geometry.
+    */
+    bool isBatchCompatible(const Texture* texture, bool clipping_active,
+                           const Rectf& clipping_region, float alpha,
+                           BlendMode blend_mode = BM_NORMAL) const;
+
+    /*!
+    \brief
+        Return whether this GeometryBuffer and \a other render with identical
+        state, so that their geometry could be submitted with one draw call.
+        This requires the same vertex layout and shader, equal values for all
+        parameters of the two RenderMaterials (textures and any custom
+        parameters alike), the same clipping, blend mode and alpha, and that
+        neither buffer uses a RenderEffect or stencil rendering.  The
+        transformations of the two buffers may differ.
+    */
+    bool isDrawCompatible(const GeometryBuffer& other) const;
+
     /*
     \brief
         Resets the vertex attributes that were set for the vertices of this
@@ -473,6 +653,22 @@ public:
 protected:
     GeometryBuffer(RefCounted<RenderMaterial> renderMaterial);
 
+    /*!
+    \brief
+        Called after vertices were appended to the buffer, so that renderers
+        can update their copy of the vertex data.  The default does nothing.
+    */
+    virtual void onGeometryAppended();
+
+    /*!
+    \brief
+        Write one vertex to \a dest, laid out according to the vertex
+        attributes of the buffer, and return the position after it.
+    */
+    float* writeVertex(float* dest, const glm::vec3& position,
+                       const glm::vec4& colour,
+                       const glm::vec2& tex_coords) const;
+
     //! Reference to the RenderMaterial used for this GeometryBuffer
     RefCounted<RenderMaterial>  d_renderMaterial;
 
@@ -489,6 +685,10 @@ protected:
         vertex data.
     */
     std::vector<VertexAttributeType> d_vertexAttributes;
+    //! Whether the vertices are drawn through d_indexData.
+    bool                        d_indexedGeometry;
+    //! The indices of the vertices to draw, if indexed geometry is active.
+    std::vector<uint32>         d_indexData;
 
 
     //! translation vector
@@ -29,6 +29,7 @@
 
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Singleton.h"
+#include <set>
 
 
 #if defined(_MSC_VER)
@@ -93,6 +94,18 @@ public:
 		Nothing.
 	*/
 	virtual void	fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "");
+
+private:
+    //! rebuild d_eventNames if events were added or removed since last time.
+    void updateEventNames();
+
+    typedef std::set<String, StringFastLessCompare> EventNameSet;
+    /** every part of the names of events in this set that follows a '/',
+     * used to skip building the full name of events nobody subscribed to.
+     */
+    EventNameSet d_eventNames;
+    //! value of d_eventsVersion that d_eventNames was built for.
+    unsigned int d_eventNamesVersion;
 };
 
 } // End of  CEGUI namespace section
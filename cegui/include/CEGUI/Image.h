@@ -283,6 +283,15 @@ public:
      */
     void setImageArea(const Rectf& image_area);
 
+    /*!
+    \brief
+        Returns the rectangular image area of this Image.
+
+    \return
+        The rectangular image area of this Image.
+     */
+    const Rectf& getImageArea() const;
+
     /*!
     \brief
         Sets the pixel offset of this Image.
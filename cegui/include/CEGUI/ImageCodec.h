@@ -95,6 +95,19 @@ public:
     */
     virtual Texture* load(const RawDataContainer& data, Texture* result) = 0;
 
+    /*!
+      \brief
+      Return whether load may be called from several threads at once, and
+      at the same time as the thread running the GUI.
+
+      This is used by AsyncSchemeLoader to decide whether images may be
+      decoded on its worker threads.  The default returns false; codecs
+      that keep no shared state while decoding override it.
+
+      \return true if load is safe to call concurrently.
+    */
+    virtual bool isThreadSafe() const;
+
 private:
     String d_identifierString;   //!< display the name of the codec 
 
@@ -50,6 +50,7 @@ public:
     ~PVRImageCodec();
 
     Texture* load(const RawDataContainer& data, Texture* result);
+    bool isThreadSafe() const;
 };    
 
 } // End of CEGUI namespace section 
@@ -29,6 +29,7 @@
 #ifndef _CEGUISTBImageCodec_h_
 #define _CEGUISTBImageCodec_h_
 #include "../../ImageCodec.h"
+#include "../../Threading.h"
 
 
 #if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
@@ -56,6 +57,11 @@ public:
     ~STBImageCodec();
 
     Texture* load(const RawDataContainer& data, Texture* result);
+    bool isThreadSafe() const;
+
+private:
+    //! stb_image keeps some global state, so decoding is serialised.
+    Mutex d_mutex;
 };    
 
 } // End of CEGUI namespace section 
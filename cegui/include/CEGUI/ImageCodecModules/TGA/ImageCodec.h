@@ -97,6 +97,7 @@ public:
     // DigiBen@GameTutorials.com
     // Co-Web Host of www.GameTutorials.com
     Texture* load(const RawDataContainer& data, Texture* result);
+    bool isThreadSafe() const;
 
 protected:
 private:
@@ -0,0 +1,194 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIInputEventQueue_h_
+#define _CEGUIInputEventQueue_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/InjectedInputReceiver.h"
+#include "CEGUI/Threading.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    InjectedInputReceiver that stores injected input and passes it on to
+    another InjectedInputReceiver (normally an InputAggregator) in one batch
+    when dispatch is called.
+
+    Input may be injected from any thread, so an input thread can feed the
+    queue while the GUI thread calls dispatch once at the start of each
+    frame.  Consecutive mouse moves, mouse positions and mouse wheel changes
+    are merged while queued, so a high rate mouse produces a single cursor
+    move - and a single hit-test of the GUIContext - per frame instead of
+    one for every report.  Other input is kept in order and never merged.
+
+    Since queued input is not processed until it is dispatched, all the
+    inject functions of this class return false.
+*/
+class CEGUIEXPORT InputEventQueue : public InjectedInputReceiver
+{
+public:
+    /*!
+    \brief
+        Create a queue that dispatches input to \a receiver.  The receiver
+        is only ever called from dispatch.
+    */
+    explicit InputEventQueue(InjectedInputReceiver* receiver);
+    ~InputEventQueue();
+
+    //! Set the InjectedInputReceiver that dispatched input is passed to.
+    void setReceiver(InjectedInputReceiver* receiver);
+
+    //! Return the InjectedInputReceiver that dispatched input is passed to.
+    InjectedInputReceiver* getReceiver() const;
+
+    /*!
+    \brief
+        Set whether consecutive mouse moves, positions and wheel changes
+        are merged while queued.  This is enabled by default.
+    */
+    void setCoalescingEnabled(bool setting);
+
+    //! Return whether consecutive mouse input is merged while queued.
+    bool isCoalescingEnabled() const;
+
+    //! Return the number of inputs currently queued.
+    size_t getQueuedInputCount() const;
+
+    //! Discard all queued input.
+    void clear();
+
+    /*!
+    \brief
+        Pass all input queued so far to the receiver, in the order it was
+        injected.  This must be called from the thread that runs the GUI;
+        input injected while it runs is kept for the next call.
+
+    \return
+        - true if the receiver processed any of the dispatched input.
+        - false if no input was queued or none of it was processed.
+    */
+    bool dispatch();
+
+    /************************************************************************/
+    /* InjectedInputReceiver interface implementation                       */
+    /************************************************************************/
+    bool injectMouseMove(float delta_x, float delta_y);
+    bool injectMouseLeaves();
+
+    bool injectMouseButtonDown(MouseButton button);
+    bool injectMouseButtonUp(MouseButton button);
+
+    bool injectKeyDown(Key::Scan scan_code);
+    bool injectKeyUp(Key::Scan scan_code);
+
+    bool injectChar(String::value_type code_point);
+    bool injectMouseWheelChange(float delta);
+    bool injectMousePosition(float x_pos, float y_pos);
+
+    bool injectMouseButtonClick(const MouseButton button);
+    bool injectMouseButtonDoubleClick(const MouseButton button);
+    bool injectMouseButtonTripleClick(const MouseButton button);
+
+    bool injectCopyRequest();
+    bool injectCutRequest();
+    bool injectPasteRequest();
+
+protected:
+    //! Kinds of input held in the queue, one per inject function.
+    enum QueuedInputType
+    {
+        QIT_MouseMove,
+        QIT_MouseLeaves,
+        QIT_MouseButtonDown,
+        QIT_MouseButtonUp,
+        QIT_KeyDown,
+        QIT_KeyUp,
+        QIT_Char,
+        QIT_MouseWheelChange,
+        QIT_MousePosition,
+        QIT_MouseButtonClick,
+        QIT_MouseButtonDoubleClick,
+        QIT_MouseButtonTripleClick,
+        QIT_CopyRequest,
+        QIT_CutRequest,
+        QIT_PasteRequest
+    };
+
+    //! One queued input with the arguments it was injected with.
+    struct QueuedInput
+    {
+        QueuedInput(QueuedInputType type, float x = 0.0f, float y = 0.0f) :
+            d_type(type),
+            d_x(x),
+            d_y(y),
+            d_value(0)
+        {}
+
+        QueuedInputType d_type;
+        //! x delta, x position or wheel delta.
+        float d_x;
+        //! y delta or y position.
+        float d_y;
+        //! MouseButton, Key::Scan or code point.
+        uint32 d_value;
+    };
+
+    //! Add \a input to the queue, merging it with the last input if possible.
+    void queueInput(const QueuedInput& input);
+    //! Pass \a input to the receiver.
+    bool dispatchInput(const QueuedInput& input);
+
+    //! Receiver that dispatched input is passed to.
+    InjectedInputReceiver* d_receiver;
+    //! Whether consecutive mouse input is merged.
+    bool d_coalescing;
+    //! Input waiting to be dispatched.
+    std::vector<QueuedInput> d_queue;
+    //! Input being dispatched; kept to reuse its storage.
+    std::vector<QueuedInput> d_dispatching;
+    //! Protects d_queue and d_coalescing.
+    mutable Mutex d_mutex;
+
+private:
+    InputEventQueue(const InputEventQueue&);
+    InputEventQueue& operator=(const InputEventQueue&);
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIInputEventQueue_h_
@@ -53,6 +53,43 @@ namespace CEGUI
 class CEGUIEXPORT Interpolator
 {
 public:
+    /*!
+    \brief
+        Applies interpolated values of one Affector to the target property of
+        one AnimationInstance using the native type of that property.
+
+        Unlike the interpolate functions of Interpolator, a NativeApplier does
+        not format the result to a String that then has to be looked up by
+        name and parsed again by the target property.  Values converted from
+        their String representation (keyframe values, saved base values) are
+        cached, so stepping an animation does not allocate.
+
+        NativeApplier objects are created via Interpolator::createNativeApplier
+        and owned by the AnimationInstance that uses them.
+    */
+    class CEGUIEXPORT NativeApplier
+    {
+    public:
+        virtual ~NativeApplier() {}
+
+        //! native equivalent of Interpolator::interpolateAbsolute
+        virtual void applyAbsolute(const String& value1,
+                                   const String& value2,
+                                   float position) = 0;
+
+        //! native equivalent of Interpolator::interpolateRelative
+        virtual void applyRelative(const String& base,
+                                   const String& value1,
+                                   const String& value2,
+                                   float position) = 0;
+
+        //! native equivalent of Interpolator::interpolateRelativeMultiply
+        virtual void applyRelativeMultiply(const String& base,
+                                           const String& value1,
+                                           const String& value2,
+                                           float position) = 0;
+    };
+
     //! destructor
     virtual ~Interpolator() {};
 
@@ -85,6 +122,23 @@ public:
             const String& value1,
             const String& value2,
             float position) = 0;
+
+    /*!
+    \brief
+        Creates a NativeApplier that sets the interpolated values directly
+        on \a property of \a receiver.
+
+    \return
+        Pointer to the new NativeApplier, which the caller is responsible for
+        deleting, or 0 if this interpolator can't set values of the given
+        property natively.  In that case the String based interpolate
+        functions have to be used.
+    */
+    virtual NativeApplier* createNativeApplier(PropertyReceiver* /*receiver*/,
+                                               Property* /*property*/)
+    {
+        return 0;
+    }
 };
 
 } // End of  CEGUI namespace section
@@ -108,6 +108,32 @@ public:
 	LoggingLevel	getLoggingLevel(void) const		{return d_level;}
 
 
+	/*!
+	\brief
+		return whether messages of the given level will be logged with the
+		current logging level setting.
+
+	\param level
+		LoggingLevel of the message.
+	*/
+	bool	isLoggingLevelEnabled(LoggingLevel level) const	{return level <= d_level;}
+
+
+	/*!
+	\brief
+		return whether logEvent currently keeps messages of the given level.
+		That is the case for enabled levels, and for all levels while the
+		logger holds messages back to filter them later, as DefaultLogger
+		does until its log file is set.  Code that builds log messages can
+		check this first (or use the CEGUI_LOG macro) to avoid building
+		messages that would be discarded.
+
+	\param level
+		LoggingLevel of the message.
+	*/
+	bool	isLoggingLevelKept(LoggingLevel level) const	{return d_keepingAllLevels || level <= d_level;}
+
+
 	/*!
 	\brief
 		Add an event to the log.
@@ -144,6 +170,7 @@ public:
 
 protected:
 	LoggingLevel	d_level;		//!< Holds current logging level
+	bool	d_keepingAllLevels;		//!< true while logEvent keeps messages of every level
 
 private:
 	/*************************************************************************
@@ -154,12 +181,24 @@ private:
 
 };
 
+/*************************************************************************
+	This macro logs a message only if its level is enabled in the Logger;
+	otherwise the message expression is not evaluated at all.
+*************************************************************************/
+#define CEGUI_LOG( message, level ) \
+	do \
+	{ \
+		CEGUI::Logger& cegui_logger_ = CEGUI::Logger::getSingleton(); \
+		if (cegui_logger_.isLoggingLevelKept(level)) \
+			cegui_logger_.logEvent((message), (level)); \
+	} while (false)
+
 /*************************************************************************
 	This macro is used for 'Insane' level logging so that those items are
 	excluded from non-debug builds
 *************************************************************************/
 #if defined(DEBUG) || defined (_DEBUG)
-#	define CEGUI_LOGINSANE( message ) CEGUI::Logger::getSingleton().logEvent((message), CEGUI::Insane);
+#	define CEGUI_LOGINSANE( message ) CEGUI_LOG((message), CEGUI::Insane);
 #else
 #	define CEGUI_LOGINSANE( message ) (void)0
 #endif
@@ -0,0 +1,89 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIMappedFileResourceProvider_h_
+#define _CEGUIMappedFileResourceProvider_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/DefaultResourceProvider.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    ResourceProvider that hands out read-only memory mapped views of files
+    instead of copying them into allocated buffers.
+
+    Resource groups and file name resolution work exactly as for the
+    DefaultResourceProvider.  Mappings are shared: loading a file that is
+    already mapped (for example a font used by several schemes) returns the
+    existing view, and a file is unmapped when the last RawDataContainer
+    referring to it is passed to unloadRawDataContainer.
+
+    The RawDataContainer objects filled by this provider do not own their
+    data (see RawDataContainer::setExternalData) and must not be written to.
+    Files that are empty or cannot be mapped, and all files on platforms
+    without memory mapping support, are loaded by copying as the
+    DefaultResourceProvider does.  Loading and unloading may be done from
+    several threads at once.
+*/
+class CEGUIEXPORT MappedFileResourceProvider : public DefaultResourceProvider
+{
+public:
+    MappedFileResourceProvider();
+    ~MappedFileResourceProvider();
+
+    //! Return the number of files currently mapped.
+    size_t getMappedFileCount() const;
+
+    void loadRawDataContainer(const String& filename,
+                              RawDataContainer& output,
+                              const String& resourceGroup);
+    void unloadRawDataContainer(RawDataContainer& data);
+    bool isThreadSafe() const;
+
+protected:
+    struct Impl;
+    Impl* d_pimpl;
+
+private:
+    // copying would share the mappings between two owners.
+    MappedFileResourceProvider(const MappedFileResourceProvider&);
+    MappedFileResourceProvider& operator=(const MappedFileResourceProvider&);
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIMappedFileResourceProvider_h_
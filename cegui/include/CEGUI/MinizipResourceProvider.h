@@ -69,6 +69,8 @@ public:
     void loadRawDataContainer(const String& filename,
                               RawDataContainer& output,
                               const String& resourceGroup);
+    //! Return false, since all files are read through a single open archive.
+    bool isThreadSafe() const;
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group);
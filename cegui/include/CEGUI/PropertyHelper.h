@@ -339,7 +339,7 @@ public:
     }
 };
 
-#if CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_UNICODE
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_STD
 
 template<>
 class PropertyHelper<String::value_type>
@@ -111,14 +111,20 @@ public:
 	\brief
 		Constructs a new PropertySet object
 	*/
-    PropertySet(void) {}
+    PropertySet(void);
 
 
     /*!
 	\brief
 		Destructor for PropertySet objects.
 	*/
-    virtual ~PropertySet(void) {}
+    virtual ~PropertySet(void);
+
+    //! copy constructor, the copy shares the properties of \a other
+    PropertySet(const PropertySet& other);
+
+    //! assignment operator, this shares the properties of \a rhs afterwards
+    PropertySet& operator=(const PropertySet& rhs);
 
 
     /*!
@@ -219,14 +225,7 @@ public:
     template<typename T>
     typename PropertyHelper<T>::return_type getProperty(const String& name) const
     {
-        PropertyRegistry::const_iterator pos = d_properties.find(name);
-
-        if (pos == d_properties.end())
-        {
-            CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
-        }
-
-        Property* baseProperty = pos->second;
+        Property* baseProperty = getPropertyInstance(name);
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -265,14 +264,7 @@ public:
     template<typename T>
     void    setProperty(const String& name, typename PropertyHelper<T>::pass_type value)
     {
-        PropertyRegistry::iterator pos = d_properties.find(name);
-
-        if (pos == d_properties.end())
-        {
-            CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
-        }
-
-        Property* baseProperty = pos->second;
+        Property* baseProperty = getPropertyInstance(name);
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -315,7 +307,22 @@ public:
 
 private:
     typedef std::map<String, Property*, StringFastLessCompare> PropertyRegistry;
-    PropertyRegistry	d_properties;
+
+    /*!
+    \brief
+        Shared, immutable registry of properties, see PropertySet.cpp
+
+        Instances of the same class add the same Property objects in the same
+        order, so PropertySets share the tables they pass through instead of
+        each building its own PropertyRegistry.
+    */
+    class PropertyTable;
+
+    //! switch to given table of properties
+    void setPropertyTable(PropertyTable* table);
+
+    //! table holding the properties currently in this set
+    PropertyTable* d_propertyTable;
 
 
 public:
@@ -58,6 +58,18 @@ public:
     //! \copydoc Interpolator::getType
     virtual const String& getType() const;
     
+    //! native equivalent of interpolateAbsolute
+    static glm::quat absolute(const glm::quat& val1, const glm::quat& val2,
+                              float position);
+
+    //! native equivalent of interpolateRelative
+    static glm::quat relative(const glm::quat& bas, const glm::quat& val1,
+                              const glm::quat& val2, float position);
+
+    //! native equivalent of interpolateRelativeMultiply, always throws
+    static glm::quat relativeMultiply(const glm::quat& bas, float val1,
+                                      float val2, float position);
+
     //! \copydoc Interpolator::interpolateAbsolute
     virtual String interpolateAbsolute(const String& value1,
                                        const String& value2,
@@ -74,6 +86,10 @@ public:
                                                const String& value1,
                                                const String& value2,
                                                float position);
+
+    //! \copydoc Interpolator::createNativeApplier
+    virtual NativeApplier* createNativeApplier(PropertyReceiver* receiver,
+                                               Property* property);
 };
 
 }
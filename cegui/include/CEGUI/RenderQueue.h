@@ -60,6 +60,22 @@ public:
     */
     void draw() const;
 
+    /*!
+    \brief
+        Set whether RenderQueues merge the drawing of adjacent GeometryBuffer
+        objects.
+
+        When enabled, each run of consecutive queued GeometryBuffers that are
+        draw compatible (see GeometryBuffer::isDrawCompatible) is drawn with
+        one call to GeometryBuffer::drawWith, which renderers supporting it
+        turn into a single vertex upload and draw call.  The drawing order, and
+        so the rendered result, is unchanged.  Disabled by default.
+    */
+    static void setDrawMergingEnabled(bool setting);
+
+    //! Return whether RenderQueues merge the drawing of adjacent buffers.
+    static bool isDrawMergingEnabled();
+
     /*!
     \brief
         Add a list of GeometryBuffers to the RenderQueue. Ownership of the
@@ -104,6 +120,8 @@ private:
     typedef std::vector<const GeometryBuffer*> BufferList;
     //! Collection of GeometryBuffer objects that comprise this RenderQueue.
     BufferList d_buffers;
+    //! Whether draw merges compatible adjacent buffers.
+    static bool s_drawMergingEnabled;
 };
 
 } // End of  CEGUI namespace section
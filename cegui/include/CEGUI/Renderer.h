@@ -469,7 +469,47 @@ public:
     */
     const glm::mat4& getViewProjectionMatrix() const;
 
+    /*!
+    \brief
+        Return whether the renderer supports the compact geometry format (see
+        setCompactGeometryEnabled).
+    */
+    virtual bool isCompactGeometrySupported() const;
+
+    /*!
+    \brief
+        Set whether GeometryBuffers created from now on use the compact
+        geometry format, if the renderer supports it: colours packed into
+        four bytes, and quads stored as four indexed vertices instead of six.
+        This roughly halves the memory and bandwidth used by the vertex data.
+        The default is false.
+    */
+    void setCompactGeometryEnabled(bool setting);
+
+    //! Return whether the compact geometry format is enabled.
+    bool isCompactGeometryEnabled() const;
+
+    /*!
+    \brief
+        Set whether the compact geometry format also stores texture
+        coordinates as 16 bit normalised integers.  This can only be used
+        when all texture coordinates lie in the range [0, 1], which is the
+        case for geometry created by CEGUI itself.  The default is false.
+    */
+    void setPackedTexCoordsEnabled(bool setting);
+
+    //! Return whether texture coordinates are packed in the compact format.
+    bool isPackedTexCoordsEnabled() const;
+
 protected:
+    /*!
+    \brief
+        Add the vertex attributes of the default textured or coloured vertex
+        layout to a newly created GeometryBuffer, and activate indexed
+        geometry for it, according to the compact geometry settings.
+    */
+    void addDefaultVertexAttributes(GeometryBuffer& buffer, bool textured) const;
+
     /*!
     \brief
         Adds a created GeometryBuffer, which was returned when calling one of the
@@ -485,6 +525,10 @@ protected:
 
     //! The currently active view projection matrix 
     glm::mat4 d_viewProjectionMatrix;
+    //! Whether the compact geometry format is used for new GeometryBuffers.
+    bool d_compactGeometry;
+    //! Whether the compact geometry format packs texture coordinates.
+    bool d_packedTexCoords;
 private:
     //! container type used to hold GeometryBuffers created.
     typedef std::set<GeometryBuffer*> GeometryBufferSet;
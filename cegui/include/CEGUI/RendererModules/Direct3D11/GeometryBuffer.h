@@ -54,8 +54,8 @@ public:
 
     // Implement GeometryBuffer interface.
     virtual void draw() const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
     virtual void setClippingRegion(const Rectf& region);
+    virtual const Rectf& getClippingRegion() const;
 
     /*
     \brief
@@ -67,6 +67,9 @@ public:
     void finaliseVertexAttributes();
 
 protected:
+    // overrides of GeometryBuffer
+    virtual void onGeometryAppended();
+
     //! Update the cached matrices
     void updateMatrix() const;
     //! Synchronise data in the hardware buffer with what's been added
@@ -54,6 +54,7 @@ public:
     void setRotation(const glm::quat& r);
     void setPivot(const glm::vec3& p);
     void setClippingRegion(const Rectf& region);
+    const Rectf& getClippingRegion() const;
     void appendVertex(const Vertex& vertex);
     void appendGeometry(const Vertex* const vbuff, uint vertex_count);
     void setActiveTexture(Texture* texture);
@@ -48,6 +48,8 @@ public:
     void loadRawDataContainer(const String& filename, RawDataContainer& output,
                               const String& resourceGroup);
     void unloadRawDataContainer(RawDataContainer& data);
+    //! Return false, since files are read through the Irrlicht file system.
+    bool isThreadSafe() const;
 };
 
 } // End of  CEGUI namespace section
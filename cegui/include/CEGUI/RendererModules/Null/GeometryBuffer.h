@@ -58,6 +58,7 @@ public:
     void appendGeometry(const std::vector<float>& vertex_data);
     void finaliseVertexAttributes();
     void setClippingRegion(const Rectf& region);
+    const Rectf& getClippingRegion() const;
 protected:
     //! rectangular clip region
     Rectf d_clipRect;
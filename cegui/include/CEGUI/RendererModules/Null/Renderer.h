@@ -131,6 +131,7 @@ public:
     const glm::vec2& getDisplayDPI() const;
     uint getMaxTextureSize() const;
     const String& getIdentifierString() const;
+    bool isCompactGeometrySupported() const;
 
 protected:
     //! default constructor.
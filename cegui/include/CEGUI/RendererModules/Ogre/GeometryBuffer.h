@@ -69,14 +69,16 @@ public:
     virtual ~OgreGeometryBuffer();
 
     virtual void draw() const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
     virtual void setClippingRegion(const Rectf& region);
+    virtual const Rectf& getClippingRegion() const;
     virtual void reset();
     virtual int getVertexAttributeElementCount() const;
 
     void finaliseVertexAttributes(MANUALOBJECT_TYPE type);
 
 protected:
+    // overrides of GeometryBuffer
+    virtual void onGeometryAppended();
 
     //! Updates the cached matrix. This should only be called after the RenderTarget was set.
     void updateMatrix() const;
@@ -47,28 +47,49 @@ public:
 
     // Overrides of virtual and abstract methods from GeometryBuffer
     virtual void draw() const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
+    virtual void drawWith(const GeometryBuffer* const* others,
+                          std::size_t count) const;
     virtual void reset();
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
     void finaliseVertexAttributes();
 
 protected:
+    // overrides of GeometryBuffer
+    virtual void onGeometryAppended();
+
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
     void updateOpenGLBuffers();
     //! Draws the vertex data depending on the fill rule that was set for this object.
     void drawDependingOnFillRule() const;
+    //! Draw \a count vertices, in draw order, starting at \a first.
+    void drawTriangles(GLint first, GLsizei count) const;
+    //! Set up the scissor test and blend mode used for drawing this object.
+    void setupClippingAndBlendMode() const;
+    //! Set the vertex attribute pointers of the bound vao for our vertex layout.
+    void setupVertexAttributePointers() const;
 
     //! OpenGL vao used for the vertices
     GLuint d_verticesVAO;
     //! OpenGL vbo containing all vertex data
     GLuint d_verticesVBO;
+    //! OpenGL element buffer containing the index data, if indexed geometry is active
+    GLuint d_indicesEBO;
     //! Pointer to the OpenGL state changer wrapper that was created inside the Renderer
     OpenGLBaseStateChangeWrapper* d_glStateChanger;
     //! Size of the buffer that is currently in use
     GLuint d_bufferSize;
+    //! Size of the element buffer that is currently in use
+    GLuint d_indexBufferSize;
+    //! OpenGL vao, vbo and element buffer used to stream geometry merged by drawWith, or 0.
+    mutable GLuint d_mergedVAO;
+    mutable GLuint d_mergedVBO;
+    mutable GLuint d_mergedEBO;
+    //! Scratch buffers holding the geometry merged by drawWith.
+    mutable std::vector<float> d_mergedVertexData;
+    mutable std::vector<uint32> d_mergedIndexData;
 };
 
 }
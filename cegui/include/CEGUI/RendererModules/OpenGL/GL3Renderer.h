@@ -159,6 +159,7 @@ public:
     void endRendering();
     virtual Sizef getAdjustedTextureSize(const Sizef& sz);
     bool isS3TCSupported() const;
+    bool isCompactGeometrySupported() const;
     void setupRenderingBlendMode(const BlendMode mode,
                                  const bool force = false);
     RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const;
@@ -48,13 +48,15 @@ public:
 
     // Overrides of virtual and abstract methods from GeometryBuffer
     virtual void draw() const;
-    virtual void appendGeometry(const float* vertex_data, std::size_t array_size);
     virtual void reset();
 
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
     void finaliseVertexAttributes();
 
 protected:
+    // overrides of GeometryBuffer
+    virtual void onGeometryAppended();
+
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
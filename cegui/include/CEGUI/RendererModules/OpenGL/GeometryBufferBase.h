@@ -60,6 +60,7 @@ public:
 
     // Overrides of virtual and abstract methods inherited from GeometryBuffer
     virtual void setClippingRegion(const Rectf& region);
+    virtual const Rectf& getClippingRegion() const;
 
     /*
     \brief
@@ -0,0 +1,82 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareGeometryBuffer_h_
+#define _CEGUISoftwareGeometryBuffer_h_
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/Rect.h"
+
+#include <glm/glm.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareTexture;
+
+//! Implementation of CEGUI::GeometryBuffer for the SoftwareRenderer
+class SOFTWARE_GUIRENDERER_API SoftwareGeometryBuffer : public GeometryBuffer
+{
+public:
+    //! Constructor
+    SoftwareGeometryBuffer(SoftwareRenderer& owner,
+                           CEGUI::RefCounted<RenderMaterial> renderMaterial);
+    //! Destructor
+    virtual ~SoftwareGeometryBuffer();
+
+    // Implementation/overrides of member functions inherited from GeometryBuffer
+    void draw() const;
+    void setClippingRegion(const Rectf& region);
+    const Rectf& getClippingRegion() const;
+
+protected:
+    //! return the texture bound to the "texture0" parameter, or 0.
+    const SoftwareTexture* getActiveTexture() const;
+    //! update the cached model matrix if it has been invalidated.
+    void updateMatrix() const;
+    //! draw the vertices, applying the polygon fill rule via the stencil.
+    void drawDependingOnFillRule() const;
+
+    //! SoftwareRenderer that owns the GeometryBuffer.
+    SoftwareRenderer& d_owner;
+    //! rectangular clip region
+    Rectf d_clipRect;
+    //! cached model matrix.
+    mutable glm::mat4 d_matrix;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareGeometryBuffer_h_
@@ -0,0 +1,271 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRasteriser_h_
+#define _CEGUISoftwareRasteriser_h_
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Colour.h"
+#include "../../Rect.h"
+#include "../../Threading.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareTexture;
+
+/*!
+\brief
+    Scan converts triangles of CEGUI vertex data into a SoftwareTexture.
+
+    Triangles are set up once per draw and then rasterised one horizontal
+    band of TILE_HEIGHT rows at a time, so that the destination rows touched
+    by all triangles of a batch stay in cache.  Each band only depends on
+    the triangles overlapping it, so draws covering enough pixels have their
+    bands shared out between the calling thread and a set of worker threads.
+    Stencil passes are always rasterised on the calling thread.
+
+    Pixels are filled one span per row, with the inner loops specialised for
+    flat coloured and textured spans, scissor clipping is applied during
+    triangle setup, and the blend equations match those of the hardware
+    renderers for each BlendMode.  Positions are transformed by the model
+    matrix and projected orthographically.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRasteriser
+{
+public:
+    //! Operation performed on the stencil buffer by drawStencilTriangles.
+    enum StencilOperation
+    {
+        //! Invert the stencil value of every covered pixel.
+        SO_INVERT,
+        //! Increment for front facing triangles, decrement for back facing.
+        SO_INCREMENT_DECREMENT
+    };
+
+    //! Test applied to the stencil buffer by drawTriangles.
+    enum StencilTest
+    {
+        //! Stencil buffer is ignored.
+        ST_NONE,
+        //! Only pixels with a stencil value of 0xFF are drawn.
+        ST_EQUAL_FULL,
+        //! Only pixels with a non-zero stencil value are drawn.
+        ST_NOT_ZERO
+    };
+
+    //! Number of pixel rows in each band that triangles are rasterised in.
+    static const int TILE_HEIGHT;
+    /*!
+    \brief
+        Minimum number of pixels covered by the bounding boxes of the
+        triangles of a draw for its bands to be handed to the worker threads.
+        Smaller draws cost less to rasterise than to hand over.
+    */
+    static const int MIN_THREADED_PIXELS;
+
+    /*!
+    \brief
+        Create a rasteriser with one worker thread for each hardware thread
+        besides the calling one, up to a maximum of 7.
+    */
+    SoftwareRasteriser();
+    ~SoftwareRasteriser();
+
+    /*!
+    \brief
+        Set the number of worker threads that rasterise bands along with the
+        thread calling drawTriangles.  0 rasterises everything on the calling
+        thread.  This must not be called while a draw is in progress.
+    */
+    void setWorkerThreadCount(uint count);
+    //! Return the number of worker threads used to rasterise bands.
+    uint getWorkerThreadCount() const;
+
+    //! Set the texture subsequent triangles are rasterised into.
+    void setSurface(SoftwareTexture& surface);
+    /*!
+    \brief
+        Set the scissor rectangle, in pixels of the surface.  Passing 0
+        disables scissor clipping, leaving only the surface bounds.
+    */
+    void setClipRect(const Rectf* rect);
+    //! Set the texture sampled by textured vertices, or 0 for none.
+    void setTexture(const SoftwareTexture* texture);
+    //! Set the blend mode used to combine fragments with the surface.
+    void setBlendMode(BlendMode mode);
+    //! Set the alpha all fragments are multiplied with.
+    void setAlpha(float alpha);
+    //! Set the matrix vertex positions are transformed by.
+    void setTransform(const glm::mat4& transform);
+    //! Set the stencil test for subsequent drawTriangles calls.
+    void setStencilTest(StencilTest test);
+    //! Reset the stencil buffer of the current surface to zero.
+    void clearStencil();
+
+    /*!
+    \brief
+        Rasterise triangles into the surface.
+
+    \param vertex_data
+        Vertex data in the layout used by GeometryBuffer: position (3 floats),
+        colour (4 floats) and, if \a stride is 9, texture co-ordinates
+        (2 floats).
+
+    \param vertex_count
+        Number of vertices; every three form a triangle.
+
+    \param stride
+        Number of floats per vertex, either 7 or 9.
+    */
+    void drawTriangles(const float* vertex_data, uint vertex_count, int stride);
+
+    //! Rasterise triangles into the stencil buffer only.
+    void drawStencilTriangles(const float* vertex_data, uint vertex_count,
+                              int stride, StencilOperation op);
+
+protected:
+    //! Number of per-vertex attributes interpolated across a triangle.
+    static const int ATTRIBUTE_COUNT = 6;
+
+    //! Data calculated for a triangle before rasterising it.
+    struct Triangle
+    {
+        //! Edge functions: A * x + B * y + C is >= 0 inside the triangle.
+        float d_edgeA[3];
+        float d_edgeB[3];
+        float d_edgeC[3];
+        //! Whether pixels exactly on an edge belong to the triangle.
+        bool d_edgeInclusive[3];
+        //! Pixel bounds of the triangle, clipped to the scissor rectangle.
+        int d_minX, d_maxX, d_minY, d_maxY;
+        //! Attribute planes: value = dx * x + dy * y + c.
+        float d_attrDx[ATTRIBUTE_COUNT];
+        float d_attrDy[ATTRIBUTE_COUNT];
+        float d_attrC[ATTRIBUTE_COUNT];
+        //! Whether the vertex colours are all the same.
+        bool d_flatColour;
+        //! Whether the triangle has counter-clockwise winding on screen.
+        bool d_frontFacing;
+    };
+
+    //! Entry point of the worker threads; \a rasteriser is the owner.
+    static void workerThreadMain(void* rasteriser);
+    //! Wait for and rasterise the bands of draws until told to stop.
+    void runWorker();
+    //! Stop and destroy all worker threads.
+    void stopWorkers();
+    //! Rasterise bands of the current draw until none are left.
+    void rasteriseQueuedBands();
+    //! Rasterise the parts of all triangles of d_triangles within a band.
+    void rasteriseBand(int band_top, bool textured) const;
+    //! Recalculate the pixel scissor bounds from the surface and clip rect.
+    void updateClipBounds();
+    //! Transform and set up the triangles of vertex_data into d_triangles.
+    void setupTriangles(const float* vertex_data, uint vertex_count,
+                        int stride, bool textured);
+    //! Set up one triangle, returning false if it covers no pixels.
+    bool setupTriangle(const float* v0, const float* v1, const float* v2,
+                       bool textured, Triangle& tri) const;
+    //! Calculate the span of pixels of row y covered by tri.
+    static bool getSpan(const Triangle& tri, int y, int& x_start, int& x_end);
+    //! Fill a span of pixels of row y with fragments of tri.
+    void fillSpan(const Triangle& tri, int y, int x_start, int x_end,
+                  bool textured) const;
+    //! Fill a span with a single colour.
+    void fillSolidSpan(argb_t* dst, const uint8* stencil, int count,
+                       argb_t colour) const;
+    //! Fill a span with interpolated and / or textured colours.
+    template<bool Textured, bool Premultiplied>
+    void fillInterpolatedSpan(const Triangle& tri, argb_t* dst,
+                              const uint8* stencil, int x_start, int x_end,
+                              float py) const;
+    //! Return the bilinearly filtered colour of the texture at u, v.
+    argb_t sampleTexture(float u, float v) const;
+    //! Whether a pixel with the given stencil value passes the stencil test.
+    bool stencilPasses(uint8 value) const;
+    //! Blend colour \a src onto \a dst according to d_blendMode.
+    argb_t blend(argb_t src, argb_t dst) const;
+
+    //! Texture rasterised into.
+    SoftwareTexture* d_surface;
+    //! Scissor rectangle in pixels, inclusive.
+    int d_clipLeft, d_clipTop, d_clipRight, d_clipBottom;
+    //! Whether a scissor rectangle is set.
+    bool d_clippingActive;
+    //! Scissor rectangle as last set.
+    Rectf d_clipRect;
+    //! Texture sampled by textured vertices.
+    const SoftwareTexture* d_texture;
+    //! Blend mode in use.
+    BlendMode d_blendMode;
+    //! Alpha multiplied with all fragments.
+    float d_alpha;
+    //! Transformation applied to vertex positions.
+    glm::mat4 d_transform;
+    //! Stencil test in use.
+    StencilTest d_stencilTest;
+    //! Stencil values, one per pixel of the surface.
+    std::vector<uint8> d_stencil;
+    //! Triangles of the current draw call; kept to reuse the allocation.
+    std::vector<Triangle> d_triangles;
+
+    //! Worker threads rasterising bands.
+    std::vector<Thread*> d_workers;
+    //! Protects the members below, which describe the draw being shared out.
+    Mutex d_bandMutex;
+    //! Notified when a draw is ready for the workers, or they should stop.
+    Condition d_bandsQueued;
+    //! Notified when the last worker has finished with a draw.
+    Condition d_bandsDone;
+    //! Incremented for each draw handed to the workers.
+    uint d_drawSerial;
+    //! Top row of the next band to rasterise.
+    int d_nextBandTop;
+    //! Bottom row of the last band to rasterise.
+    int d_lastBandRow;
+    //! Whether the triangles being rasterised are textured.
+    bool d_bandsTextured;
+    //! Number of workers still working on the current draw.
+    uint d_busyWorkers;
+    //! Whether the workers should exit.
+    bool d_stopWorkers;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRasteriser_h_
@@ -0,0 +1,78 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderTarget_h_
+#define _CEGUISoftwareRenderTarget_h_
+
+#include "../../RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Intermediate RenderTarget that directs the owning SoftwareRenderer to
+    rasterise into a particular SoftwareTexture when activated.
+*/
+template<typename T = RenderTarget>
+class SOFTWARE_GUIRENDERER_API SoftwareRenderTarget : public T
+{
+public:
+    //! Constructor
+    SoftwareRenderTarget(SoftwareRenderer& owner, SoftwareTexture* surface = 0);
+
+    //! Destructor
+    virtual ~SoftwareRenderTarget();
+
+    // implement parts of CEGUI::RenderTarget interface
+    virtual void activate();
+    virtual void deactivate();
+    virtual void unprojectPoint(const GeometryBuffer& buff,
+                        const glm::vec2& p_in, glm::vec2& p_out) const;
+    virtual bool isImageryCache() const;
+    // implementing the virtual function with a covariant return type
+    virtual SoftwareRenderer& getOwner();
+
+protected:
+    //! SoftwareRenderer object that owns this RenderTarget
+    SoftwareRenderer& d_owner;
+    //! Texture that geometry drawn to this target is rasterised into.
+    SoftwareTexture* d_surface;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderTarget_h_
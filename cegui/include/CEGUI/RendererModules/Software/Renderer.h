@@ -0,0 +1,219 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderer_h_
+#define _CEGUISoftwareRenderer_h_
+
+#include "../../Renderer.h"
+#include "../../Size.h"
+#include "../../Vector.h"
+#include <vector>
+#include <map>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareGeometryBuffer;
+class SoftwareTexture;
+class SoftwareShaderWrapper;
+class SoftwareRasteriser;
+
+/*!
+\brief
+    CEGUI::Renderer implementation that rasterises all geometry on the CPU.
+
+    The default RenderTarget draws into a frame buffer held in main memory,
+    which the application can fetch via getFrameBuffer and present however
+    it likes (blit to a window, write to an image file, compare in a test,
+    etc.).  TextureTargets render into ordinary SoftwareTexture objects, so
+    their content can be drawn by other geometry as with any hardware
+    renderer.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates all the necessary objects
+        then initialises the CEGUI system with them.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param display_size
+        Size of the display area, and so of the frame buffer.
+
+    \param abi
+        This must be set to CEGUI_VERSION_ABI
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Sizef& display_size,
+                                             const int abi = CEGUI_VERSION_ABI);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a SoftwareRenderer object with a frame buffer of the given size.
+    */
+    static SoftwareRenderer& create(const Sizef& display_size,
+                                    const int abi = CEGUI_VERSION_ABI);
+
+    //! destory a SoftwareRenderer object.
+    static void destroy(SoftwareRenderer& renderer);
+
+    /*!
+    \brief
+        Return the texture holding the pixels of the default RenderTarget.
+
+        The frame buffer is not cleared by the renderer; call
+        SoftwareTexture::clear on it before rendering a frame if the GUI does
+        not cover the whole display.
+    */
+    SoftwareTexture& getFrameBuffer() const;
+
+    /*!
+    \brief
+        Set the surface that subsequently drawn geometry is rasterised into.
+        This is called by the RenderTarget implementations when activated.
+    */
+    void setActiveSurface(SoftwareTexture* surface);
+
+    //! Return the surface that geometry is currently rasterised into.
+    SoftwareTexture* getActiveSurface() const;
+
+    //! Return the rasteriser used to draw geometry for this renderer.
+    SoftwareRasteriser& getRasteriser() const;
+
+    // implement CEGUI::Renderer interface
+    RenderTarget& getDefaultRenderTarget();
+    RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const;
+    GeometryBuffer& createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial);
+    GeometryBuffer& createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial);
+    TextureTarget* createTextureTarget();
+    void destroyTextureTarget(TextureTarget* target);
+    void destroyAllTextureTargets();
+    Texture& createTexture(const String& name);
+    Texture& createTexture(const String& name,
+                           const String& filename,
+                           const String& resourceGroup);
+    Texture& createTexture(const String& name, const Sizef& size);
+    void destroyTexture(Texture& texture);
+    void destroyTexture(const String& name);
+    void destroyAllTextures();
+    Texture& getTexture(const String& name) const;
+    bool isTextureDefined(const String& name) const;
+    void beginRendering();
+    void endRendering();
+    void setDisplaySize(const Sizef& sz);
+    const Sizef& getDisplaySize() const;
+    const glm::vec2& getDisplayDPI() const;
+    uint getMaxTextureSize() const;
+    const String& getIdentifierString() const;
+
+protected:
+    //! constructor.
+    SoftwareRenderer(const Sizef& display_size);
+    //! destructor.
+    virtual ~SoftwareRenderer();
+
+    //! helper to throw exception if name is already used.
+    void throwIfNameExists(const String& name) const;
+    //! helper to safely log the creation of a named texture
+    static void logTextureCreation(const String& name);
+    //! helper to safely log the destruction of a named texture
+    static void logTextureDestruction(const String& name);
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Sizef d_displaySize;
+    //! What the renderer considers to be the current display DPI resolution.
+    glm::vec2 d_displayDPI;
+    //! Texture holding the pixels of the default RenderTarget.
+    SoftwareTexture* d_frameBuffer;
+    //! The default RenderTarget
+    RenderTarget* d_defaultTarget;
+    //! Surface that geometry is currently rasterised into.
+    SoftwareTexture* d_activeSurface;
+    //! Rasteriser shared by all geometry buffers.
+    SoftwareRasteriser* d_rasteriser;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold Textures we create.
+    typedef std::map<String, SoftwareTexture*, StringFastLessCompare> TextureMap;
+    //! Container used to track textures.
+    TextureMap d_textures;
+    //! What the renderer thinks the max texture size is.
+    uint d_maxTextureSize;
+    //! Shaderwrapper for textured & coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperTextured;
+    //! Shaderwrapper for coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperSolid;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderer_h_
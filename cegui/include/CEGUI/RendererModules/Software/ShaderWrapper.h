@@ -0,0 +1,64 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareShaderWrapper_h_
+#define _CEGUISoftwareShaderWrapper_h_
+
+#include "CEGUI/ShaderWrapper.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class ShaderParameterBindings;
+
+/*!
+\brief
+    ShaderWrapper for the SoftwareRenderer.  The fixed function pipeline of
+    SoftwareRasteriser is used for all geometry, so there is nothing to
+    prepare; the parameters are read directly by SoftwareGeometryBuffer.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareShaderWrapper : public ShaderWrapper
+{
+public:
+    SoftwareShaderWrapper();
+
+    ~SoftwareShaderWrapper();
+
+    //Implementation of ShaderWrapper interface
+    void prepareForRendering(const ShaderParameterBindings* shaderParameterBindings);
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
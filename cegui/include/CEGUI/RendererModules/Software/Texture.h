@@ -0,0 +1,124 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTexture_h_
+#define _CEGUISoftwareTexture_h_
+
+#include "../../Texture.h"
+#include "../../Colour.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of the CEGUI::Texture class that keeps its pixels in main
+    memory as 32 bit ARGB values, one per texel, in rows from top to bottom.
+
+    Data passed to loadFromMemory may be in PF_RGBA or PF_RGB format;
+    blitFromMemory and blitToMemory always work on PF_RGBA data.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    //! Return a pointer to the first pixel of the texture.
+    argb_t* getPixels();
+    //! Return a pointer to the first pixel of the texture.
+    const argb_t* getPixels() const;
+    //! Return the number of pixels in each row.
+    uint getPixelWidth() const;
+    //! Return the number of rows of pixels.
+    uint getPixelHeight() const;
+
+    /*!
+    \brief
+        Resize the texture.  The existing content is discarded and all pixels
+        are set to transparent black.
+    */
+    void resize(const Sizef& sz);
+
+    //! Set all pixels of the texture to \a colour.
+    void clear(argb_t colour = 0);
+
+    // implement CEGUI::Texture interface
+    const String& getName() const;
+    const Sizef& getSize() const;
+    const Sizef& getOriginalDataSize() const;
+    const glm::vec2& getTexelScaling() const;
+    void loadFromFile(const String& filename, const String& resourceGroup);
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format);
+    void blitFromMemory(const void* sourceData, const Rectf& area);
+    void blitToMemory(void* targetData);
+    bool isPixelFormatSupported(const PixelFormat fmt) const;
+
+protected:
+    // we all need a little help from out friends ;)
+    friend class SoftwareRenderer;
+
+    //! standard constructor
+    SoftwareTexture(const String& name);
+    //! construct texture via an image file.
+    SoftwareTexture(const String& name, const String& filename,
+                    const String& resourceGroup);
+    //! construct texture with a specified initial size.
+    SoftwareTexture(const String& name, const Sizef& sz);
+
+    //! destructor.
+    virtual ~SoftwareTexture();
+    //! updates cached scale value used to map pixels to texture co-ords.
+    void updateCachedScaleValues();
+
+    //! Pixel data of the texture.
+    std::vector<argb_t> d_pixels;
+    //! Number of pixels in each row.
+    uint d_pixelWidth;
+    //! Number of rows of pixels.
+    uint d_pixelHeight;
+    //! Size of the texture.
+    Sizef d_size;
+    //! original pixel of size data loaded into texture
+    Sizef d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    glm::vec2 d_texelScaling;
+    //! Name this texture was created with.
+    const String d_name;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTexture_h_
@@ -106,6 +106,21 @@ public:
     */
     virtual void unloadRawDataContainer(RawDataContainer&)  { }
 
+    /*!
+    \brief
+        Return whether loadRawDataContainer and unloadRawDataContainer may be
+        called from several threads at once, and at the same time as the
+        thread running the GUI.
+
+        This is used by AsyncSchemeLoader to decide whether files may be
+        loaded on its worker threads.  The default returns false; providers
+        that keep no shared state while loading override it.
+
+    \return
+        true if the provider is safe to use concurrently.
+    */
+    virtual bool isThreadSafe() const   { return false; }
+
     /*!
     \brief
         Return the current default resource group identifier.
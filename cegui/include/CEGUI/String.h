@@ -5588,6 +5588,923 @@ struct StringFastLessCompare
     }
 };
 
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8
+
+} // End of  CEGUI namespace section
+
+#include <iterator>
+#include <string>
+#include <iosfwd>
+
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#   define CEGUI_STRING_HAS_MOVE_SEMANTICS
+#endif
+
+// marks the operations that never throw, so that standard containers move
+// Strings rather than copy them when they grow.
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#   define CEGUI_STRING_NOEXCEPT noexcept
+#elif defined(_MSC_VER)
+#   define CEGUI_STRING_NOEXCEPT throw()
+#else
+#   define CEGUI_STRING_NOEXCEPT
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+
+/// encoded char signifies that it's a char (8bit) with encoding (in this case utf8)
+typedef utf8 encoded_char;
+
+//! Number of bytes (including the terminator) stored without a heap allocation
+#define CEGUI_STR_SMALL_BUFFER_SIZE 24
+
+/*!
+\brief
+    Compact String class used within the GUI system.
+
+    Like the utf32 based String, this class indexes and iterates over Unicode
+    code points, but the text is stored encoded as UTF-8.  Strings of up to
+    CEGUI_STR_SMALL_BUFFER_SIZE - 1 bytes are stored within the object itself,
+    so the short names used for windows, properties and events never allocate,
+    and c_str() returns the stored data without any conversion.
+
+    Access by code point index walks the encoded data from the closest of the
+    start, the end or the most recently accessed position, so sequential
+    access is constant time.  Strings containing only ASCII are indexed
+    directly.
+
+    Narrow strings (const char*, std::string) are interpreted as UTF-8.  Bytes
+    that do not form valid UTF-8 are taken as Latin-1 code points, which
+    matches how the utf32 based String treats narrow strings.
+
+    Sizes and indices are in code points, except for reserve() and capacity()
+    which are in encoded bytes.
+
+    A String must not be used by several threads at once, not even for
+    reading only: indexed access updates the cached position of the most
+    recent access (d_cacheIndex and d_cacheOffset).  Give each thread its own
+    copy instead.
+*/
+class CEGUIEXPORT String
+{
+public:
+    /*************************************************************************
+        Integral Types
+    *************************************************************************/
+    typedef utf32           value_type;         //!< Basic 'code point' type used for String (utf32)
+    typedef size_t          size_type;          //!< Unsigned type used for size values and indices
+    typedef std::ptrdiff_t  difference_type;    //!< Signed type used for differences
+    typedef utf32           const_reference;    //!< Code points are decoded, so are returned by value
+
+    static const size_type  npos;               //!< Value used to represent 'not found' conditions and 'all code points' etc.
+
+    /*************************************************************************
+        Iterator Classes
+    *************************************************************************/
+    /*!
+    \brief
+        Iterator over the code points of a String.  Since the code points are
+        decoded from the stored UTF-8, only read access is provided; modify the
+        String via its members instead.
+    */
+    class const_iterator :
+        public std::iterator<std::bidirectional_iterator_tag, utf32,
+                             std::ptrdiff_t, const utf32*, utf32>
+    {
+    public:
+        const_iterator() : d_ptr(0) {}
+        explicit const_iterator(const char* ptr) : d_ptr(ptr) {}
+
+        utf32 operator*() const
+        {
+            return String::decode(d_ptr);
+        }
+
+        const_iterator& operator++()
+        {
+            d_ptr += String::sequenceLength(*d_ptr);
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        const_iterator& operator--()
+        {
+            do
+                --d_ptr;
+            while (String::isContinuationByte(*d_ptr));
+
+            return *this;
+        }
+
+        const_iterator operator--(int)
+        {
+            const_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        bool operator==(const const_iterator& rhs) const
+        {
+            return d_ptr == rhs.d_ptr;
+        }
+
+        bool operator!=(const const_iterator& rhs) const
+        {
+            return d_ptr != rhs.d_ptr;
+        }
+
+        //! Return a pointer to the first UTF-8 byte of the current code point.
+        const char* getEncodedPtr() const
+        {
+            return d_ptr;
+        }
+
+    private:
+        const char* d_ptr;
+    };
+
+    //! Code points can not be modified through iterators, see const_iterator.
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    /*************************************************************************
+        Construction and Destruction
+    *************************************************************************/
+    //! Constructs an empty string
+    String()
+    {
+        init();
+    }
+
+    //! Copy constructor
+    String(const String& str)
+    {
+        init();
+        assignEncoded(str.d_buffer, str.d_length, str.d_cplength);
+    }
+
+    //! Constructs a string from the code points [str_idx, str_idx + str_num) of \a str
+    String(const String& str, size_type str_idx, size_type str_num = npos)
+    {
+        init();
+        assign(str, str_idx, str_num);
+    }
+
+    //! Constructs a string from the UTF-8 encoded std::string \a std_str
+    String(const std::string& std_str)
+    {
+        init();
+        assign(std_str);
+    }
+
+    //! Constructs a string from a sub-string of the UTF-8 encoded std::string \a std_str
+    String(const std::string& std_str, size_type str_idx, size_type str_num = npos)
+    {
+        init();
+        assign(std_str, str_idx, str_num);
+    }
+
+    //! Constructs a string from the null terminated UTF-8 data \a utf8_str
+    String(const utf8* utf8_str)
+    {
+        init();
+        assign(utf8_str);
+    }
+
+    //! Constructs a string from \a chars_len bytes of UTF-8 data
+    String(const utf8* utf8_str, size_type chars_len)
+    {
+        init();
+        assign(utf8_str, chars_len);
+    }
+
+    //! Constructs a string of \a num copies of \a code_point
+    String(size_type num, utf32 code_point)
+    {
+        init();
+        assign(num, code_point);
+    }
+
+    //! Constructs a string from the code points in the range [iter_beg, iter_end)
+    String(const_iterator iter_beg, const_iterator iter_end)
+    {
+        init();
+        append(iter_beg, iter_end);
+    }
+
+    //! Constructs a string from the null terminated UTF-8 data \a cstr
+    String(const char* cstr)
+    {
+        init();
+        assign(cstr);
+    }
+
+    //! Constructs a string from \a chars_len bytes of UTF-8 data
+    String(const char* chars, size_type chars_len)
+    {
+        init();
+        assign(chars, chars_len);
+    }
+
+#ifdef CEGUI_STRING_HAS_MOVE_SEMANTICS
+    //! Move constructor, \a str is left empty
+    String(String&& str) CEGUI_STRING_NOEXCEPT
+    {
+        if (str.d_buffer == str.d_smallBuffer)
+        {
+            d_buffer = d_smallBuffer;
+            std::memcpy(d_smallBuffer, str.d_smallBuffer, str.d_length + 1);
+        }
+        else
+            d_buffer = str.d_buffer;
+
+        d_length = str.d_length;
+        d_capacity = str.d_capacity;
+        d_cplength = str.d_cplength;
+        d_cacheIndex = str.d_cacheIndex;
+        d_cacheOffset = str.d_cacheOffset;
+
+        str.init();
+    }
+#endif
+
+    //! Destructor
+    ~String()
+    {
+        if (d_buffer != d_smallBuffer)
+            delete[] d_buffer;
+    }
+
+    /*************************************************************************
+        Size operations
+    *************************************************************************/
+    //! Returns the size of the String in code points
+    size_type size() const
+    {
+        return d_cplength;
+    }
+
+    //! Returns the size of the String in code points
+    size_type length() const
+    {
+        return d_cplength;
+    }
+
+    //! Returns true if the String is empty
+    bool empty() const
+    {
+        return d_cplength == 0;
+    }
+
+    //! Returns the maximum size of a String
+    static size_type max_size()
+    {
+        return (npos >> 1) - 1;
+    }
+
+    //! Returns the number of bytes that can be stored without a reallocation
+    size_type capacity() const
+    {
+        return d_capacity;
+    }
+
+    //! Ensures that at least \a num bytes can be stored without a reallocation
+    void reserve(size_type num = 0);
+
+    //! Releases unused heap memory, moving to the inline buffer if possible
+    void shrink_to_fit();
+
+    /*************************************************************************
+        Comparisons
+    *************************************************************************/
+    //! Compares code point by code point.  Returns 0 if equal, < 0 if less and > 0 if greater.
+    int compare(const String& str) const
+    {
+        return compareEncoded(d_buffer, d_length, str.d_buffer, str.d_length);
+    }
+
+    //! Compares the code points [idx, idx + len) with [str_idx, str_idx + str_len) of \a str
+    int compare(size_type idx, size_type len, const String& str,
+                size_type str_idx = 0, size_type str_len = npos) const;
+
+    //! Compares with the UTF-8 encoded std::string \a std_str
+    int compare(const std::string& std_str) const
+    {
+        return compareRaw(std_str.data(), std_str.size());
+    }
+
+    //! Compares with the null terminated UTF-8 data \a utf8_str
+    int compare(const utf8* utf8_str) const
+    {
+        return compare(reinterpret_cast<const char*>(utf8_str));
+    }
+
+    //! Compares with the null terminated UTF-8 data \a cstr
+    int compare(const char* cstr) const
+    {
+        return compareRaw(cstr, std::strlen(cstr));
+    }
+
+    //! Compares the code points [idx, idx + len) with \a cstr
+    int compare(size_type idx, size_type len, const char* cstr) const
+    {
+        return compare(idx, len, String(cstr));
+    }
+
+    /*************************************************************************
+        Character access
+    *************************************************************************/
+    //! Returns the code point at index \a idx, which must be valid
+    utf32 operator[](size_type idx) const
+    {
+        return decode(d_buffer + getEncodedOffset(idx));
+    }
+
+    //! Returns the code point at index \a idx, throws std::out_of_range if it is invalid
+    utf32 at(size_type idx) const;
+
+    /*************************************************************************
+        C-Strings and arrays
+    *************************************************************************/
+    //! Returns the null terminated UTF-8 encoded contents of the String
+    const char* c_str() const
+    {
+        return d_buffer;
+    }
+
+    //! Returns the null terminated UTF-8 encoded contents of the String
+    const utf8* data() const
+    {
+        return reinterpret_cast<const utf8*>(d_buffer);
+    }
+
+    //! Returns the length of c_str() in bytes, not including the terminator
+    size_type utf8_length() const
+    {
+        return d_length;
+    }
+
+    /*************************************************************************
+        Assignment Functions
+    *************************************************************************/
+    String& operator=(const String& str)
+    {
+        if (this != &str)
+            assignEncoded(str.d_buffer, str.d_length, str.d_cplength);
+
+        return *this;
+    }
+
+#ifdef CEGUI_STRING_HAS_MOVE_SEMANTICS
+    //! Move assignment, \a str is left with unspecified but valid contents
+    String& operator=(String&& str) CEGUI_STRING_NOEXCEPT
+    {
+        swap(str);
+        return *this;
+    }
+#endif
+
+    String& operator=(const std::string& std_str)
+    {
+        return assign(std_str);
+    }
+
+    String& operator=(const utf8* utf8_str)
+    {
+        return assign(utf8_str);
+    }
+
+    String& operator=(const char* cstr)
+    {
+        return assign(cstr);
+    }
+
+    String& operator=(utf32 code_point)
+    {
+        return assign(1, code_point);
+    }
+
+    String& assign(const String& str, size_type str_idx = 0, size_type str_num = npos);
+
+    String& assign(const std::string& std_str, size_type str_idx = 0, size_type str_num = npos);
+
+    String& assign(const utf8* utf8_str)
+    {
+        return assign(reinterpret_cast<const char*>(utf8_str));
+    }
+
+    String& assign(const utf8* utf8_str, size_type str_num)
+    {
+        return assign(reinterpret_cast<const char*>(utf8_str), str_num);
+    }
+
+    String& assign(size_type num, utf32 code_point)
+    {
+        clear();
+        return append(num, code_point);
+    }
+
+    String& assign(const char* cstr)
+    {
+        return assign(cstr, std::strlen(cstr));
+    }
+
+    String& assign(const char* chars, size_type chars_len)
+    {
+        return replaceRaw(0, d_length, chars, chars_len);
+    }
+
+    //! Swaps the contents of this String with \a str
+    void swap(String& str) CEGUI_STRING_NOEXCEPT;
+
+    /*************************************************************************
+        Appending Functions
+    *************************************************************************/
+    String& operator+=(const String& str)
+    {
+        return append(str);
+    }
+
+    String& operator+=(const std::string& std_str)
+    {
+        return append(std_str);
+    }
+
+    String& operator+=(const utf8* utf8_str)
+    {
+        return append(utf8_str);
+    }
+
+    String& operator+=(const char* cstr)
+    {
+        return append(cstr);
+    }
+
+    String& operator+=(utf32 code_point)
+    {
+        push_back(code_point);
+        return *this;
+    }
+
+    String& append(const String& str)
+    {
+        return replaceEncoded(d_length, 0, 0, str.d_buffer, str.d_length, str.d_cplength);
+    }
+
+    String& append(const String& str, size_type str_idx, size_type str_num = npos)
+    {
+        return replace(d_cplength, 0, str, str_idx, str_num);
+    }
+
+    String& append(const std::string& std_str, size_type str_idx = 0, size_type str_num = npos)
+    {
+        return replace(d_cplength, 0, String(std_str), str_idx, str_num);
+    }
+
+    String& append(const utf8* utf8_str)
+    {
+        return append(reinterpret_cast<const char*>(utf8_str));
+    }
+
+    String& append(const utf8* utf8_str, size_type len)
+    {
+        return append(reinterpret_cast<const char*>(utf8_str), len);
+    }
+
+    String& append(size_type num, utf32 code_point);
+
+    String& append(const_iterator iter_beg, const_iterator iter_end);
+
+    String& append(const char* cstr)
+    {
+        return append(cstr, std::strlen(cstr));
+    }
+
+    String& append(const char* chars, size_type chars_len)
+    {
+        return replaceRaw(d_length, 0, chars, chars_len);
+    }
+
+    void push_back(utf32 code_point)
+    {
+        append(1, code_point);
+    }
+
+    //! Removes the last code point of the String, which must not be empty
+    void pop_back()
+    {
+        erase(d_cplength - 1, 1);
+    }
+
+    /*************************************************************************
+        Insertion Functions
+    *************************************************************************/
+    String& insert(size_type idx, const String& str)
+    {
+        return replace(idx, 0, str);
+    }
+
+    String& insert(size_type idx, const String& str, size_type str_idx, size_type str_num)
+    {
+        return replace(idx, 0, str, str_idx, str_num);
+    }
+
+    String& insert(size_type idx, const std::string& std_str)
+    {
+        return replace(idx, 0, String(std_str));
+    }
+
+    String& insert(size_type idx, const utf8* utf8_str)
+    {
+        return replace(idx, 0, String(utf8_str));
+    }
+
+    String& insert(size_type idx, const utf8* utf8_str, size_type len)
+    {
+        return replace(idx, 0, String(utf8_str, len));
+    }
+
+    String& insert(size_type idx, size_type num, utf32 code_point)
+    {
+        return replace(idx, 0, String(num, code_point));
+    }
+
+    String& insert(size_type idx, const char* cstr)
+    {
+        return replace(idx, 0, String(cstr));
+    }
+
+    String& insert(size_type idx, const char* chars, size_type chars_len)
+    {
+        return replace(idx, 0, String(chars, chars_len));
+    }
+
+    //! Inserts \a code_point before \a pos, returning an iterator to the inserted code point
+    iterator insert(iterator pos, utf32 code_point);
+
+    void insert(iterator pos, size_type num, utf32 code_point)
+    {
+        insert(getIteratorIndex(pos), num, code_point);
+    }
+
+    /*************************************************************************
+        Erasing characters
+    *************************************************************************/
+    //! Removes all data from the String
+    void clear()
+    {
+        setLength(0, 0);
+        d_cacheIndex = 0;
+        d_cacheOffset = 0;
+    }
+
+    String& erase()
+    {
+        clear();
+        return *this;
+    }
+
+    //! Erases \a len code points starting at \a idx
+    String& erase(size_type idx, size_type len = npos)
+    {
+        return replace(idx, len, String());
+    }
+
+    String& erase(iterator pos)
+    {
+        return erase(getIteratorIndex(pos), 1);
+    }
+
+    String& erase(iterator iter_beg, iterator iter_end);
+
+    /*************************************************************************
+        Resizing
+    *************************************************************************/
+    //! Resizes the String to \a num code points, appending \a code_point as required
+    void resize(size_type num, utf32 code_point = 0);
+
+    /*************************************************************************
+        Replacing Characters
+    *************************************************************************/
+    //! Replaces the code points [idx, idx + len) with [str_idx, str_idx + str_num) of \a str
+    String& replace(size_type idx, size_type len, const String& str,
+                    size_type str_idx = 0, size_type str_num = npos);
+
+    String& replace(size_type idx, size_type len, const std::string& std_str)
+    {
+        return replace(idx, len, String(std_str));
+    }
+
+    String& replace(size_type idx, size_type len, const utf8* utf8_str)
+    {
+        return replace(idx, len, String(utf8_str));
+    }
+
+    String& replace(size_type idx, size_type len, const char* cstr)
+    {
+        return replace(idx, len, String(cstr));
+    }
+
+    String& replace(size_type idx, size_type len, size_type num, utf32 code_point)
+    {
+        return replace(idx, len, String(num, code_point));
+    }
+
+    String& replace(iterator iter_beg, iterator iter_end, const String& str);
+
+    /*************************************************************************
+        Find a code point
+    *************************************************************************/
+    //! Returns the index of the first occurrence of \a code_point at or after \a idx, or npos
+    size_type find(utf32 code_point, size_type idx = 0) const;
+
+    //! Returns the index of the last occurrence of \a code_point at or before \a idx, or npos
+    size_type rfind(utf32 code_point, size_type idx = npos) const;
+
+    /*************************************************************************
+        Find a substring
+    *************************************************************************/
+    //! Returns the index of the first occurrence of \a str at or after \a idx, or npos
+    size_type find(const String& str, size_type idx = 0) const;
+
+    //! Returns the index of the last occurrence of \a str starting at or before \a idx, or npos
+    size_type rfind(const String& str, size_type idx = npos) const;
+
+    /*************************************************************************
+        Find first of different code points
+    *************************************************************************/
+    size_type find_first_of(const String& str, size_type idx = 0) const;
+    size_type find_first_not_of(const String& str, size_type idx = 0) const;
+
+    size_type find_first_of(utf32 code_point, size_type idx = 0) const
+    {
+        return find(code_point, idx);
+    }
+
+    size_type find_first_not_of(utf32 code_point, size_type idx = 0) const
+    {
+        return find_first_not_of(String(1, code_point), idx);
+    }
+
+    /*************************************************************************
+        Find last of different code points
+    *************************************************************************/
+    size_type find_last_of(const String& str, size_type idx = npos) const;
+    size_type find_last_not_of(const String& str, size_type idx = npos) const;
+
+    size_type find_last_of(utf32 code_point, size_type idx = npos) const
+    {
+        return rfind(code_point, idx);
+    }
+
+    size_type find_last_not_of(utf32 code_point, size_type idx = npos) const
+    {
+        return find_last_not_of(String(1, code_point), idx);
+    }
+
+    /*************************************************************************
+        Substring
+    *************************************************************************/
+    //! Returns the code points [idx, idx + len) as a new String
+    String substr(size_type idx = 0, size_type len = npos) const;
+
+    /*************************************************************************
+        Iterator creation
+    *************************************************************************/
+    const_iterator begin() const
+    {
+        return const_iterator(d_buffer);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(d_buffer + d_length);
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /*************************************************************************
+        UTF-8 helpers
+    *************************************************************************/
+    //! Returns the number of bytes of the UTF-8 sequence starting with \a lead
+    static size_type sequenceLength(char lead)
+    {
+        const utf8 c = static_cast<utf8>(lead);
+        return c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    }
+
+    //! Returns whether \a c is a UTF-8 continuation byte
+    static bool isContinuationByte(char c)
+    {
+        return (static_cast<utf8>(c) & 0xC0) == 0x80;
+    }
+
+    //! Decodes the code point of the valid UTF-8 sequence at \a ptr
+    static utf32 decode(const char* ptr);
+
+    //! Encodes \a code_point as UTF-8 into \a dest, returning the number of bytes written (1 - 4)
+    static size_type encode(utf32 code_point, char* dest);
+
+private:
+    //! Sets up an empty String using the inline buffer
+    void init()
+    {
+        d_buffer = d_smallBuffer;
+        d_length = 0;
+        d_capacity = CEGUI_STR_SMALL_BUFFER_SIZE - 1;
+        d_cplength = 0;
+        d_cacheIndex = 0;
+        d_cacheOffset = 0;
+        d_smallBuffer[0] = 0;
+    }
+
+    //! Sets the byte and code point lengths, terminating the data
+    void setLength(size_type length, size_type cplength)
+    {
+        d_length = length;
+        d_cplength = cplength;
+        d_buffer[length] = 0;
+    }
+
+    //! Replaces the contents with already validated UTF-8 data
+    void assignEncoded(const char* data, size_type length, size_type cplength)
+    {
+        // short strings are copied inline, avoiding the general replace
+        if (length <= d_capacity && (data >= d_buffer + d_length || data + length <= d_buffer))
+        {
+            std::memcpy(d_buffer, data, length);
+            setLength(length, cplength);
+            d_cacheIndex = 0;
+            d_cacheOffset = 0;
+        }
+        else
+            replaceEncoded(0, d_length, d_cplength, data, length, cplength);
+    }
+
+    //! Replaces the bytes [offset, offset + length), holding \a cplength code points, with validated UTF-8 data
+    String& replaceEncoded(size_type offset, size_type length, size_type cplength,
+                           const char* data, size_type data_length,
+                           size_type data_cplength);
+
+    //! Replaces the bytes [offset, offset + length) with narrow data, validating it
+    String& replaceRaw(size_type offset, size_type length,
+                       const char* chars, size_type chars_len);
+
+    //! Returns the byte offset of the code point at \a idx (or d_length if past the end)
+    size_type getEncodedOffset(size_type idx) const;
+
+    //! Returns the code point index of the code point starting at byte \a offset
+    size_type getCodePointIndex(size_type offset) const;
+
+    //! Returns the code point index of \a iter
+    size_type getIteratorIndex(const_iterator iter) const
+    {
+        return getCodePointIndex(iter.getEncodedPtr() - d_buffer);
+    }
+
+    //! Compares narrow, possibly invalid UTF-8 data with this String
+    int compareRaw(const char* chars, size_type chars_len) const;
+
+    //! Compares two valid UTF-8 strings
+    static int compareEncoded(const char* a, size_type a_len,
+                              const char* b, size_type b_len);
+
+    /*************************************************************************
+        Implementation data
+    *************************************************************************/
+    char*       d_buffer;       //!< Null terminated UTF-8 data, either d_smallBuffer or on the heap.
+    size_type   d_length;       //!< Length of the data in bytes (not including null termination)
+    size_type   d_capacity;     //!< Number of bytes d_buffer can hold (not including null termination)
+    size_type   d_cplength;     //!< Length of the string in code points
+
+    mutable size_type d_cacheIndex;     //!< Code point index of the most recent indexed access
+    mutable size_type d_cacheOffset;    //!< Byte offset of the most recent indexed access
+
+    char        d_smallBuffer[CEGUI_STR_SMALL_BUFFER_SIZE]; //!< Inline storage for short strings
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Comparison operators
+//////////////////////////////////////////////////////////////////////////
+bool CEGUIEXPORT operator==(const String& str1, const String& str2);
+bool CEGUIEXPORT operator==(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator==(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator==(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator==(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator==(const String& str, const char* c_str);
+bool CEGUIEXPORT operator==(const char* c_str, const String& str);
+
+bool CEGUIEXPORT operator!=(const String& str1, const String& str2);
+bool CEGUIEXPORT operator!=(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator!=(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator!=(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator!=(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator!=(const String& str, const char* c_str);
+bool CEGUIEXPORT operator!=(const char* c_str, const String& str);
+
+bool CEGUIEXPORT operator<(const String& str1, const String& str2);
+bool CEGUIEXPORT operator<(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator<(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator<(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator<(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator<(const String& str, const char* c_str);
+bool CEGUIEXPORT operator<(const char* c_str, const String& str);
+
+bool CEGUIEXPORT operator>(const String& str1, const String& str2);
+bool CEGUIEXPORT operator>(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator>(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator>(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator>(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator>(const String& str, const char* c_str);
+bool CEGUIEXPORT operator>(const char* c_str, const String& str);
+
+bool CEGUIEXPORT operator<=(const String& str1, const String& str2);
+bool CEGUIEXPORT operator<=(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator<=(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator<=(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator<=(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator<=(const String& str, const char* c_str);
+bool CEGUIEXPORT operator<=(const char* c_str, const String& str);
+
+bool CEGUIEXPORT operator>=(const String& str1, const String& str2);
+bool CEGUIEXPORT operator>=(const String& str, const std::string& std_str);
+bool CEGUIEXPORT operator>=(const std::string& std_str, const String& str);
+bool CEGUIEXPORT operator>=(const String& str, const utf8* utf8_str);
+bool CEGUIEXPORT operator>=(const utf8* utf8_str, const String& str);
+bool CEGUIEXPORT operator>=(const String& str, const char* c_str);
+bool CEGUIEXPORT operator>=(const char* c_str, const String& str);
+
+//////////////////////////////////////////////////////////////////////////
+// Concatenation operator functions
+//////////////////////////////////////////////////////////////////////////
+String CEGUIEXPORT operator+(const String& str1, const String& str2);
+String CEGUIEXPORT operator+(const String& str, const std::string& std_str);
+String CEGUIEXPORT operator+(const std::string& std_str, const String& str);
+String CEGUIEXPORT operator+(const String& str, const utf8* utf8_str);
+String CEGUIEXPORT operator+(const utf8* utf8_str, const String& str);
+String CEGUIEXPORT operator+(const String& str, utf32 code_point);
+String CEGUIEXPORT operator+(utf32 code_point, const String& str);
+String CEGUIEXPORT operator+(const String& str, const char* c_str);
+String CEGUIEXPORT operator+(const char* c_str, const String& str);
+
+#ifdef CEGUI_STRING_HAS_MOVE_SEMANTICS
+// Appending to a temporary reuses its buffer, so chained concatenations
+// only allocate when the capacity of the first temporary is exceeded.
+String CEGUIEXPORT operator+(String&& str1, const String& str2);
+String CEGUIEXPORT operator+(String&& str, const char* c_str);
+String CEGUIEXPORT operator+(String&& str, utf32 code_point);
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Output (stream) functions
+//////////////////////////////////////////////////////////////////////////
+CEGUIEXPORT std::ostream& operator<<(std::ostream& s, const String& str);
+
+//////////////////////////////////////////////////////////////////////////
+// Modifying operations
+//////////////////////////////////////////////////////////////////////////
+//! Swap the contents of two String objects
+void CEGUIEXPORT swap(String& str1, String& str2);
+
+/*!
+\brief
+    Functor that can be used as comparator in a std::map with String keys.
+    It's faster than using the default, but the map will no longer be sorted alphabetically.
+*/
+struct StringFastLessCompare
+{
+    bool operator() (const String& a, const String& b) const
+    {
+        const size_t la = a.utf8_length();
+        const size_t lb = b.utf8_length();
+        if (la == lb)
+            return (memcmp(a.c_str(), b.c_str(), la) < 0);
+
+        return (la < lb);
+    }
+};
+
+#if defined(_MSC_VER)
+#	pragma warning(disable : 4251)
+#endif
+
 #else
 
 /// encoded char signifies that it's a char (8bit) with encoding (in this case ASCII)
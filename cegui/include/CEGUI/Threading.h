@@ -0,0 +1,165 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIThreading_h_
+#define _CEGUIThreading_h_
+
+#include "CEGUI/Base.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Minimal portable threading primitives used internally by the library,
+    implemented over pthreads or the Win32 API.
+*/
+class CEGUIEXPORT Mutex
+{
+public:
+    Mutex();
+    ~Mutex();
+
+    void lock();
+    void unlock();
+
+private:
+    friend class Condition;
+
+    Mutex(const Mutex&);
+    Mutex& operator=(const Mutex&);
+
+    //! Platform specific mutex object.
+    void* d_impl;
+};
+
+/*!
+\brief
+    Locks a Mutex for the lifetime of the MutexLock object.
+*/
+class CEGUIEXPORT MutexLock
+{
+public:
+    explicit MutexLock(Mutex& mutex) :
+        d_mutex(mutex)
+    {
+        d_mutex.lock();
+    }
+
+    ~MutexLock()
+    {
+        d_mutex.unlock();
+    }
+
+private:
+    MutexLock(const MutexLock&);
+    MutexLock& operator=(const MutexLock&);
+
+    Mutex& d_mutex;
+};
+
+/*!
+\brief
+    Condition variable used together with a Mutex.
+*/
+class CEGUIEXPORT Condition
+{
+public:
+    Condition();
+    ~Condition();
+
+    /*!
+    \brief
+        Atomically release \a mutex, which must be locked by the calling
+        thread, and wait until notified.  \a mutex is locked again on return.
+        As with all condition variables, wake ups may be spurious, so the
+        awaited state must be checked again in a loop.
+    */
+    void wait(Mutex& mutex);
+
+    //! Wake one thread waiting on this condition.
+    void notifyOne();
+
+    //! Wake all threads waiting on this condition.
+    void notifyAll();
+
+private:
+    Condition(const Condition&);
+    Condition& operator=(const Condition&);
+
+    //! Platform specific condition variable object.
+    void* d_impl;
+};
+
+/*!
+\brief
+    A thread of execution running a function.  The thread is started on
+    construction; destroying the Thread object waits for it to finish.
+*/
+class CEGUIEXPORT Thread
+{
+public:
+    //! Signature of the function run by a thread.
+    typedef void (*Function)(void* userData);
+
+    /*!
+    \brief
+        Start a new thread running \a function with \a userData.
+
+    \exception GenericException
+        thrown if the thread could not be created.
+    */
+    Thread(Function function, void* userData);
+    ~Thread();
+
+    //! Wait for the thread function to return.
+    void join();
+
+    //! Return the number of hardware threads available, at least 1.
+    static uint getHardwareConcurrency();
+
+private:
+    Thread(const Thread&);
+    Thread& operator=(const Thread&);
+
+    //! Platform specific thread handle.
+    void* d_impl;
+    //! Function run by the thread.
+    Function d_function;
+    //! Data passed to d_function.
+    void* d_userData;
+    //! Whether join has been called.
+    bool d_joined;
+
+#if defined(__WIN32__) || defined(_WIN32)
+    static unsigned __stdcall threadEntry(void* thread);
+#else
+    static void* threadEntry(void* thread);
+#endif
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIThreading_h_
@@ -32,6 +32,7 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/TypedProperty.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -57,6 +58,118 @@ private:
     const String d_type;
 };
 
+/*!
+ \brief Caches the native value converted from the String it was last given
+
+ Keyframe values and saved base values rarely change while an animation runs,
+ so this avoids converting them from String on every step.
+ */
+template<typename T>
+class TplNativeValueCache
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    TplNativeValueCache():
+        d_value(),
+        d_valid(false)
+    {}
+
+    //! returns the native value of \a source, converting it only if it changed
+    const T& get(const String& source)
+    {
+        if (!d_valid || source != d_source)
+        {
+            d_value = Helper::fromString(source);
+            d_source = source;
+            d_valid = true;
+        }
+
+        return d_value;
+    }
+
+private:
+    String d_source;
+    T d_value;
+    bool d_valid;
+};
+
+/*!
+ \brief Generic native applier class
+
+ Sets the values computed by the static native functions of \a Interp
+ (absolute, relative and relativeMultiply) directly on a TypedProperty<T>.
+ */
+template<typename T, typename Interp>
+class TplNativeApplier : public Interpolator::NativeApplier
+{
+public:
+    TplNativeApplier(PropertyReceiver* receiver, TypedProperty<T>* property):
+        d_receiver(receiver),
+        d_property(property)
+    {}
+
+    //! destructor
+    virtual ~TplNativeApplier() {}
+
+    //! \copydoc Interpolator::NativeApplier::applyAbsolute
+    virtual void applyAbsolute(const String& value1,
+                               const String& value2,
+                               float position)
+    {
+        d_property->setNative(d_receiver,
+            Interp::absolute(d_value1.get(value1), d_value2.get(value2), position));
+    }
+
+    //! \copydoc Interpolator::NativeApplier::applyRelative
+    virtual void applyRelative(const String& base,
+                               const String& value1,
+                               const String& value2,
+                               float position)
+    {
+        d_property->setNative(d_receiver,
+            Interp::relative(d_base.get(base),
+                             d_value1.get(value1), d_value2.get(value2), position));
+    }
+
+    //! \copydoc Interpolator::NativeApplier::applyRelativeMultiply
+    virtual void applyRelativeMultiply(const String& base,
+                                       const String& value1,
+                                       const String& value2,
+                                       float position)
+    {
+        d_property->setNative(d_receiver,
+            Interp::relativeMultiply(d_base.get(base),
+                                     d_multiplier1.get(value1),
+                                     d_multiplier2.get(value2), position));
+    }
+
+    /*!
+    \brief
+        Creates a TplNativeApplier for \a property if it is a TypedProperty<T>
+
+    \return
+        The new applier or 0 if \a property is of a different type
+    */
+    static Interpolator::NativeApplier* create(PropertyReceiver* receiver,
+                                               Property* property)
+    {
+        TypedProperty<T>* const typed = dynamic_cast<TypedProperty<T>*>(property);
+
+        return typed ? new TplNativeApplier(receiver, typed) : 0;
+    }
+
+private:
+    PropertyReceiver* d_receiver;
+    TypedProperty<T>* d_property;
+
+    TplNativeValueCache<T> d_base;
+    TplNativeValueCache<T> d_value1;
+    TplNativeValueCache<T> d_value2;
+    TplNativeValueCache<float> d_multiplier1;
+    TplNativeValueCache<float> d_multiplier2;
+};
+
 /*!
  \brief Generic linear interpolator class
  
@@ -76,17 +189,34 @@ public:
     //! destructor
     virtual ~TplLinearInterpolator() {}
     
+    //! native equivalent of interpolateAbsolute
+    static T absolute(const T& val1, const T& val2, float position)
+    {
+        return static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
+    }
+
+    //! native equivalent of interpolateRelative
+    static T relative(const T& bas, const T& val1, const T& val2, float position)
+    {
+        return static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+    }
+
+    //! native equivalent of interpolateRelativeMultiply
+    static T relativeMultiply(const T& bas, float val1, float val2, float position)
+    {
+        const float mul = val1 * (1.0f - position) + val2 * (position);
+
+        return static_cast<const T>(bas * mul);
+    }
+
     //! \copydoc Interpolator::interpolateAbsolute
     virtual String interpolateAbsolute(const String& value1,
                                        const String& value2,
                                        float position)
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
-
-        return Helper::toString(result);
+        return Helper::toString(absolute(Helper::fromString(value1),
+                                         Helper::fromString(value2),
+                                         position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
@@ -95,13 +225,10 @@ public:
                                        const String& value2,
                                        float position)
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        const T result = static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
-
-        return Helper::toString(result);
+        return Helper::toString(relative(Helper::fromString(base),
+                                         Helper::fromString(value1),
+                                         Helper::fromString(value2),
+                                         position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
@@ -110,15 +237,17 @@ public:
                                                const String& value2,
                                                float position)
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename PropertyHelper<float>::return_type val1 = PropertyHelper<float>::fromString(value1);
-        typename PropertyHelper<float>::return_type val2 = PropertyHelper<float>::fromString(value2);
-
-        const float mul = val1 * (1.0f - position) + val2 * (position);
-
-        const T result = static_cast<const T>(bas * mul);
+        return Helper::toString(relativeMultiply(Helper::fromString(base),
+                                                 PropertyHelper<float>::fromString(value1),
+                                                 PropertyHelper<float>::fromString(value2),
+                                                 position));
+    }
 
-        return Helper::toString(result);
+    //! \copydoc Interpolator::createNativeApplier
+    virtual NativeApplier* createNativeApplier(PropertyReceiver* receiver,
+                                               Property* property)
+    {
+        return TplNativeApplier<T, TplLinearInterpolator<T> >::create(receiver, property);
     }
 };
 
@@ -142,17 +271,33 @@ public:
     //! destructor
     virtual ~TplDiscreteInterpolator() {}
     
+    //! native equivalent of interpolateAbsolute
+    static T absolute(const T& val1, const T& val2, float position)
+    {
+        return position < 0.5 ? val1 : val2;
+    }
+
+    //! native equivalent of interpolateRelative
+    static T relative(const T& /*bas*/, const T& val1, const T& val2, float position)
+    {
+        return position < 0.5 ? val1 : val2;
+    }
+
+    //! native equivalent of interpolateRelativeMultiply
+    static T relativeMultiply(const T& bas, float /*val1*/, float /*val2*/, float /*position*/)
+    {
+        // there is nothing we can do, we have no idea what operators T has overloaded
+        return bas;
+    }
+
     //! \copydoc Interpolator::interpolateAbsolute
     virtual String interpolateAbsolute(const String& value1,
                                        const String& value2,
                                        float position)
     {
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;;
-
-        return Helper::toString(result);
+        return Helper::toString(absolute(Helper::fromString(value1),
+                                         Helper::fromString(value2),
+                                         position));
     }
     
     //! \copydoc Interpolator::interpolateRelative
@@ -161,13 +306,9 @@ public:
                                        const String& value2,
                                        float position)
     {
-        //typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = position < 0.5 ? val1 : val2;
-        
-        return Helper::toString(result);
+        return Helper::toString(absolute(Helper::fromString(value1),
+                                         Helper::fromString(value2),
+                                         position));
     }
     
     //! \copydoc Interpolator::interpolateRelativeMultiply
@@ -176,14 +317,14 @@ public:
                                                const String& /*value2*/,
                                                float /*position*/)
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        /*const float val1 = PropertyHelper<float>::fromString(value1);
-        const float val2 = PropertyHelper<float>::fromString(value2);
-
-        const float mul = val1 * (1.0f - position) + val2 * (position);*/
+        return Helper::toString(Helper::fromString(base));
+    }
 
-        // there is nothing we can do, we have no idea what operators T has overloaded
-        return Helper::toString(bas);
+    //! \copydoc Interpolator::createNativeApplier
+    virtual NativeApplier* createNativeApplier(PropertyReceiver* receiver,
+                                               Property* property)
+    {
+        return TplNativeApplier<T, TplDiscreteInterpolator<T> >::create(receiver, property);
     }
 };
 
@@ -200,6 +341,7 @@ class TplDiscreteRelativeInterpolator : public TplDiscreteInterpolator<T>
 {
 public:
     typedef PropertyHelper<T> Helper;
+    typedef Interpolator::NativeApplier NativeApplier;
     
     TplDiscreteRelativeInterpolator(const String& type):
         TplDiscreteInterpolator<T>(type)
@@ -208,19 +350,29 @@ public:
     //! destructor
     virtual ~TplDiscreteRelativeInterpolator() {}
     
+    //! native equivalent of interpolateRelative
+    static T relative(const T& bas, const T& val1, const T& val2, float position)
+    {
+        return bas + (position < 0.5 ? val1 : val2);
+    }
+
     //! \copydoc Interpolator::interpolateRelative
     virtual String interpolateRelative(const String& base,
                                        const String& value1,
                                        const String& value2,
                                        float position)
     {
-        typename Helper::return_type bas = Helper::fromString(base);
-        typename Helper::return_type val1 = Helper::fromString(value1);
-        typename Helper::return_type val2 = Helper::fromString(value2);
-        
-        typename Helper::return_type result = bas + (position < 0.5 ? val1 : val2);
-        
-        return Helper::toString(result);
+        return Helper::toString(relative(Helper::fromString(base),
+                                         Helper::fromString(value1),
+                                         Helper::fromString(value2),
+                                         position));
+    }
+
+    //! \copydoc Interpolator::createNativeApplier
+    virtual NativeApplier* createNativeApplier(PropertyReceiver* receiver,
+                                               Property* property)
+    {
+        return TplNativeApplier<T, TplDiscreteRelativeInterpolator<T> >::create(receiver, property);
     }
 };
 
@@ -136,6 +136,20 @@ public:
 
     UndoAction getLastAction();
 
+    /*!
+    \brief
+        Return the action that the next call to undo will revert.  Only valid
+        when canUndo returns true.
+    */
+    UndoAction getUndoAction();
+
+    /*!
+    \brief
+        Return the action that the next call to redo will reapply.  Only valid
+        when canRedo returns true.
+    */
+    UndoAction getRedoAction();
+
 private:
     UndoList    d_undoList;         //!< Holds the undo history
     size_t      d_undoLimit;        //!< Maximum numer of undo entries
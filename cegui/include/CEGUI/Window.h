@@ -3231,6 +3231,14 @@ protected:
     */
     void updateGeometryBuffersAlpha();
 
+    /*!
+    \brief
+        Bring the alpha of the cached geometry of this Window, and of all the
+        child windows that inherit alpha from it, up to date after the
+        effective alpha has changed.  The geometry itself is not regenerated.
+    */
+    void updateEffectiveAlpha();
+
     /*!
     \brief
     */
@@ -3412,6 +3420,28 @@ protected:
 
     bool isHitTargetWindow(const glm::vec2& position, bool allow_disabled) const;
 
+    /*!
+    \brief
+        Return whether \a position may hit this window or any of its visible
+        descendants.
+
+        This is tested against a cached rect enclosing the hit test rects of
+        the whole subtree, which lets getChildAtPosition skip subtrees that
+        can't contain \a position without visiting every window in them.
+        Overrides of isHit are expected to only report hits within the
+        window's hit test rect, as the default implementation does.
+    */
+    bool isHitTestBoundsHit(const glm::vec2& position) const;
+
+    //! recalculate the rect enclosing hit test rects of this subtree
+    void updateHitTestBounds() const;
+
+    //! rebuild d_hitTestGrid from the hit test bounds of the children
+    void updateHitTestGrid() const;
+
+    //! mark the hit test bounds of this window and its ancestors invalid
+    void invalidateHitTestBounds();
+
     /*************************************************************************
         Properties for Window base class
     *************************************************************************/
@@ -3477,6 +3507,8 @@ protected:
     bool d_initialising;
     //! true when this window is being destroyed.
     bool d_destructionStarted;
+    //! Position of this window in the WindowManager registry, if alive.
+    size_t d_registryIndex;
     //! true when Window is enabled
     bool d_enabled;
     //! is window visible (i.e. it will be rendered, but may still be obscured)
@@ -3596,10 +3628,26 @@ protected:
     mutable Rectf d_innerRectClipper;
     //! area rect used for hit-testing against this window
     mutable Rectf d_hitTestRect;
+    //! rect enclosing hit test rects of this window and visible descendants
+    mutable Rectf d_hitTestBounds;
 
     mutable bool d_outerRectClipperValid;
     mutable bool d_innerRectClipperValid;
     mutable bool d_hitTestRectValid;
+    mutable bool d_hitTestBoundsValid;
+    //! true if d_hitTestBounds can't be used to reject any position
+    mutable bool d_hitTestBoundsUnbounded;
+    /*!
+        Uniform grid over the hit test bounds of the visible children, rebuilt
+        with d_hitTestBounds.  Each cell lists the children overlapping it in
+        draw order.  Only used for windows with many children; empty
+        otherwise.
+    */
+    mutable std::vector<ChildDrawList> d_hitTestGrid;
+    //! area covered by d_hitTestGrid
+    mutable Rectf d_hitTestGridArea;
+    //! number of columns and rows of d_hitTestGrid
+    mutable size_t d_hitTestGridSize;
 
     //! The mode to use for calling Window::update
     WindowUpdateMode d_updateMode;
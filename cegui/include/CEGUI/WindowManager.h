@@ -157,7 +157,8 @@ public:
 		Destroy the specified Window object.
 
 	\param window
-		Pointer to the Window object to be destroyed.
+		Pointer to the Window object to be destroyed.  Its child windows that
+		are destroyed by their parent are destroyed with it.
 
 	\return
 		Nothing
@@ -178,7 +179,17 @@ public:
 	*/
 	void	destroyAllWindows(void);
 
-    //! return whether Window is alive.
+    /*!
+    \brief
+        Return whether Window is alive, i.e. it was created by the
+        WindowManager and has not been passed to destroyWindow.  This takes
+        constant time.
+
+    \param window
+        Pointer to the window to check.  The Window object must not have
+        been deleted, which happens when the dead pool is cleaned after the
+        window was destroyed.
+    */
     bool isAlive(const Window* window) const;
 
     /*!
@@ -407,7 +418,11 @@ private:
 	*************************************************************************/
     typedef std::vector<Window*> WindowVector; //!< Type to use for a collection of Window pointers.
 
-    //! collection of created windows.
+    /*!
+        collection of created windows, in no particular order.  Each window
+        records its position in the collection (Window::d_registryIndex) so
+        that it can be looked up and removed in constant time.
+    */
 	WindowVector d_windowRegistry;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
 
@@ -99,8 +99,7 @@ protected:
 
 private:
     void renderTreeItem(TreeView* tree_view, const Rectf& items_area,
-        glm::vec2& item_pos, const TreeViewItemRenderingState* item_to_render,
-        size_t depth);
+        const glm::vec2& item_pos, TreeViewItemRenderingState* item);
 
     const ImagerySection* d_subtreeExpanderImagery;
     const ImagerySection* d_subtreeCollapserImagery;
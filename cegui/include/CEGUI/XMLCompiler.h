@@ -0,0 +1,131 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIXMLCompiler_h_
+#define _CEGUIXMLCompiler_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Converts XML data files (looknfeel, scheme, imageset, layout and so on)
+    into a compact binary form, and feeds such compiled data to an
+    XMLHandler without going through the XMLParser module.
+
+    The compiled form holds each distinct string and each distinct
+    attribute list of the document once, followed by a stream of element
+    start, element end and text records that refer to them by index.
+    Replaying it calls the handler exactly as parsing the original XML
+    would, so every existing handler works with it unchanged.
+
+    parseCompiled decodes the strings and builds the XMLAttributes for each
+    distinct attribute list once per call, rather than once per element.
+    What is saved is the XML tokenizing and that per element work; the
+    handlers still receive Strings and dispatch on element and attribute
+    names as before, so their own cost is unaffected.
+
+    XMLParser::parseXMLFile and XMLHandler::handleContainer check loaded
+    data for the compiled signature, so a compiled file can be deployed in
+    place of its XML source under the same name; any data without the
+    signature is parsed as XML as before.  The data is read directly from
+    the RawDataContainer supplied by the ResourceProvider.
+*/
+class CEGUIEXPORT XMLCompiler
+{
+public:
+    //! Version of the compiled format written by this class.
+    static const uint32 FormatVersion;
+
+    /*!
+    \brief
+        Parse an XML file with the current XMLParser and write its compiled
+        form to \a out.
+
+    \param filename
+        Name of the XML file to compile.
+
+    \param resourceGroup
+        Resource group identifier passed to the ResourceProvider when
+        loading \a filename.
+
+    \param out
+        Stream that receives the compiled data.  This should be opened in
+        binary mode.
+
+    \exception FileIOException
+        thrown if writing to \a out fails.
+    */
+    static void compileFile(const String& filename, const String& resourceGroup,
+                            OutStream& out);
+
+    /*!
+    \brief
+        Parse XML source held in a String with the current XMLParser and
+        write its compiled form to \a out.
+    */
+    static void compileString(const String& source, OutStream& out);
+
+    /*!
+    \brief
+        Parse XML data held in a RawDataContainer with the current XMLParser
+        and store its compiled form in \a output, which receives a newly
+        allocated buffer that it owns.
+
+        Only the XMLParser module is used, so this may be called from threads
+        other than the one running the GUI, provided the XMLParser module
+        itself supports that.
+    */
+    static void compile(const RawDataContainer& source, RawDataContainer& output);
+
+    /*!
+    \brief
+        Return whether \a data holds compiled XML as written by this class.
+    */
+    static bool isCompiled(const RawDataContainer& data);
+
+    /*!
+    \brief
+        Replay compiled XML data into \a handler.
+
+    \param handler
+        XMLHandler that will receive the element and text notifications.
+
+    \param data
+        RawDataContainer holding data for which isCompiled returns true.
+
+    \exception GenericException
+        thrown if \a data is not compiled XML, was written by an
+        incompatible version or is truncated.
+    */
+    static void parseCompiled(XMLHandler& handler, const RawDataContainer& data);
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIXMLCompiler_h_
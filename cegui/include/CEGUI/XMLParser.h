@@ -107,6 +107,9 @@ namespace CEGUI
         \brief
             convenience method which initiates parsing of an XML file.
 
+            If the file holds data written by XMLCompiler, it is replayed into
+            \a handler directly and the XML parser is not used.
+
         \param handler
             XMLHandler based object which will process the XML elements.
 
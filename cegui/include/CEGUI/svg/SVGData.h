@@ -31,7 +31,9 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
+#include "CEGUI/GeometryBuffer.h"
 
+#include <list>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -84,6 +86,22 @@ public:
         SVGUnit         d_unit;
     };
 
+    /*!
+    \brief
+        The geometry of one GeometryBuffer created by tesselating the shapes
+        of the SVGData, along with the buffer settings set by the tesselator.
+    */
+    struct TesselatedGeometry
+    {
+        std::vector<float>  d_vertexData;
+        glm::mat4x4         d_customTransform;
+        PolygonFillRule     d_fillRule;
+        unsigned int        d_postStencilVertexCount;
+    };
+
+    //! The geometry of all GeometryBuffers created for one tesselation.
+    typedef std::vector<TesselatedGeometry> TesselatedGeometryList;
+
     SVGData(const String& name);
 
     SVGData(const String& name,
@@ -174,6 +192,59 @@ public:
     */
     void setHeight(float height);
 
+    /*!
+    \brief
+        Returns the cached geometry of a previous tesselation of the shapes
+        with the given settings, if there is one, and marks it as the most
+        recently used.
+
+    \param scale_factor
+        The scale factor the shapes were tesselated for.
+
+    \param anti_aliasing
+        Whether anti-aliasing geometry was created for the shapes.
+
+    \return
+        Pointer to the cached geometry, or 0 if none is cached for the given
+        settings.  The pointer stays valid until the cache is next modified.
+    */
+    const TesselatedGeometryList* getCachedTesselation(const glm::vec2& scale_factor,
+                                                       bool anti_aliasing);
+
+    /*!
+    \brief
+        Adds the geometry of a tesselation of the shapes with the given
+        settings to the cache, evicting the least recently used entry if the
+        cache size is exceeded.
+
+    \param geometry
+        The tesselated geometry.  Its contents are moved into the cache and it
+        is left empty, unless the cache size is 0, in which case nothing is
+        cached and it is left unchanged.
+    */
+    void addCachedTesselation(const glm::vec2& scale_factor,
+                              bool anti_aliasing,
+                              TesselatedGeometryList& geometry);
+
+    /*!
+    \brief
+        Removes all cached tesselations. This is done automatically when shapes
+        are added or destroyed, but must be called manually after modifying the
+        shapes directly.
+    */
+    void clearTesselationCache();
+
+    /*!
+    \brief
+        Sets the maximum number of tesselations (i.e. distinct scale and
+        anti-aliasing settings) that are kept cached.  Setting this to 0
+        disables the cache.
+    */
+    void setTesselationCacheSize(size_t size);
+
+    //! Returns the maximum number of tesselations that are kept cached.
+    size_t getTesselationCacheSize() const;
+
 protected:
     // implement chained xml handler abstract interface
     void elementStartLocal(const String& element,
@@ -269,6 +340,20 @@ protected:
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
 
+    //! A cached tesselation of the basic shapes.
+    struct TesselationCacheEntry
+    {
+        glm::vec2               d_scaleFactor;
+        bool                    d_antiAliasing;
+        TesselatedGeometryList  d_geometry;
+    };
+
+    typedef std::list<TesselationCacheEntry> TesselationCache;
+    //! The cached tesselations, ordered from most to least recently used.
+    TesselationCache d_tesselationCache;
+    //! The maximum number of entries in d_tesselationCache.
+    size_t d_tesselationCacheSize;
+
 private:
     /*!
     \brief
@@ -28,13 +28,12 @@
 #define _SVGImage_h_
 
 #include "CEGUI/Image.h"
+#include "CEGUI/svg/SVGData.h"
 
 #include "glm/glm.hpp"
 
 namespace CEGUI
 {
-class SVGData;
-
 /*!
 \brief
     Defines the SVGImage class, which describes a vector graphics image that can be
@@ -109,6 +108,15 @@ public:
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
 protected:
+    /*!
+    \brief
+        Creates GeometryBuffers for the cached tesselation \a geometry using
+        the given render settings and appends them to \a image_geometry_buffers.
+    */
+    void createCachedGeometryBuffers(std::vector<GeometryBuffer*>& image_geometry_buffers,
+                                     const SVGData::TesselatedGeometryList& geometry,
+                                     const SVGImageRenderSettings& render_settings) const;
+
     /*!
         \brief
         Reference to the SVGData used as basis for drawing. The SVGData can be shared
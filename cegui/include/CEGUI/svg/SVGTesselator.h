@@ -219,6 +219,16 @@ public:
                                  std::vector<GeometryBuffer*>& geometry_buffers,
                                  const SVGImage::SVGImageRenderSettings& render_settings);
 
+    /*!
+    \brief
+        Sets an SVG GeometryBuffer's render settings and transformation matrix.
+        This is also used to set up the GeometryBuffers that are created from
+        cached tesselations.
+    */
+    static void setupGeometryBufferSettings(CEGUI::GeometryBuffer* geometry_buffer,
+                                            const SVGImage::SVGImageRenderSettings &render_settings,
+                                            const glm::mat4& cegui_transformation_matrix);
+
 private:
     /*!
 	\brief
@@ -386,11 +396,6 @@ private:
                                      const glm::mat3x3& svg_transformation,
                                      const bool is_fill_needing_stencil);
 
-    //! Helper function for setting an SVG GeometryBuffer's render settings and transformation matrix
-    static void setupGeometryBufferSettings(CEGUI::GeometryBuffer* geometry_buffer,
-                                            const SVGImage::SVGImageRenderSettings &render_settings,
-                                            const glm::mat4& cegui_transformation_matrix);
-
     //! Turns a matrix as defined by SVG into a matrix that can be used internally by the CEGUI Renderers
     static glm::mat4 createRenderableMatrixFromSVGMatrix(glm::mat3 svg_matrix);
 
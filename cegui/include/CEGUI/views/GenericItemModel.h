@@ -240,6 +240,14 @@ public:
     virtual ModelIndex makeIndex(size_t child, const ModelIndex& parent_index);
     virtual bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const;
     virtual int compareIndices(const ModelIndex& index1, const ModelIndex& index2) const;
+
+    /*!
+    \brief
+        Hashes the item pointer held by the index, which stays the same when
+        the item's contents change.
+    */
+    virtual size_t getIndexHash(const ModelIndex& model_index) const;
+
     virtual ModelIndex getParentIndex(const ModelIndex& model_index) const;
     virtual int getChildId(const ModelIndex& model_index) const;
     virtual ModelIndex getRootIndex() const;
@@ -313,7 +321,8 @@ template <typename TGenericItem>
 bool GenericItemModel<TGenericItem>::areIndicesEqual(const ModelIndex& index1,
     const ModelIndex& index2) const
 {
-    return compareIndices(index1, index2) == 0;
+    // each index refers to its own item, whatever the item's contents.
+    return index1.d_modelData == index2.d_modelData;
 }
 
 //----------------------------------------------------------------------------//
@@ -331,6 +340,14 @@ int GenericItemModel<TGenericItem>::compareIndices(const ModelIndex& index1,
     return *getItemForIndex(index1) == *getItemForIndex(index2) ? 0 : 1;
 }
 
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+size_t GenericItemModel<TGenericItem>::getIndexHash(
+    const ModelIndex& model_index) const
+{
+    return reinterpret_cast<size_t>(model_index.d_modelData);
+}
+
 //----------------------------------------------------------------------------//
 template <typename TGenericItem>
 ModelIndex GenericItemModel<TGenericItem>::getParentIndex(const ModelIndex& model_index) const
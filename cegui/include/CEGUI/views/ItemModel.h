@@ -215,6 +215,27 @@ public:
     */
     virtual bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const;
 
+    /*!
+    \brief
+        Returns a hash value for the specified index, which views use to look
+        indices up in hash tables (e.g.: when checking whether an index is
+        selected).
+
+        The hash must be consistent with areIndicesEqual: whenever
+        areIndicesEqual returns true for two valid indices, their hashes
+        must be the same. Unequal indices may share a hash, at the cost of
+        slower lookups. The hash of an index must also not change while the
+        index stays valid (e.g.: when the data of its item changes), since
+        views keep the hashes of the indices they track.
+
+        The default implementation returns the same hash for every index, so
+        views fall back to comparing indices linearly with areIndicesEqual.
+        Models whose indices are equal only when they hold the same
+        ModelIndex::d_modelData should return a hash of that pointer, as
+        GenericItemModel does.
+    */
+    virtual size_t getIndexHash(const ModelIndex& model_index) const;
+
     /*!
     \brief
         Compares semantically the contents of the specified two indices and returns:
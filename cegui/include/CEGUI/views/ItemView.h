@@ -37,6 +37,8 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/views/ItemModel.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include <utility>
+#include <vector>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -175,6 +177,13 @@ public:
 
     static const Colour DefaultTextColour;
     static const Colour DefaultSelectionColour;
+    /*!
+    \brief
+        Number of items beyond each edge of the visible area that are kept up
+        to date when virtualised rendering is enabled, so that small scrolls do
+        not immediately reach unmeasured items.
+    */
+    static const size_t VirtualisationOverscan;
     //! Widget name for the vertical scrollbar component.
     static const String VertScrollbarName;
     //! Widget name for the horizontal scrollbar component.
@@ -284,6 +293,13 @@ public:
     //! Clears all selected indices.
     void clearSelections();
 
+    /*!
+    \brief
+        Selects all the children of the model's root index, replacing the
+        current selection. This does nothing unless multi-select is enabled.
+    */
+    void selectAll();
+
     void setSelectionBrushImage(const Image* image);
     /*!
     \brief
@@ -357,13 +373,60 @@ public:
     //! Returns the height of the rendered contents.
     float getRenderedTotalHeight() const;
 
+    /*!
+    \brief
+        Specifies whether only the items that intersect the visible area of the
+        view are measured and rendered.
+
+        With virtualised rendering enabled, items outside the visible area get
+        an estimated height (the line spacing of the view's font) until they
+        are scrolled into view, at which point their text is parsed and
+        measured and the measured size is cached. This keeps views bound to
+        models with a very large number of items responsive, at the expense of
+        the rendered content size being approximate until all items have been
+        shown at least once.
+    */
+    void setVirtualisedRenderingEnabled(bool enabled);
+    bool isVirtualisedRenderingEnabled() const;
+
+    /*!
+    \brief
+        Returns the range [\a first, \a end) of the positions, in rendering
+        order, of the items that intersect the visible area of the view,
+        extended by \a overscan items on either side.
+
+        This is only valid after prepareForRender() has been called.
+    */
+    void getVisibleItemRange(size_t& first, size_t& end, size_t overscan = 0);
+
+    /*!
+    \brief
+        Returns the vertical offset of the item at the specified position, in
+        rendering order, relative to the top of the view's content.
+    */
+    float getRenderedItemOffset(size_t position) const;
+
 protected:
     ItemModel* d_itemModel;
     ColourRect d_textColourRect;
     ColourRect d_selectionColourRect;
     bool d_isDirty;
     bool d_needsFullRender;
+    //! Specifies whether every item has to be refreshed from the model.
+    bool d_needsItemsUpdate;
+    //! Specifies whether only the selection state of the items has to be refreshed.
+    bool d_needsSelectionUpdate;
     std::vector<ModelIndexSelectionState> d_indexSelectionStates;
+    //! A selected index with its ItemModel::getIndexHash value.
+    typedef std::pair<size_t, ModelIndex> HashedIndex;
+    typedef std::vector<std::vector<HashedIndex> > SelectedIndexBuckets;
+    /*!
+        Hash table of the selected indices, for constant time lookups.  The
+        number of buckets is zero or a power of two.
+    */
+    SelectedIndexBuckets d_selectedIndexBuckets;
+    //! Number of indices in d_selectedIndexBuckets.
+    size_t d_selectedIndexCount;
     ModelIndex d_lastSelectedIndex;
     const Image* d_selectionBrush;
     ScrollbarDisplayMode d_vertScrollbarDisplayMode;
@@ -373,10 +436,18 @@ protected:
     ViewSortMode d_sortMode;
     bool d_isAutoResizeHeightEnabled;
     bool d_isAutoResizeWidthEnabled;
+    bool d_isVirtualisedRenderingEnabled;
 
     //TODO: move this into the renderer instead?
     float d_renderedMaxWidth;
     float d_renderedTotalHeight;
+    /*!
+    \brief
+        Prefix sums of the heights of the rendered items, in rendering order.
+        Entry i is the offset of the i-th item from the top of the content and
+        the last entry is the total height of the content.
+    */
+    std::vector<float> d_renderedItemOffsets;
 
     void addItemViewProperties();
     virtual void updateScrollbars();
@@ -416,9 +487,41 @@ protected:
     void connectToModelEvents(ItemModel* d_itemModel);
     void disconnectModelEvents();
 
+    /*!
+    \brief
+        Invalidates this view after it patched the rendering states of its
+        items in place, starting at the position \a first_position in
+        rendering order (e.g.: in response to children being added to the
+        model).
+
+        Unlike invalidateView, this doesn't make the next prepareForRender()
+        refresh every item from the model. Since the items are rendered top
+        to bottom, the window is only redrawn when the patched items start
+        above the bottom of the visible area, or when the area itself changed.
+    */
+    void invalidateRenderedItems(size_t first_position);
+
+    //! Shifts the child ids of the selected indices after children were added.
+    void updateSelectionForAddedChildren(const ModelEventArgs& args);
+
     void handleOnScroll(Scrollbar* scrollbar, float scroll);
     void setupTooltip(glm::vec2 position);
     int getSelectedIndexPosition(const ModelIndex& index) const;
+    //! Returns the bucket of d_selectedIndexBuckets for \a hash.
+    size_t getSelectedIndexBucket(size_t hash) const;
+    //! Returns whether \a index is in d_selectedIndexBuckets.
+    bool isInSelectedIndexLookup(const ModelIndex& index) const;
+    //! Adds \a index to d_selectedIndexBuckets.
+    void addToSelectedIndexLookup(const ModelIndex& index);
+    //! Removes \a index from d_selectedIndexBuckets.
+    void removeFromSelectedIndexLookup(const ModelIndex& index);
+    //! Removes all indices from d_selectedIndexBuckets.
+    void clearSelectedIndexLookup();
+    //! Rebuilds d_selectedIndexBuckets from d_indexSelectionStates.
+    void rebuildSelectedIndexLookup();
+    //! Appends the unselected children in the specified range to the selection.
+    void selectRange(const ModelIndex& parent_index, size_t start_child_id,
+        size_t end_child_id);
     virtual bool handleSelection(const glm::vec2& position, bool should_select,
         bool is_cumulative, bool is_range);
     virtual bool handleSelection(const ModelIndex& index, bool should_select,
@@ -432,6 +535,17 @@ protected:
 
     void updateAutoResizeFlag(bool& flag, bool enabled);
     void resizeToContent();
+
+    /*!
+    \brief
+        Returns the position, in rendering order, of the item found at the
+        specified vertical offset from the top of the view's content, or the
+        number of rendered items if there is no item at that offset.
+    */
+    size_t getRenderedItemPositionAt(float offset) const;
+
+    //! Returns the height used for items that have not been measured yet.
+    float getEstimatedItemHeight() const;
 };
 
 }
@@ -61,6 +61,14 @@ struct CEGUIEXPORT ListViewItemRenderingState
     ModelIndex d_index;
     String d_text;
     ListView* d_attachedListView;
+    /*!
+    \brief
+        Specifies whether the string, size and selection state of this item
+        have to be refreshed from the model before it's rendered. This is only
+        the case when virtualised rendering is enabled, in which case d_size
+        holds either an estimate or the last measured size of the item.
+    */
+    bool d_needsUpdate;
 
     ListViewItemRenderingState(ListView* list_view);
     bool operator< (const ListViewItemRenderingState& other) const;
@@ -97,19 +105,48 @@ public:
 protected:
     virtual bool onChildrenAdded(const EventArgs& args);
     virtual bool onChildrenRemoved(const EventArgs& args);
+    virtual bool onChildrenDataChanged(const EventArgs& args);
 
 private:
     std::vector<ListViewItemRenderingState> d_items;
     std::vector<ListViewItemRenderingState*> d_sortedItems;
+    //! Position in d_sortedItems of each of the entries of d_items.
+    std::vector<size_t> d_sortedItemPositions;
 
     void resortListView();
     virtual void resortView();
 
+    //! Refreshes (or, for a full render, recreates) all the items from the model.
+    void updateAllItems();
+    //! Refreshes only the selection state of all the items.
+    void updateSelectionStates();
+
+    //! Creates the rendering states for the specified range of root children
+    //! that were added to the model.
+    void addItems(size_t start_id, size_t count);
+    //! Refreshes the model indices of all the items, without updating them.
+    void updateItemIndices();
+
+    //! Returns the first rendered position affected by a change to the root
+    //! child with the specified id.
+    size_t getFirstChangedPosition(size_t child_id) const;
+
+    //! Recomputes the rendered item offsets from the current item sizes,
+    //! starting at the item with the specified rendered position.
+    void updateItemOffsets(size_t first_position = 0);
+
     //! Updates the rendering state for the specified \a item using the specified
     //! \a index as the data source.
     void updateItem(ListViewItemRenderingState& item, ModelIndex index,
         float& max_width, float& total_height);
 
+    //! Initialises the rendering state for the specified \a item with an
+    //! estimated size, deferring the update until the item becomes visible.
+    void estimateItem(ListViewItemRenderingState& item, ModelIndex index);
+
+    //! Updates the items in or near the visible area that need updating.
+    void updateVisibleItems();
+
     virtual Rectf getIndexRect(const ModelIndex& index);
 };
 
@@ -103,6 +103,14 @@ public:
     size_t d_childId;
     bool d_subtreeIsExpanded;
     int d_nestedLevel;
+    /*!
+    \brief
+        Specifies whether the string, size and selection state of this item
+        have to be refreshed from the model before it's rendered. This is only
+        the case when virtualised rendering is enabled, in which case d_size
+        holds either an estimate or the last measured size of the item.
+    */
+    bool d_needsUpdate;
 
     TreeView* d_attachedTreeView;
 
@@ -139,6 +147,16 @@ public:
 
     const TreeViewItemRenderingState& getRootItemState() const;
 
+    /*!
+    \brief
+        Returns all the items that are currently rendered (i.e.: are not part
+        of a collapsed subtree), flattened in rendering order. The positions
+        in this vector are the ones used by ItemView::getVisibleItemRange.
+
+        This is only valid after prepareForRender() has been called.
+    */
+    const std::vector<TreeViewItemRenderingState*>& getRenderedItems() const;
+
     virtual void prepareForRender();
 
     virtual ModelIndex indexAt(const glm::vec2& position);
@@ -178,6 +196,7 @@ protected:
 
     virtual bool onChildrenRemoved(const EventArgs& args);
     virtual bool onChildrenAdded(const EventArgs& args);
+    virtual bool onChildrenDataChanged(const EventArgs& args);
 
     virtual void onSubtreeExpanded(ItemViewEventArgs& args);
     virtual void onSubtreeCollapsed(ItemViewEventArgs& args);
@@ -188,6 +207,10 @@ private:
     typedef std::vector<TreeViewItemRenderingState> ItemStateVector;
 
     TreeViewItemRenderingState d_rootItemState;
+    //! The rendered items, flattened in rendering order.
+    std::vector<TreeViewItemRenderingState*> d_renderedItems;
+    //! Specifies whether the rendered items need to be flattened again.
+    bool d_renderedItemsDirty;
     TreeViewItemRenderingState computeRenderingStateForIndex(
         const ModelIndex& parent_index, size_t child_id, size_t nested_level,
         float& rendered_max_width, float& rendered_total_height);
@@ -204,9 +227,49 @@ private:
 
     void fillRenderingState(TreeViewItemRenderingState& state, const ModelIndex& index, float& rendered_max_width, float& rendered_total_height);
 
+    //! Initialises the rendering state for the specified \a item with an
+    //! estimated size, deferring the update until the item becomes visible.
+    void estimateRenderingState(TreeViewItemRenderingState& item);
+
+    //! Flattens the rendered items and recomputes their offsets.
+    void updateRenderedItems();
+    void addRenderedItems(const TreeViewItemRenderingState& item);
+    //! Recomputes the rendered item offsets from the current item sizes,
+    //! starting at the item with the specified rendered position.
+    void updateItemOffsets(size_t first_position = 0);
+    //! Updates the items in or near the visible area that need updating.
+    void updateVisibleItems();
+    //! Refreshes only the selection state of the descendants of \a item.
+    void updateSelectionStates(TreeViewItemRenderingState& item);
+
+    //! Creates the rendering states for the specified range of children of
+    //! \a item that were added to the model.
+    void addChildItems(TreeViewItemRenderingState& item,
+        const ModelIndex& parent_index, size_t start_id, size_t count);
+    /*!
+    \brief
+        Adds the children of the expanded \a item starting with the one with
+        the specified id, which were appended to its children, to the rendered
+        children and items in their sorted positions.
+    */
+    void addRenderedChildren(TreeViewItemRenderingState& item, size_t start_id);
+    //! Returns the rendered position right after the last rendered
+    //! descendant of \a item.
+    size_t getSubtreeEndPosition(const TreeViewItemRenderingState& item) const;
+
+    /*!
+    \brief
+        Returns the position of the specified item in the rendered items, or
+        the number of rendered items if it's not rendered. The root item is
+        considered to be at position 0.
+    */
+    size_t getRenderedItemPosition(const TreeViewItemRenderingState* item) const;
+    //! Returns the first rendered position affected by a change to the child
+    //! with the specified id of \a item.
+    size_t getFirstChangedPosition(const TreeViewItemRenderingState& item,
+        size_t child_id) const;
+
     ModelIndex indexAtWithAction(const glm::vec2& position, TreeViewItemAction action);
-    ModelIndex indexAtRecursive(TreeViewItemRenderingState& item, float& cur_height,
-        const glm::vec2& window_position, bool& handled, TreeViewItemAction action);
 
     void clearItemRenderedChildren(TreeViewItemRenderingState& item, float& renderedTotalHeight);
     void handleSelectionAction(TreeViewItemRenderingState& item, bool toggles_expander);
@@ -32,6 +32,7 @@
 #include "../Base.h"
 #include "../Window.h"
 #include "./ListHeader.h"
+#include <map>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -760,6 +761,27 @@ public:
     */
     float   getHighestRowItemHeight(uint row_idx) const;
 
+    /*!
+    \brief
+        Return the offset, in pixels, of the top of the row at index
+        \a row_idx from the top of the list content.  \a row_idx may be equal
+        to the row count, in which case the sum of all row heights is returned.
+
+        Row heights are cached, so after modifying attached items externally
+        handleUpdatedItemData() must be called for the offsets to be updated.
+
+    \exception InvalidRequestException	thrown if \a row_idx is out of range.
+    */
+    float   getRowOffset(uint row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the row found at the offset \a offset, in pixels,
+        from the top of the list content, or the row count if there is no row
+        at that offset.
+    */
+    uint    getRowAtOffset(float offset) const;
+
     /*!
     \brief
         Get whether or not column auto-sizing (autoSizeColumnHeader()) will use
@@ -1570,9 +1592,50 @@ protected:
     /*!
     \brief
         Causes the internal list to be (re)sorted.
+
+        Nothing is done when the list is already sorted by the current sort
+        column and direction, and when only the direction changed the rows are
+        just reversed.
     */
     void resortList();
 
+    /*!
+    \brief
+        Invalidates the cached row offsets and item to row index after rows
+        were reordered, so that they are rebuilt when next needed.
+    */
+    void invalidateRowCaches();
+
+    /*!
+    \brief
+        Updates the row caches for a row just inserted at \a row_idx.
+        Appending is cheap; inserting elsewhere shifts the rows below.
+    */
+    void updateRowCachesForInsert(uint row_idx);
+
+    //! Updates the row caches for the row at \a row_idx about to be removed.
+    void updateRowCachesForRemove(uint row_idx);
+
+    /*!
+    \brief
+        Recomputes the height of the row at \a position and updates the row
+        caches after the item there replaced \a old_item.
+    */
+    void updateRowForReplacedItem(const MCLGridRef& position, const ListboxItem* old_item);
+
+    /*!
+    \brief
+        Recomputes the cached height of every row, after the size of the
+        attached items might have changed.
+    */
+    void updateRowHeights();
+
+    //! Rebuilds the cached row offsets if they are invalid.
+    void updateRowOffsets() const;
+
+    //! Rebuilds the item to row index if it is invalid.
+    void updateItemRowIndex() const;
+
 	/*************************************************************************
 		New event handlers for multi column list
 	*************************************************************************/
@@ -1684,6 +1747,7 @@ protected:
 		RowItems	d_items;
 		uint		d_sortColumn;
 		uint		d_rowID;
+		float		d_height;	//!< cached height of the highest item in the row.
 
 		// operators
 		ListboxItem* const& operator[](uint idx) const	{return d_items[idx];}
@@ -1699,6 +1763,9 @@ protected:
 	*/
 	static bool pred_descend(const ListRow& a, const ListRow& b);
 
+    //! Return the height of the highest item in the given row.
+    float calculateRowHeight(const ListRow& row) const;
+
 
 	/*************************************************************************
 		Implementation Data
@@ -1724,6 +1791,19 @@ protected:
 	typedef std::vector<ListRow> ListItemGrid;
 	ListItemGrid	d_grid;			//!< Holds the list box data.
 
+	//! Offset of the top of each row, plus the total height as the last entry.
+	mutable std::vector<float>	d_rowOffsets;
+	mutable bool	d_rowOffsetsValid;	//!< true if d_rowOffsets is up to date.
+	typedef std::map<const ListboxItem*, uint> ItemRowIndex;
+	//! Row index of each attached item, for reverse lookups.  As with item
+	//! deletion, an item is assumed to be attached to one cell at a time.
+	mutable ItemRowIndex	d_itemRows;
+	mutable bool	d_itemRowsValid;	//!< true if d_itemRows is up to date.
+
+	// the order d_grid is currently sorted in, used to avoid needless resorts.
+	uint	d_gridSortColumn;
+	ListHeaderSegment::SortDirection	d_gridSortDirection;
+
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
@@ -520,6 +520,47 @@ protected:
 	*/
 	size_t	getNextTokenLength(const String& text, size_t start_idx) const;
 
+    /*!
+    \brief
+        Replace \a length code points of the text, starting at \a start_idx,
+        with \a text.
+
+        The window text is modified in place and the change is recorded, so
+        that the following call to onTextChanged only reformats the
+        paragraphs that were touched.  Callers must call onTextChanged once
+        they have finished modifying the text.
+    */
+    void replaceTextRange(size_t start_idx, size_t length, const String& text);
+
+    /*!
+    \brief
+        Record that \a removed code points at \a start_idx were replaced with
+        \a inserted code points, merging with any change that is already
+        pending formatting.
+    */
+    void recordTextChange(size_t start_idx, size_t removed, size_t inserted);
+
+    /*!
+    \brief
+        Reformat the paragraphs affected by the recorded text change, leaving
+        the lines of all other paragraphs as they are.
+    */
+    void formatChangedText();
+
+    /*!
+    \brief
+        Format the paragraph of \a length code points starting at \a start_idx
+        into lines no wider than \a area_width, appending them to \a lines.
+    */
+    void formatParagraph(size_t start_idx, size_t length, float area_width,
+                         LineList& lines) const;
+
+    //! Return whether line \a line_idx is the first line of a paragraph.
+    bool isParagraphStart(size_t line_idx) const;
+
+    //! Recalculate d_widestExtent from the formatted lines.
+    void updateWidestExtent();
+
 
     /*!
 	\brief
@@ -801,6 +842,11 @@ protected:
 	float         d_lastRenderWidth;  //!< Holds last render area width
 	float		  d_widestExtent;	//!< Holds the extent of the widest line as calculated in the last formatting pass.
 	UndoHandler*  d_undoHandler;    //!< Undo handler class
+    bool          d_linesValid;     //!< true if d_lines describes the current text, formatted at d_lastRenderWidth.
+    bool          d_textChangePending;  //!< true if a text change was recorded that has not been formatted yet.
+    size_t        d_changeStartIdx; //!< Index of the first code point of the recorded text change.
+    size_t        d_changeOldEnd;   //!< End of the recorded change in the text that d_lines describes.
+    size_t        d_changeNewEnd;   //!< End of the recorded change in the current text.
 
 	// component widget settings
 	bool	d_forceVertScroll;		//!< true if vertical scrollbar should always be displayed
@@ -36,11 +36,18 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Animation_xmlHandler.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 
+//----------------------------------------------------------------------------//
+static bool keyFramePositionLess(const KeyFrame* keyframe, float position)
+{
+    return keyframe->getPosition() < position;
+}
+
 //----------------------------------------------------------------------------//
 Affector::Affector(Animation* parent):
     d_parent(parent),
@@ -54,7 +61,7 @@ Affector::~Affector(void)
 {
     while (d_keyFrames.size() > 0)
     {
-        destroyKeyFrame(getKeyFrameAtIdx(0));
+        destroyKeyFrame(d_keyFrames.back());
     }
 }
 
@@ -125,7 +132,9 @@ Interpolator* Affector::getInterpolator() const
 //----------------------------------------------------------------------------//
 KeyFrame* Affector::createKeyFrame(float position)
 {
-    if (d_keyFrames.find(position) != d_keyFrames.end())
+    const KeyFrameList::iterator it = findKeyFrame(position);
+
+    if (it != d_keyFrames.end() && (*it)->getPosition() == position)
     {
         CEGUI_THROW(InvalidRequestException(
                         "Unable to create KeyFrame at given position, there "
@@ -133,7 +142,7 @@ KeyFrame* Affector::createKeyFrame(float position)
     }
 
     KeyFrame* ret = new KeyFrame(this, position);
-    d_keyFrames.insert(std::make_pair(position, ret));
+    d_keyFrames.insert(it, ret);
 
     return ret;
 }
@@ -153,9 +162,9 @@ KeyFrame* Affector::createKeyFrame(float position, const String& value,
 //----------------------------------------------------------------------------//
 void Affector::destroyKeyFrame(KeyFrame* keyframe)
 {
-    KeyFrameMap::iterator it = d_keyFrames.find(keyframe->getPosition());
+    const KeyFrameList::iterator it = findKeyFrame(keyframe->getPosition());
 
-    if (it == d_keyFrames.end())
+    if (it == d_keyFrames.end() || *it != keyframe)
     {
         CEGUI_THROW(InvalidRequestException(
                         "Unable to destroy given KeyFrame! "
@@ -169,21 +178,23 @@ void Affector::destroyKeyFrame(KeyFrame* keyframe)
 //----------------------------------------------------------------------------//
 KeyFrame* Affector::getKeyFrameAtPosition(float position) const
 {
-    KeyFrameMap::const_iterator it = d_keyFrames.find(position);
+    const KeyFrameList::const_iterator it = findKeyFrame(position);
 
-    if (it == d_keyFrames.end())
+    if (it == d_keyFrames.end() || (*it)->getPosition() != position)
     {
         CEGUI_THROW(InvalidRequestException(
                         "Can't find a KeyFrame with given position."));
     }
 
-    return it->second;
+    return *it;
 }
 
 //----------------------------------------------------------------------------//
 bool Affector::hasKeyFrameAtPosition(float position) const
 {
-	return d_keyFrames.find(position) != d_keyFrames.end();
+    const KeyFrameList::const_iterator it = findKeyFrame(position);
+
+    return it != d_keyFrames.end() && (*it)->getPosition() == position;
 }
 
 //----------------------------------------------------------------------------//
@@ -194,10 +205,7 @@ KeyFrame* Affector::getKeyFrameAtIdx(size_t index) const
         CEGUI_THROW(InvalidRequestException("Out of bounds!"));
     }
 
-    KeyFrameMap::const_iterator it = d_keyFrames.begin();
-    std::advance(it, index);
-
-    return it->second;
+    return d_keyFrames[index];
 }
 
 //----------------------------------------------------------------------------//
@@ -212,27 +220,25 @@ void Affector::moveKeyFrameToPosition(KeyFrame* keyframe, float newPosition)
 	if (keyframe->getPosition() == newPosition)
 		return;
 
-    if (d_keyFrames.find(newPosition) != d_keyFrames.end())
+    if (hasKeyFrameAtPosition(newPosition))
     {
         CEGUI_THROW(InvalidRequestException(
                     "There is already a key frame at position: " +
                     PropertyHelper<float>::toString(newPosition) + "."));
 	}
 
-    for (KeyFrameMap::iterator it = d_keyFrames.begin(); it != d_keyFrames.end(); ++it)
-    {
-        if (it->second == keyframe)
-        {
-            d_keyFrames.erase(it);
-            d_keyFrames.insert(std::make_pair(newPosition, keyframe));
+    const KeyFrameList::iterator it = findKeyFrame(keyframe->getPosition());
 
-            keyframe->notifyPositionChanged(newPosition);
-            return;
-        }
+    if (it == d_keyFrames.end() || *it != keyframe)
+    {
+        CEGUI_THROW(UnknownObjectException(
+            "passed key frame wasn't found within this affector"));
     }
 
-    CEGUI_THROW(UnknownObjectException(
-        "passed key frame wasn't found within this affector"));
+    d_keyFrames.erase(it);
+    d_keyFrames.insert(findKeyFrame(newPosition), keyframe);
+
+    keyframe->notifyPositionChanged(newPosition);
 }
 
 //----------------------------------------------------------------------------//
@@ -258,10 +264,10 @@ void Affector::savePropertyValues(AnimationInstance* instance)
     }
 
     // now let all keyframes save their desired property values too
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
+    for (KeyFrameList::const_iterator it = d_keyFrames.begin();
          it != d_keyFrames.end(); ++it)
     {
-        it->second->savePropertyValue(instance);
+        (*it)->savePropertyValue(instance);
     }
 }
 
@@ -294,22 +300,29 @@ void Affector::apply(AnimationInstance* instance)
     KeyFrame* left = 0;
     KeyFrame* right = 0;
 
-    // find 2 neighbouring keyframes
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
-         it != d_keyFrames.end(); ++it)
+    // find 2 neighbouring keyframes, starting at the segment used by the
+    // previous step of this instance
+    size_t& cursor = instance->getKeyFrameCursor(this);
+    const size_t leftIdx = findLeftKeyFrameIdx(position, cursor);
+
+    if (leftIdx < d_keyFrames.size())
     {
-        KeyFrame* current = it->second;
+        cursor = leftIdx;
+        left = d_keyFrames[leftIdx];
 
-        if (current->getPosition() <= position)
+        if (left->getPosition() == position)
         {
-            left = current;
+            right = left;
         }
-
-        if (current->getPosition() >= position && !right)
+        else if (leftIdx + 1 < d_keyFrames.size())
         {
-            right = current;
+            right = d_keyFrames[leftIdx + 1];
         }
     }
+    else
+    {
+        right = d_keyFrames.front();
+    }
 
     float leftDistance, rightDistance;
 
@@ -320,7 +333,7 @@ void Affector::apply(AnimationInstance* instance)
     else
         // if no keyframe is suitable for left neighbour, pick the first one
     {
-        left = d_keyFrames.begin()->second;
+        left = d_keyFrames.front();
         leftDistance = 0;
     }
 
@@ -331,7 +344,7 @@ void Affector::apply(AnimationInstance* instance)
     else
         // if no keyframe is suitable for the right neighbour, pick the last one
     {
-        right = d_keyFrames.rbegin()->second;
+        right = d_keyFrames.back();
         rightDistance = 0;
     }
 
@@ -347,9 +360,22 @@ void Affector::apply(AnimationInstance* instance)
         right->alterInterpolationPosition(
             leftDistance / (leftDistance + rightDistance));
 
+    // use the native path if the interpolator supports the target property,
+    // this avoids converting the result to String and back
+    Interpolator::NativeApplier* const applier =
+        instance->getNativeApplier(this);
+
     // absolute application method
     if (d_applicationMethod == AM_Absolute)
     {
+        if (applier)
+        {
+            applier->applyAbsolute(left->getValueForAnimation(instance),
+                                   right->getValueForAnimation(instance),
+                                   interpolationPosition);
+            return;
+        }
+
         const String result = d_interpolator->interpolateAbsolute(
                                   left->getValueForAnimation(instance),
                                   right->getValueForAnimation(instance),
@@ -362,6 +388,15 @@ void Affector::apply(AnimationInstance* instance)
     {
         const String& base = instance->getSavedPropertyValue(getTargetProperty());
 
+        if (applier)
+        {
+            applier->applyRelative(base,
+                                   left->getValueForAnimation(instance),
+                                   right->getValueForAnimation(instance),
+                                   interpolationPosition);
+            return;
+        }
+
         const String result = d_interpolator->interpolateRelative(
                                   base,
                                   left->getValueForAnimation(instance),
@@ -375,6 +410,15 @@ void Affector::apply(AnimationInstance* instance)
     {
         const String& base = instance->getSavedPropertyValue(getTargetProperty());
 
+        if (applier)
+        {
+            applier->applyRelativeMultiply(base,
+                                           left->getValueForAnimation(instance),
+                                           right->getValueForAnimation(instance),
+                                           interpolationPosition);
+            return;
+        }
+
         const String result = d_interpolator->interpolateRelativeMultiply(
                                   base,
                                   left->getValueForAnimation(instance),
@@ -390,6 +434,48 @@ void Affector::apply(AnimationInstance* instance)
     }
 }
 
+//----------------------------------------------------------------------------//
+Affector::KeyFrameList::iterator Affector::findKeyFrame(float position)
+{
+    return std::lower_bound(d_keyFrames.begin(), d_keyFrames.end(), position,
+                            keyFramePositionLess);
+}
+
+//----------------------------------------------------------------------------//
+Affector::KeyFrameList::const_iterator Affector::findKeyFrame(float position) const
+{
+    return std::lower_bound(d_keyFrames.begin(), d_keyFrames.end(), position,
+                            keyFramePositionLess);
+}
+
+//----------------------------------------------------------------------------//
+size_t Affector::findLeftKeyFrameIdx(float position, size_t hint) const
+{
+    const size_t count = d_keyFrames.size();
+
+    // try the hinted segment and the one after it first
+    if (hint < count && d_keyFrames[hint]->getPosition() <= position)
+    {
+        if (hint + 1 == count || d_keyFrames[hint + 1]->getPosition() > position)
+            return hint;
+
+        if (hint + 2 == count || d_keyFrames[hint + 2]->getPosition() > position)
+            return hint + 1;
+    }
+
+    // the position was changed by more than one segment or went backwards
+    const KeyFrameList::const_iterator it = findKeyFrame(position);
+
+    if (it != d_keyFrames.end() && (*it)->getPosition() == position)
+        return it - d_keyFrames.begin();
+
+    if (it == d_keyFrames.begin())
+        return count;
+
+    return (it - d_keyFrames.begin()) - 1;
+}
+
+//----------------------------------------------------------------------------//
 void Affector::writeXMLToStream(XMLSerializer& xml_stream) const
 {
     xml_stream.openTag(AnimationAffectorHandler::ElementName);
@@ -421,10 +507,10 @@ void Affector::writeXMLToStream(XMLSerializer& xml_stream) const
         xml_stream.attribute(AnimationAffectorHandler::InterpolatorAttribute, getInterpolator()->getType());
     }
 
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
+    for (KeyFrameList::const_iterator it = d_keyFrames.begin();
          it != d_keyFrames.end(); ++it)
     {
-        it->second->writeXMLToStream(xml_stream);
+        (*it)->writeXMLToStream(xml_stream);
     }
 
     xml_stream.closeTag();
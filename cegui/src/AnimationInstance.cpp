@@ -74,6 +74,8 @@ AnimationInstance::~AnimationInstance(void)
     {
         d_definition->autoUnsubscribe(this);
     }
+
+    purgeNativeAppliers();
 }
 
 //----------------------------------------------------------------------------//
@@ -88,6 +90,7 @@ void AnimationInstance::setTarget(PropertySet* target)
     d_target = target;
 
     purgeSavedPropertyValues();
+    purgeNativeAppliers();
 
     if (d_definition->getAutoStart() && !isRunning())
     {
@@ -478,6 +481,72 @@ void AnimationInstance::savePropertyValue(const String& propertyName)
     d_savedPropertyValues[propertyName] = d_target->getProperty(propertyName);
 }
 
+//----------------------------------------------------------------------------//
+Interpolator::NativeApplier* AnimationInstance::getNativeApplier(
+    const Affector* affector)
+{
+    Interpolator* const interpolator = affector->getInterpolator();
+    const String& propertyName = affector->getTargetProperty();
+
+    // the property is looked up every time, since the target's properties
+    // can be replaced (e.g.: when its LookNFeel changes), and an applier
+    // must never outlive the property it sets.
+    Property* const property =
+        d_target && d_target->isPropertyPresent(propertyName) ?
+            d_target->getPropertyInstance(propertyName) : 0;
+
+    NativeApplierMap::iterator it = d_nativeAppliers.find(affector);
+
+    if (it != d_nativeAppliers.end())
+    {
+        NativeApplierEntry& entry = it->second;
+
+        if (entry.d_interpolator == interpolator &&
+            entry.d_propertyName == propertyName &&
+            entry.d_property == property)
+        {
+            return entry.d_applier;
+        }
+
+        // the affector or the target property was changed since the applier
+        // was created
+        delete entry.d_applier;
+        d_nativeAppliers.erase(it);
+    }
+
+    NativeApplierEntry entry;
+    entry.d_interpolator = interpolator;
+    entry.d_propertyName = propertyName;
+    entry.d_property = property;
+    entry.d_applier = 0;
+
+    if (interpolator && property)
+        entry.d_applier = interpolator->createNativeApplier(d_target, property);
+
+    d_nativeAppliers[affector] = entry;
+
+    return entry.d_applier;
+}
+
+//----------------------------------------------------------------------------//
+void AnimationInstance::purgeNativeAppliers(void)
+{
+    for (NativeApplierMap::iterator it = d_nativeAppliers.begin();
+         it != d_nativeAppliers.end(); ++it)
+    {
+        delete it->second.d_applier;
+    }
+
+    d_nativeAppliers.clear();
+}
+
+//----------------------------------------------------------------------------//
+size_t& AnimationInstance::getKeyFrameCursor(const Affector* affector)
+{
+    // the cursor is only a hint, Affector validates it before use
+    return d_keyFrameCursors[affector];
+}
+
 //----------------------------------------------------------------------------//
 void AnimationInstance::purgeSavedPropertyValues(void)
 {
@@ -533,6 +602,7 @@ void AnimationInstance::apply()
 void AnimationInstance::onAnimationStarted()
 {
     purgeSavedPropertyValues();
+    purgeNativeAppliers();
     d_definition->savePropertyValues(this);
 
     if (d_eventReceiver)
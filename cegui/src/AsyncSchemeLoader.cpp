@@ -0,0 +1,970 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AsyncSchemeLoader.h"
+#include "CEGUI/Threading.h"
+#include "CEGUI/XMLCompiler.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <map>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+template<> AsyncSchemeLoader* Singleton<AsyncSchemeLoader>::ms_Singleton = 0;
+
+//----------------------------------------------------------------------------//
+namespace
+{
+// Element and attribute names of the files whose references are followed.
+const String SchemeImagesetElement("Imageset");
+const String SchemeImagesetFromImageElement("ImagesetFromImage");
+const String SchemeFontElement("Font");
+const String SchemeLookNFeelElement("LookNFeel");
+const String SchemeFilenameAttribute("filename");
+const String SchemeResourceGroupAttribute("resourceGroup");
+const String ImagesetElement("Imageset");
+const String ImagesetImageFileAttribute("imagefile");
+const String ImagesetResourceGroupAttribute("resourceGroup");
+const String ImagesetTypeAttribute("type");
+const String ImagesetTypeBitmap("BitmapImage");
+const String FontElement("Font");
+const String FontTypeAttribute("type");
+const String FontTypeFreeType("FreeType");
+const String FontFilenameAttribute("filename");
+const String FontResourceGroupAttribute("resourceGroup");
+
+//----------------------------------------------------------------------------//
+//! A file referenced by an XML file.
+struct FileReference
+{
+    //! Kind of file, as given to ReferenceCollector::addElement.
+    int kind;
+    String filename;
+    String resourceGroup;
+};
+
+typedef std::vector<FileReference> FileReferenceList;
+
+/*!
+    XMLHandler that collects the files named by the elements it is told about.
+*/
+class ReferenceCollector : public XMLHandler
+{
+public:
+    ReferenceCollector(FileReferenceList& references) :
+        d_references(references)
+    {}
+
+    /*!
+        Collect references from elements named \a element, optionally only
+        those whose \a typeAttribute is \a requiredType (which is also the
+        attribute's default).
+    */
+    void addElement(const String& element, int kind,
+                    const String& filenameAttribute,
+                    const String& resourceGroupAttribute,
+                    const String& typeAttribute = "",
+                    const String& requiredType = "")
+    {
+        const ElementSpec spec = {element, kind, filenameAttribute,
+                                  resourceGroupAttribute, typeAttribute,
+                                  requiredType};
+        d_elements.push_back(spec);
+    }
+
+    const String& getDefaultResourceGroup() const
+    {
+        static const String empty;
+        return empty;
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes)
+    {
+        for (size_t i = 0; i < d_elements.size(); ++i)
+        {
+            const ElementSpec& spec = d_elements[i];
+            if (spec.element != element)
+                continue;
+
+            if (!spec.typeAttribute.empty() &&
+                attributes.getValueAsString(spec.typeAttribute,
+                                            spec.requiredType) != spec.requiredType)
+                continue;
+
+            FileReference reference;
+            reference.kind = spec.kind;
+            reference.filename =
+                attributes.getValueAsString(spec.filenameAttribute);
+            reference.resourceGroup =
+                attributes.getValueAsString(spec.resourceGroupAttribute);
+
+            if (!reference.filename.empty())
+                d_references.push_back(reference);
+        }
+    }
+
+private:
+    struct ElementSpec
+    {
+        String element;
+        int kind;
+        String filenameAttribute;
+        String resourceGroupAttribute;
+        String typeAttribute;
+        String requiredType;
+    };
+
+    FileReferenceList& d_references;
+    std::vector<ElementSpec> d_elements;
+};
+
+//----------------------------------------------------------------------------//
+/*!
+    Texture that only keeps a copy of the pixel data given to it, so that an
+    ImageCodec can decode into it without a Renderer being involved.
+*/
+class CapturingTexture : public Texture
+{
+public:
+    CapturingTexture() :
+        d_size(0, 0),
+        d_format(PF_RGBA),
+        d_texelScaling(0, 0)
+    {}
+
+    std::vector<uint8> d_pixels;
+    Sizef d_size;
+    PixelFormat d_format;
+
+    const String& getName() const { return d_name; }
+    const Sizef& getSize() const { return d_size; }
+    const Sizef& getOriginalDataSize() const { return d_size; }
+    const glm::vec2& getTexelScaling() const { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&)
+    {
+        CEGUI_THROW(InvalidRequestException(
+            "CapturingTexture can only be loaded from memory."));
+    }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format)
+    {
+        const size_t count = static_cast<size_t>(buffer_size.d_width) *
+                             static_cast<size_t>(buffer_size.d_height) *
+                             getBytesPerPixel(pixel_format);
+
+        const uint8* const data = static_cast<const uint8*>(buffer);
+        d_pixels.assign(data, data + count);
+        d_size = buffer_size;
+        d_format = pixel_format;
+    }
+
+    void blitFromMemory(const void*, const Rectf&) {}
+    void blitToMemory(void*) {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const
+    {
+        return getBytesPerPixel(fmt) != 0;
+    }
+
+private:
+    //! Return the size of a pixel in \a fmt, or 0 for compressed formats.
+    static size_t getBytesPerPixel(PixelFormat fmt)
+    {
+        switch (fmt)
+        {
+        case PF_RGB:
+            return 3;
+        case PF_RGBA:
+            return 4;
+        case PF_RGBA_4444:
+        case PF_RGB_565:
+            return 2;
+        default:
+            return 0;
+        }
+    }
+
+    String d_name;
+    glm::vec2 d_texelScaling;
+};
+
+}
+
+//----------------------------------------------------------------------------//
+// Impl struct: the worker pool and everything shared with it.
+struct AsyncSchemeLoader::Impl
+{
+    //! Kinds of file the workers prepare.
+    enum JobType
+    {
+        JT_Scheme,
+        JT_Imageset,
+        JT_Font,
+        JT_LookNFeel,
+        JT_ImageFile,
+        JT_FontFile
+    };
+
+    //! Book-keeping for one Request.
+    struct RequestState
+    {
+        Request* d_request;
+        //! Default groups for the files referenced, taken on the GUI thread.
+        String d_imagesetGroup;
+        String d_fontGroup;
+        String d_looknfeelGroup;
+        //! Number of jobs queued and finished; guarded by d_mutex.
+        uint d_queued;
+        uint d_done;
+        //! Whether the workers may use the ResourceProvider; otherwise the
+        //! files are loaded on the GUI thread and handed to the workers.
+        bool d_loadOnWorkers;
+    };
+
+    struct Job
+    {
+        JobType d_type;
+        String d_filename;
+        String d_resourceGroup;
+        RequestState* d_state;
+        //! Copy of the file loaded on the GUI thread, allocated with new[].
+        uint8* d_fileData;
+        size_t d_fileSize;
+    };
+
+    //! Data prepared for one file.
+    struct Item
+    {
+        Item() :
+            d_state(0),
+            d_ready(false),
+            d_fromProvider(false),
+            d_hasPixels(false),
+            d_size(0, 0),
+            d_format(Texture::PF_RGBA)
+        {}
+
+        //! Request the item was prepared for.
+        RequestState* d_state;
+        //! Whether a worker has finished with the item.
+        bool d_ready;
+        //! Compiled XML, or the file content as loaded by the provider.
+        RawDataContainer d_data;
+        //! Whether d_data came from the ResourceProvider.
+        bool d_fromProvider;
+        //! Decoded image.
+        bool d_hasPixels;
+        std::vector<uint8> d_pixels;
+        Sizef d_size;
+        Texture::PixelFormat d_format;
+    };
+
+    //! (resource group, filename) of a prepared file.
+    typedef std::pair<String, String> ItemKey;
+    typedef std::map<ItemKey, Item*> ItemMap;
+
+    Impl() :
+        d_shutdown(false),
+        d_decodeImages(true)
+    {}
+
+    //! Return whether images are decoded on the workers; d_mutex must be held.
+    bool canDecodeImages() const
+    {
+        return d_decodeImages &&
+               System::getSingleton().getImageCodec().isThreadSafe();
+    }
+
+    static void workerMain(void* impl);
+    void run();
+    void process(const Job& job);
+    //! Load the files of the jobs in d_loads and pass the jobs to the
+    //! workers; called on the GUI thread.
+    void loadFiles();
+    //! Queue a job unless the file is already known; d_mutex must be held.
+    void queue(JobType type, const String& filename, const String& group,
+               RequestState* state);
+    //! Release the data held by \a item and delete it.
+    static void destroyItem(Item* item);
+    //! Remove a ready item from d_items and return it, or 0 if there is none.
+    Item* takeItem(const String& filename, const String& group);
+
+    Mutex d_mutex;
+    Condition d_jobAvailable;
+    std::deque<Job> d_jobs;
+    //! Jobs whose file has to be loaded on the GUI thread first.
+    std::deque<Job> d_loads;
+    std::vector<Thread*> d_threads;
+    std::vector<RequestState*> d_states;
+    ItemMap d_items;
+    bool d_shutdown;
+    bool d_decodeImages;
+};
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::workerMain(void* impl)
+{
+    static_cast<Impl*>(impl)->run();
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::run()
+{
+    for (;;)
+    {
+        Job job;
+
+        {
+            MutexLock lock(d_mutex);
+
+            while (!d_shutdown && d_jobs.empty())
+                d_jobAvailable.wait(d_mutex);
+
+            if (d_shutdown)
+                return;
+
+            job = d_jobs.front();
+            d_jobs.pop_front();
+        }
+
+        process(job);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::process(const Job& job)
+{
+    // files loaded on the GUI thread are copies owned by the job, which the
+    // RawDataContainer releases itself; the provider is not used at all.
+    ResourceProvider* const provider = job.d_state->d_loadOnWorkers ?
+        System::getSingleton().getResourceProvider() : 0;
+
+    Item* result = new Item;
+    FileReferenceList references;
+    bool prepared = false;
+
+    // A failure only means the file is loaded on the GUI thread instead,
+    // where the error is reported in context; so errors are dropped here.
+    CEGUI_TRY
+    {
+        RawDataContainer raw;
+        if (provider)
+            provider->loadRawDataContainer(job.d_filename, raw, job.d_resourceGroup);
+        else
+        {
+            raw.setData(job.d_fileData);
+            raw.setSize(job.d_fileSize);
+        }
+
+        if (job.d_type == JT_FontFile)
+        {
+            // hand the provider's data over as it is.
+            result->d_data.setSize(raw.getSize());
+            if (raw.ownsData())
+                result->d_data.setData(raw.getDataPtr());
+            else
+                result->d_data.setExternalData(raw.getDataPtr());
+            result->d_fromProvider = true;
+
+            raw.setExternalData(0);
+            raw.setSize(0);
+        }
+        else if (job.d_type == JT_ImageFile)
+        {
+            CapturingTexture texture;
+
+            CEGUI_TRY
+            {
+                System::getSingleton().getImageCodec().load(raw, &texture);
+            }
+            CEGUI_CATCH(...)
+            {
+                if (provider)
+                    provider->unloadRawDataContainer(raw);
+                CEGUI_RETHROW;
+            }
+            if (provider)
+                provider->unloadRawDataContainer(raw);
+
+            if (!texture.d_pixels.empty())
+            {
+                result->d_pixels.swap(texture.d_pixels);
+                result->d_size = texture.d_size;
+                result->d_format = texture.d_format;
+                result->d_hasPixels = true;
+            }
+        }
+        else
+        {
+            CEGUI_TRY
+            {
+                XMLCompiler::compile(raw, result->d_data);
+            }
+            CEGUI_CATCH(...)
+            {
+                if (provider)
+                    provider->unloadRawDataContainer(raw);
+                CEGUI_RETHROW;
+            }
+            if (provider)
+                provider->unloadRawDataContainer(raw);
+
+            ReferenceCollector collector(references);
+
+            if (job.d_type == JT_Scheme)
+            {
+                collector.addElement(SchemeImagesetElement, JT_Imageset,
+                    SchemeFilenameAttribute, SchemeResourceGroupAttribute);
+                collector.addElement(SchemeImagesetFromImageElement, JT_ImageFile,
+                    SchemeFilenameAttribute, SchemeResourceGroupAttribute);
+                collector.addElement(SchemeFontElement, JT_Font,
+                    SchemeFilenameAttribute, SchemeResourceGroupAttribute);
+                collector.addElement(SchemeLookNFeelElement, JT_LookNFeel,
+                    SchemeFilenameAttribute, SchemeResourceGroupAttribute);
+            }
+            else if (job.d_type == JT_Imageset)
+            {
+                collector.addElement(ImagesetElement, JT_ImageFile,
+                    ImagesetImageFileAttribute, ImagesetResourceGroupAttribute,
+                    ImagesetTypeAttribute, ImagesetTypeBitmap);
+            }
+            else if (job.d_type == JT_Font)
+            {
+                collector.addElement(FontElement, JT_FontFile,
+                    FontFilenameAttribute, FontResourceGroupAttribute,
+                    FontTypeAttribute, FontTypeFreeType);
+            }
+
+            if (job.d_type != JT_LookNFeel)
+                XMLCompiler::parseCompiled(collector, result->d_data);
+        }
+
+        prepared = result->d_hasPixels || result->d_data.getDataPtr();
+    }
+    CEGUI_CATCH(...)
+    {
+        references.clear();
+    }
+
+    MutexLock lock(d_mutex);
+
+    ItemMap::iterator i =
+        d_items.find(ItemKey(job.d_resourceGroup, job.d_filename));
+
+    if (prepared && i != d_items.end() && !i->second->d_ready)
+    {
+        result->d_state = job.d_state;
+        result->d_ready = true;
+        delete i->second;
+        i->second = result;
+    }
+    else
+    {
+        destroyItem(result);
+
+        // nothing to hand over; let the GUI thread load the file itself.
+        if (i != d_items.end() && !i->second->d_ready)
+        {
+            delete i->second;
+            d_items.erase(i);
+        }
+    }
+
+    // Queue what the file refers to before the job counts as done, so the
+    // request can not look finished while work for it remains.
+    for (size_t r = 0; r < references.size(); ++r)
+    {
+        const JobType type = static_cast<JobType>(references[r].kind);
+        const String& group = references[r].resourceGroup;
+        const String* defaultGroup;
+
+        switch (type)
+        {
+        case JT_Font:
+        case JT_FontFile:
+            defaultGroup = &job.d_state->d_fontGroup;
+            break;
+
+        case JT_LookNFeel:
+            defaultGroup = &job.d_state->d_looknfeelGroup;
+            break;
+
+        default:
+            defaultGroup = &job.d_state->d_imagesetGroup;
+            break;
+        }
+
+        // images that are not decoded here are decoded on the GUI thread
+        // when the imageset is created.
+        if (type == JT_ImageFile && !canDecodeImages())
+            continue;
+
+        // font files are only handed over as the provider loaded them, so
+        // there is nothing to gain when the GUI thread has to load them.
+        if (type == JT_FontFile && !job.d_state->d_loadOnWorkers)
+            continue;
+
+        queue(type, references[r].filename,
+              group.empty() ? *defaultGroup : group, job.d_state);
+    }
+
+    ++job.d_state->d_done;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::queue(JobType type, const String& filename,
+                                    const String& group, RequestState* state)
+{
+    const ItemKey key(group, filename);
+
+    if (d_items.find(key) != d_items.end())
+        return;
+
+    Item* item = new Item;
+    item->d_state = state;
+    d_items[key] = item;
+
+    const Job job = {type, filename, group, state, 0, 0};
+    ++state->d_queued;
+
+    if (!state->d_loadOnWorkers)
+    {
+        d_loads.push_back(job);
+        return;
+    }
+
+    d_jobs.push_back(job);
+    d_jobAvailable.notifyOne();
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::loadFiles()
+{
+    std::deque<Job> loads;
+
+    {
+        MutexLock lock(d_mutex);
+        loads.swap(d_loads);
+    }
+
+    if (loads.empty())
+        return;
+
+    ResourceProvider* const provider =
+        System::getSingleton().getResourceProvider();
+
+    for (size_t j = 0; j < loads.size(); ++j)
+    {
+        Job& job = loads[j];
+
+        // a copy is handed over, so the provider's data is released here.
+        CEGUI_TRY
+        {
+            RawDataContainer raw;
+            provider->loadRawDataContainer(job.d_filename, raw,
+                                           job.d_resourceGroup);
+
+            if (raw.getDataPtr() && raw.getSize())
+            {
+                job.d_fileData = new uint8[raw.getSize()];
+                job.d_fileSize = raw.getSize();
+                std::memcpy(job.d_fileData, raw.getDataPtr(), raw.getSize());
+            }
+
+            provider->unloadRawDataContainer(raw);
+        }
+        CEGUI_CATCH(...)
+        {
+            // the file is loaded again, and the error reported, when the
+            // scheme is created.
+        }
+    }
+
+    MutexLock lock(d_mutex);
+
+    for (size_t j = 0; j < loads.size(); ++j)
+    {
+        const Job& job = loads[j];
+
+        if (job.d_fileData)
+        {
+            d_jobs.push_back(job);
+            d_jobAvailable.notifyOne();
+            continue;
+        }
+
+        // nothing to hand over; let the GUI thread load the file itself.
+        ItemMap::iterator i =
+            d_items.find(ItemKey(job.d_resourceGroup, job.d_filename));
+
+        if (i != d_items.end() && !i->second->d_ready)
+        {
+            delete i->second;
+            d_items.erase(i);
+        }
+
+        ++job.d_state->d_done;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::Impl::destroyItem(Item* item)
+{
+    if (item->d_fromProvider)
+        System::getSingleton().getResourceProvider()->
+            unloadRawDataContainer(item->d_data);
+    else
+        item->d_data.release();
+
+    delete item;
+}
+
+//----------------------------------------------------------------------------//
+AsyncSchemeLoader::Impl::Item* AsyncSchemeLoader::Impl::takeItem(
+    const String& filename, const String& group)
+{
+    ItemMap::iterator i = d_items.find(ItemKey(group, filename));
+
+    if (i == d_items.end() || !i->second->d_ready)
+        return 0;
+
+    Item* const item = i->second;
+    d_items.erase(i);
+
+    return item;
+}
+
+//----------------------------------------------------------------------------//
+AsyncSchemeLoader::Request::Request(const String& filename,
+                                    const String& resourceGroup) :
+    d_filename(filename),
+    d_resourceGroup(resourceGroup),
+    d_scheme(0),
+    d_complete(false),
+    d_failed(false),
+    d_progress(0.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+AsyncSchemeLoader::AsyncSchemeLoader(uint workerCount) :
+    d_pimpl(new Impl)
+{
+    if (workerCount == 0)
+        workerCount = Thread::getHardwareConcurrency();
+
+    CEGUI_TRY
+    {
+        for (uint i = 0; i < workerCount; ++i)
+            d_pimpl->d_threads.push_back(new Thread(&Impl::workerMain, d_pimpl));
+    }
+    CEGUI_CATCH(...)
+    {
+        // run with the threads we got, if any.
+        if (d_pimpl->d_threads.empty())
+        {
+            delete d_pimpl;
+            CEGUI_RETHROW;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+AsyncSchemeLoader::~AsyncSchemeLoader()
+{
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+        d_pimpl->d_shutdown = true;
+        d_pimpl->d_jobAvailable.notifyAll();
+    }
+
+    for (size_t i = 0; i < d_pimpl->d_threads.size(); ++i)
+        delete d_pimpl->d_threads[i];
+
+    for (size_t i = 0; i < d_pimpl->d_jobs.size(); ++i)
+        delete[] d_pimpl->d_jobs[i].d_fileData;
+
+    for (Impl::ItemMap::iterator i = d_pimpl->d_items.begin();
+         i != d_pimpl->d_items.end(); ++i)
+    {
+        Impl::destroyItem(i->second);
+    }
+
+    for (size_t i = 0; i < d_pimpl->d_states.size(); ++i)
+        delete d_pimpl->d_states[i];
+
+    for (size_t i = 0; i < d_requests.size(); ++i)
+        delete d_requests[i];
+
+    delete d_pimpl;
+}
+
+//----------------------------------------------------------------------------//
+const AsyncSchemeLoader::Request& AsyncSchemeLoader::loadScheme(
+    const String& filename, const String& resourceGroup)
+{
+    Request* const request = new Request(filename, resourceGroup);
+    d_requests.push_back(request);
+
+    // the defaults are read here since the managers are not thread safe.
+    Impl::RequestState* const state = new Impl::RequestState;
+    state->d_request = request;
+    state->d_imagesetGroup = ImageManager::getImagesetDefaultResourceGroup();
+    state->d_fontGroup = Font::getDefaultResourceGroup();
+    state->d_looknfeelGroup = WidgetLookManager::getDefaultResourceGroup();
+    state->d_queued = 0;
+    state->d_done = 0;
+    state->d_loadOnWorkers =
+        System::getSingleton().getResourceProvider()->isThreadSafe();
+
+    MutexLock lock(d_pimpl->d_mutex);
+    d_pimpl->d_states.push_back(state);
+    d_pimpl->queue(Impl::JT_Scheme, filename,
+                   resourceGroup.empty() ? Scheme::getDefaultResourceGroup() :
+                                           resourceGroup,
+                   state);
+
+    return *request;
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncSchemeLoader::update()
+{
+    d_pimpl->loadFiles();
+
+    bool idle = true;
+
+    for (size_t s = 0; s < d_pimpl->d_states.size(); ++s)
+    {
+        Impl::RequestState* const state = d_pimpl->d_states[s];
+        Request& request = *state->d_request;
+
+        if (request.d_complete)
+            continue;
+
+        {
+            MutexLock lock(d_pimpl->d_mutex);
+
+            request.d_progress = state->d_queued == 0 ? 1.0f :
+                static_cast<float>(state->d_done) / state->d_queued;
+
+            if (state->d_done != state->d_queued)
+            {
+                idle = false;
+                continue;
+            }
+        }
+
+        // everything is prepared; the normal loading path picks it up.
+        CEGUI_TRY
+        {
+            request.d_scheme = &SchemeManager::getSingleton().createFromFile(
+                request.d_filename, request.d_resourceGroup);
+        }
+        CEGUI_CATCH(const Exception& e)
+        {
+            request.d_failed = true;
+            request.d_errorMessage = e.getMessage();
+        }
+
+        request.d_complete = true;
+
+        // release whatever the load did not use.
+        MutexLock lock(d_pimpl->d_mutex);
+
+        for (Impl::ItemMap::iterator i = d_pimpl->d_items.begin();
+             i != d_pimpl->d_items.end();)
+        {
+            if (i->second->d_state == state)
+            {
+                Impl::destroyItem(i->second);
+                d_pimpl->d_items.erase(i++);
+            }
+            else
+                ++i;
+        }
+    }
+
+    return idle;
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncSchemeLoader::isIdle() const
+{
+    for (size_t i = 0; i < d_requests.size(); ++i)
+        if (!d_requests[i]->d_complete)
+            return false;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+uint AsyncSchemeLoader::getWorkerCount() const
+{
+    return static_cast<uint>(d_pimpl->d_threads.size());
+}
+
+//----------------------------------------------------------------------------//
+void AsyncSchemeLoader::setDecodeImagesOnWorkers(bool setting)
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    d_pimpl->d_decodeImages = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncSchemeLoader::isDecodingImagesOnWorkers() const
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    return d_pimpl->canDecodeImages();
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncSchemeLoader::takePreloadedXML(const String& filename,
+                                         const String& resourceGroup,
+                                         RawDataContainer& output)
+{
+    Impl::Item* item;
+
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+        item = d_pimpl->takeItem(filename, resourceGroup);
+    }
+
+    if (!item)
+        return false;
+
+    if (item->d_fromProvider || !item->d_data.getDataPtr())
+    {
+        Impl::destroyItem(item);
+        return false;
+    }
+
+    output.setData(item->d_data.getDataPtr());
+    output.setSize(item->d_data.getSize());
+    item->d_data.setData(0);
+    item->d_data.setSize(0);
+
+    delete item;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncSchemeLoader::takePreloadedFile(const String& filename,
+                                          const String& resourceGroup,
+                                          RawDataContainer& output)
+{
+    Impl::Item* item;
+
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+        item = d_pimpl->takeItem(filename, resourceGroup);
+    }
+
+    if (!item)
+        return false;
+
+    if (!item->d_fromProvider)
+    {
+        Impl::destroyItem(item);
+        return false;
+    }
+
+    output.setSize(item->d_data.getSize());
+    if (item->d_data.ownsData())
+        output.setData(item->d_data.getDataPtr());
+    else
+        output.setExternalData(item->d_data.getDataPtr());
+
+    item->d_data.setExternalData(0);
+    item->d_data.setSize(0);
+
+    delete item;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Texture* AsyncSchemeLoader::createPreloadedTexture(const String& name,
+                                                   const String& filename,
+                                                   const String& resourceGroup)
+{
+    Impl::Item* item;
+
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+        item = d_pimpl->takeItem(filename, resourceGroup);
+    }
+
+    if (!item)
+        return 0;
+
+    if (!item->d_hasPixels)
+    {
+        Impl::destroyItem(item);
+        return 0;
+    }
+
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    Texture* texture = 0;
+
+    CEGUI_TRY
+    {
+        texture = &renderer->createTexture(name);
+        texture->loadFromMemory(&item->d_pixels[0], item->d_size,
+                                item->d_format);
+    }
+    CEGUI_CATCH(...)
+    {
+        if (texture)
+            renderer->destroyTexture(*texture);
+
+        Impl::destroyItem(item);
+        CEGUI_RETHROW;
+    }
+
+    Impl::destroyItem(item);
+    return texture;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -97,8 +97,6 @@ void BitmapImage::setTexture(Texture* texture)
 void BitmapImage::render(std::vector<GeometryBuffer*>& geometry_buffers,
                          const ImageRenderSettings& render_settings) const
 {
-    const QuadSplitMode quad_split_mode(TopLeftToBottomRight);
-
     Rectf dest(render_settings.d_destArea);
     // apply rendering offset to the destination Rect
     dest.offset(d_scaledOffset);
@@ -124,76 +122,54 @@ void BitmapImage::render(std::vector<GeometryBuffer*>& geometry_buffers,
     final_rect.d_max.d_x = CoordConverter::alignToPixels(final_rect.d_max.d_x);
     final_rect.d_max.d_y = CoordConverter::alignToPixels(final_rect.d_max.d_y);
 
-    TexturedColouredVertex vbuffer[6];
+    TexturedColouredVertex vbuffer[4];
     const CEGUI::ColourRect&  colours = render_settings.d_multiplyColours;
 
-    // vertex 0
+    // top-left corner
     vbuffer[0].setColour(colours.d_top_left);
     vbuffer[0].d_position   = glm::vec3(final_rect.left(), final_rect.top(), 0.0f);
     vbuffer[0].d_texCoords = glm::vec2(tex_rect.left(), tex_rect.top());
 
-    // vertex 1
+    // bottom-left corner
     vbuffer[1].setColour(colours.d_bottom_left);
     vbuffer[1].d_position   = glm::vec3(final_rect.left(), final_rect.bottom(), 0.0f);
     vbuffer[1].d_texCoords = glm::vec2(tex_rect.left(), tex_rect.bottom());
 
-    // vertex 2
+    // bottom-right corner
     vbuffer[2].setColour(colours.d_bottom_right);
-    vbuffer[2].d_position.x   = final_rect.right();
-    vbuffer[2].d_position.z   = 0.0f;
-    vbuffer[2].d_texCoords.x = tex_rect.right();
-
-    // top-left to bottom-right diagonal
-    if (quad_split_mode == TopLeftToBottomRight)
-    {
-        vbuffer[2].d_position.y   = final_rect.bottom();
-        vbuffer[2].d_texCoords.y = tex_rect.bottom();
-    }
-    // bottom-left to top-right diagonal
-    else
-    {
-        vbuffer[2].d_position.y   = final_rect.top();
-        vbuffer[2].d_texCoords.y = tex_rect.top();
-    }
+    vbuffer[2].d_position   = glm::vec3(final_rect.right(), final_rect.bottom(), 0.0f);
+    vbuffer[2].d_texCoords = glm::vec2(tex_rect.right(), tex_rect.bottom());
 
-    // vertex 3
+    // top-right corner
     vbuffer[3].setColour(colours.d_top_right);
     vbuffer[3].d_position   = glm::vec3(final_rect.right(), final_rect.top(), 0.0f);
     vbuffer[3].d_texCoords = glm::vec2(tex_rect.right(), tex_rect.top());
 
-    // vertex 4
-    vbuffer[4].setColour(colours.d_top_left);
-    vbuffer[4].d_position.x   = final_rect.left();
-    vbuffer[4].d_position.z   = 0.0f;
-    vbuffer[4].d_texCoords.x = tex_rect.left();
+    // Append to the previously added buffer where that does not change the
+    // result, so that strings of glyphs and the parts of frames share one
+    // buffer instead of each requiring their own.
+    const bool clipping_enabled = render_settings.d_clippingEnabled;
+    const Rectf& clip_region = clipping_enabled ? *clip_area : final_rect;
 
-    // top-left to bottom-right diagonal
-    if (quad_split_mode == TopLeftToBottomRight)
-    {
-        vbuffer[4].d_position.y   = final_rect.top();
-        vbuffer[4].d_texCoords.y = tex_rect.top();
-    }
-    // bottom-left to top-right diagonal
-    else
+    CEGUI::GeometryBuffer* buffer =
+        geometry_buffers.empty() ? 0 : geometry_buffers.back();
+
+    if (!buffer || !buffer->isBatchCompatible(d_texture, clipping_enabled,
+                                              clip_region,
+                                              render_settings.d_alpha))
     {
-        vbuffer[4].d_position.y   = final_rect.bottom();
-        vbuffer[4].d_texCoords.y = tex_rect.bottom();
+        buffer = &System::getSingleton().getRenderer()->createGeometryBufferTextured();
+        geometry_buffers.push_back(buffer);
+
+        buffer->setClippingActive(clipping_enabled);
+        if(clipping_enabled)
+            buffer->setClippingRegion(clip_region);
+        buffer->setTexture("texture0", d_texture);
+        buffer->setAlpha(render_settings.d_alpha);
     }
 
-    // vertex 5
-    vbuffer[5].setColour(colours.d_bottom_right);
-    vbuffer[5].d_position     = glm::vec3(final_rect.right(), final_rect.bottom(), 0.0f);
-    vbuffer[5].d_texCoords   = glm::vec2(tex_rect.right(), tex_rect.bottom());
-
-    CEGUI::GeometryBuffer& buffer = System::getSingleton().getRenderer()->createGeometryBufferTextured();
-    geometry_buffers.push_back(&buffer);
-
-    buffer.setClippingActive(render_settings.d_clippingEnabled);
-    if(render_settings.d_clippingEnabled)
-        buffer.setClippingRegion(*render_settings.d_clipArea);
-    buffer.setTexture("texture0", d_texture);
-    buffer.appendGeometry(vbuffer, 6);
-    buffer.setAlpha(render_settings.d_alpha);
+    // the quad is split from top-left to bottom-right
+    buffer->appendQuads(vbuffer, 1);
 }
 
 
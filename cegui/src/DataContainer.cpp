@@ -36,11 +36,14 @@ void RawDataContainer::release(void)
 {
     if (mData)
     {
-        delete[] mData;
+        if (mOwnsData)
+            delete[] mData;
 
         mData = 0;
         mSize = 0;
     }
+
+    mOwnsData = true;
 }
 
 } // End of  CEGUI namespace section
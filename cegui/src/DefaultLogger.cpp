@@ -33,17 +33,95 @@
 #   include <android/log.h> 
 #else
 #   include <ctime>
-#   include <iomanip>
+#   include <cstdio>
 #endif
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+const size_t DefaultLogger::AsynchronousQueueCapacity = 1024;
+
+#ifndef __ANDROID__
+//----------------------------------------------------------------------------//
+// Format a log entry with date, time and level code into 'entry'.  Returns
+// false if the local time could not be obtained.
+static bool formatLogEntry(std::string& entry, const String& message,
+                           LoggingLevel level)
+{
+    time_t et;
+    time(&et);
+
+    // localtime is not safe to use from several threads.
+    tm etm;
+#   if defined(_MSC_VER)
+    if (localtime_s(&etm, &et) != 0)
+        return false;
+#   elif defined(__WIN32__) || defined(_WIN32)
+    const tm* const local_tm = localtime(&et);
+    if (!local_tm)
+        return false;
+    etm = *local_tm;
+#   else
+    if (!localtime_r(&et, &etm))
+        return false;
+#   endif
+
+    const char* code;
+    switch(level)
+    {
+    case Errors:
+        code = "(Error)\t";
+        break;
+
+    case Warnings:
+        code = "(Warn)\t";
+        break;
+
+    case Standard:
+        code = "(Std) \t";
+        break;
+
+    case Informative:
+        code = "(Info) \t";
+        break;
+
+    case Insane:
+        code = "(Insan)\t";
+        break;
+
+    default:
+        code = "(Unkwn)\t";
+        break;
+    }
+
+    // write date, time and event type code
+    char header[64];
+    sprintf(header, "%02d/%02d/%04d %02d:%02d:%02d %s",
+            etm.tm_mday, 1 + etm.tm_mon, 1900 + etm.tm_year,
+            etm.tm_hour, etm.tm_min, etm.tm_sec, code);
+
+    entry = header;
+    entry += message.c_str();
+    entry += '\n';
+
+    return true;
+}
+#endif
+
 //----------------------------------------------------------------------------//
 DefaultLogger::DefaultLogger(void) 
 #ifndef __ANDROID__
-   : d_caching(true)
+   : d_caching(true),
+     d_entriesInProgress(0),
+     d_writerThread(0),
+     d_stopWriter(false)
 #endif
 {
+#ifndef __ANDROID__
+    // entries of every level are cached until the log file is set.
+    d_keepingAllLevels = true;
+#endif
+
     // create log header
     logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+");
     logEvent("+                     Crazy Eddie's GUI System - Event log                    +");
@@ -60,6 +138,8 @@ DefaultLogger::DefaultLogger(void)
 DefaultLogger::~DefaultLogger(void)
 {
 #ifndef __ANDROID__
+    stopWriterThread();
+
     if (d_ostream.is_open())
     {
         char addr_buff[32];
@@ -75,70 +155,57 @@ void DefaultLogger::logEvent(const String& message,
                              LoggingLevel level /* = Standard */)
 {
 #ifndef __ANDROID__
-    using namespace std;
+    {
+        MutexLock lock(d_mutex);
 
-    time_t et;
-    time(&et);
-    tm* etm = localtime(&et);
+        // don't format entries that would be dropped.
+        if (!d_caching && !isLoggingLevelEnabled(level))
+            return;
+    }
 
-    if (!etm)
+    std::string entry;
+    if (!formatLogEntry(entry, message, level))
         return;
 
-    // clear sting stream
-    d_workstream.str("");
-
-    // write date
-    d_workstream << setfill('0') << setw(2) << etm->tm_mday << '/' <<
-    setfill('0') << setw(2) << 1 + etm->tm_mon << '/' <<
-    setw(4) << (1900 + etm->tm_year) << ' ';
-
-    // write time
-    d_workstream << setfill('0') << setw(2) << etm->tm_hour << ':' <<
-    setfill('0') << setw(2) << etm->tm_min << ':' <<
-    setfill('0') << setw(2) << etm->tm_sec << ' ';
-
-    // write event type code
-    switch(level)
     {
-    case Errors:
-        d_workstream << "(Error)\t";
-        break;
+        MutexLock lock(d_mutex);
 
-    case Warnings:
-        d_workstream << "(Warn)\t";
-        break;
-
-    case Standard:
-        d_workstream << "(Std) \t";
-        break;
+        // entries are cached whatever their level, since the level may
+        // still be changed before the log file is set.
+        if (d_caching)
+        {
+            d_cache.push_back(std::make_pair(std::string(), level));
+            d_cache.back().first.swap(entry);
+            return;
+        }
 
-    case Informative:
-        d_workstream << "(Info) \t";
-        break;
+        if (!isLoggingLevelEnabled(level))
+            return;
 
-    case Insane:
-        d_workstream << "(Insan)\t";
-        break;
+        if (d_writerThread)
+        {
+            while (d_writerThread &&
+                   d_queue.size() >= AsynchronousQueueCapacity)
+                d_entriesTaken.wait(d_mutex);
 
-    default:
-        d_workstream << "(Unkwn)\t";
-        break;
+            // the writer may have been stopped while we waited, in which
+            // case the entry is written below instead.
+            if (d_writerThread)
+            {
+                d_queue.push_back(std::string());
+                d_queue.back().swap(entry);
+                d_entriesQueued.notifyOne();
+                return;
+            }
+        }
     }
 
-    d_workstream << message << endl;
-
-    if (d_caching)
-    {
-        d_cache.push_back(std::make_pair(d_workstream.str().c_str(), level));
-    }
-    else if (d_level >= level)
-    {
-        // write message
-        d_ostream << d_workstream.str();
-        // ensure new event is written to the file, rather than just being
-        // buffered.
-        d_ostream.flush();
-    }
+    MutexLock stream_lock(d_streamMutex);
+    // write message
+    d_ostream << entry;
+    // ensure new event is written to the file, rather than just being
+    // buffered.
+    d_ostream.flush();
 #else
     std::string logName = "CEGUILog";
     switch (level) {
@@ -168,6 +235,11 @@ void DefaultLogger::logEvent(const String& message,
 void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
 #ifndef __ANDROID__
+    // entries already queued belong to the current log file.
+    flush();
+
+    MutexLock stream_lock(d_streamMutex);
+
     // close current log file (if any)
     if (d_ostream.is_open())
         d_ostream.close();
@@ -190,33 +262,169 @@ void DefaultLogger::setLogFilename(const String& filename, bool append)
     // initialise width for date & time alignment.
     d_ostream.width(2);
 
-    // write out cached log strings.
-    if (d_caching)
+    // take the cached log strings; entries logged from now on are written
+    // directly, but cannot reach the stream before the cache does since we
+    // hold the stream mutex.
+    Cache cache;
     {
+        MutexLock lock(d_mutex);
+
+        if (!d_caching)
+            return;
+
         d_caching = false;
+        d_keepingAllLevels = false;
+        cache.swap(d_cache);
+    }
+
+    // write out cached log strings.
+    for (Cache::const_iterator iter = cache.begin(); iter != cache.end(); ++iter)
+    {
+        if (isLoggingLevelEnabled((*iter).second))
+            d_ostream << (*iter).first;
+    }
+
+    // ensure cached events are written to the file, rather than just being
+    // buffered.
+    d_ostream.flush();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::setAsynchronousWriting(bool setting)
+{
+#ifndef __ANDROID__
+    if (setting == isWritingAsynchronously())
+        return;
+
+    if (setting)
+        startWriterThread();
+    else
+        stopWriterThread();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultLogger::isWritingAsynchronously() const
+{
+#ifndef __ANDROID__
+    MutexLock lock(d_mutex);
+    return d_writerThread != 0;
+#else
+    return false;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::flush()
+{
+#ifndef __ANDROID__
+    MutexLock lock(d_mutex);
+
+    while (d_writerThread && (!d_queue.empty() || d_entriesInProgress != 0))
+        d_entriesTaken.wait(d_mutex);
+#endif
+}
+
+#ifndef __ANDROID__
+//----------------------------------------------------------------------------//
+void DefaultLogger::writeEntries(const std::vector<std::string>& entries)
+{
+    if (entries.empty())
+        return;
+
+    MutexLock stream_lock(d_streamMutex);
 
-        Cache::iterator iter = d_cache.begin();
+    for (std::vector<std::string>::const_iterator iter = entries.begin();
+         iter != entries.end(); ++iter)
+    {
+        d_ostream << *iter;
+    }
+
+    // one flush per batch rather than per entry.
+    d_ostream.flush();
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::startWriterThread()
+{
+    d_stopWriter = false;
+    Thread* const thread = new Thread(&DefaultLogger::writerThreadMain, this);
+
+    MutexLock lock(d_mutex);
+    d_writerThread = thread;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::stopWriterThread()
+{
+    Thread* thread;
+    {
+        MutexLock lock(d_mutex);
+
+        thread = d_writerThread;
+        if (!thread)
+            return;
+
+        d_stopWriter = true;
+        d_entriesQueued.notifyAll();
+    }
+
+    thread->join();
+
+    // entries queued after the writer made its last check are written here.
+    std::vector<std::string> remaining;
+    {
+        MutexLock lock(d_mutex);
 
-        while (iter != d_cache.end())
+        d_writerThread = 0;
+        d_stopWriter = false;
+        remaining.assign(d_queue.begin(), d_queue.end());
+        d_queue.clear();
+        d_entriesTaken.notifyAll();
+    }
+
+    writeEntries(remaining);
+    delete thread;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::writerThreadMain(void* logger)
+{
+    DefaultLogger& self = *static_cast<DefaultLogger*>(logger);
+    std::vector<std::string> entries;
+
+    for (;;)
+    {
         {
-            if (d_level >= (*iter).second)
-            {
-                // write message
-                d_ostream << (*iter).first;
-                // ensure new event is written to the file, rather than just
-                // being buffered.
-                d_ostream.flush();
-            }
+            MutexLock lock(self.d_mutex);
 
-            ++iter;
+            while (self.d_queue.empty() && !self.d_stopWriter)
+                self.d_entriesQueued.wait(self.d_mutex);
+
+            if (self.d_queue.empty())
+                return;
+
+            entries.resize(self.d_queue.size());
+            for (size_t i = 0; i < entries.size(); ++i)
+                entries[i].swap(self.d_queue[i]);
+
+            self.d_queue.clear();
+            self.d_entriesInProgress = entries.size();
+            self.d_entriesTaken.notifyAll();
         }
 
-        d_cache.clear();
+        self.writeEntries(entries);
+
+        {
+            MutexLock lock(self.d_mutex);
+            self.d_entriesInProgress = 0;
+            self.d_entriesTaken.notifyAll();
+        }
     }
-#endif
 }
+#endif
 
 //----------------------------------------------------------------------------//
 
 }
-
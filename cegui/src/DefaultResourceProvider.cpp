@@ -113,6 +113,13 @@ void DefaultResourceProvider::unloadRawDataContainer(RawDataContainer& data)
     data.release();
 }
 
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::isThreadSafe() const
+{
+    // the resource group directories are only read while loading.
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::setResourceGroupDirectory(
                                                 const String& resourceGroup,
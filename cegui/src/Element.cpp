@@ -570,14 +570,16 @@ void Element::addChild_impl(Element* element)
 //----------------------------------------------------------------------------//
 void Element::removeChild_impl(Element* element)
 {
-    // find this element in the child list
-    ChildList::iterator it = std::find(d_children.begin(), d_children.end(), element);
+    // find this element in the child list, searching from the back where
+    // children are most often removed from.
+    ChildList::reverse_iterator it =
+        std::find(d_children.rbegin(), d_children.rend(), element);
 
     // if the element was found in the child list
-    if (it != d_children.end())
+    if (it != d_children.rend())
     {
         // remove element from child list
-        d_children.erase(it);
+        d_children.erase(it.base() - 1);
         // reset element's parent so it's no longer this element.
         element->setParent(0);
     }
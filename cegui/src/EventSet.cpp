@@ -37,7 +37,8 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 EventSet::EventSet() :
-    d_muted(false)
+    d_muted(false),
+    d_eventsVersion(0)
 {
 }
 
@@ -67,6 +68,7 @@ void EventSet::addEvent(Event& event)
     }
 
     d_events.insert(std::make_pair(name, &event));
+    ++d_eventsVersion;
 }
 
 //----------------------------------------------------------------------------//
@@ -78,6 +80,7 @@ void EventSet::removeEvent(const String& name)
 	{
 		delete pos->second;
 		d_events.erase(pos);
+        ++d_eventsVersion;
 	}
 }
 
@@ -97,6 +100,7 @@ void EventSet::removeAllEvents(void)
 		delete pos->second;
 
     d_events.clear();
+    ++d_eventsVersion;
 }
 
 //----------------------------------------------------------------------------//
@@ -191,9 +195,11 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
 {
-    Event* ev = getEventObject(name);
+    // most events fired have no subscribers, avoid the lookup when possible
+    if (d_muted || d_events.empty())
+        return;
 
-    if ((ev != 0) && !d_muted)
+    if (Event* ev = getEventObject(name))
         (*ev)(args);
 }
 
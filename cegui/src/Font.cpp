@@ -42,6 +42,7 @@ namespace CEGUI
 
 //----------------------------------------------------------------------------//
 const argb_t Font::DefaultColour = 0xFFFFFFFF;
+const utf32 Font::GlyphIndexPageSize;
 String Font::d_defaultResourceGroup;
 
 //----------------------------------------------------------------------------//
@@ -81,6 +82,8 @@ Font::~Font()
 
         delete[] d_glyphPageLoaded;
     }
+
+    clearFontGlyphs();
 }
 
 //----------------------------------------------------------------------------//
@@ -152,6 +155,10 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
 
     const FontGlyph* const glyph = findFontGlyph(codepoint);
 
+    // glyphs that have imagery need no further preparation
+    if (glyph && glyph->getImage())
+        return glyph;
+
     if (d_glyphPageLoaded)
     {
         // Check if glyph page has been rasterised
@@ -171,17 +178,50 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
 //----------------------------------------------------------------------------//
 const FontGlyph* Font::findFontGlyph(const utf32 codepoint) const
 {
-    CodepointMap::const_iterator pos = d_cp_map.find(codepoint);
-    return (pos != d_cp_map.end()) ? &pos->second : 0;
+    return findIndexedGlyph(codepoint);
+}
+
+//----------------------------------------------------------------------------//
+FontGlyph& Font::addFontGlyph(const utf32 codepoint, const FontGlyph& glyph)
+{
+    FontGlyph& stored = d_cp_map[codepoint] = glyph;
+
+    const size_t page = codepoint / GlyphIndexPageSize;
+    if (page >= d_glyphIndex.size())
+        d_glyphIndex.resize(page + 1, 0);
+
+    if (!d_glyphIndex[page])
+    {
+        d_glyphIndex[page] = new FontGlyph*[GlyphIndexPageSize];
+        std::fill(d_glyphIndex[page], d_glyphIndex[page] + GlyphIndexPageSize,
+                  static_cast<FontGlyph*>(0));
+    }
+
+    d_glyphIndex[page][codepoint % GlyphIndexPageSize] = &stored;
+
+    return stored;
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextExtent(const String& text, float x_scale) const
+void Font::clearFontGlyphs()
+{
+    d_cp_map.clear();
+
+    for (size_t i = 0; i < d_glyphIndex.size(); ++i)
+        delete[] d_glyphIndex[i];
+    d_glyphIndex.clear();
+}
+
+//----------------------------------------------------------------------------//
+float Font::getTextExtent(const String& text, size_t start_char, size_t length,
+                          float x_scale) const
 {
     const FontGlyph* glyph;
     float cur_extent = 0, adv_extent = 0, width;
+    const size_t end_char =
+        ceguimin(text.length(), start_char + ceguimin(length, text.length()));
 
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = start_char; c < end_char; ++c)
     {
         glyph = getGlyphData(text[c]);
 
@@ -200,11 +240,14 @@ float Font::getTextExtent(const String& text, float x_scale) const
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextAdvance(const String& text, float x_scale) const
+float Font::getTextAdvance(const String& text, size_t start_char, size_t length,
+                           float x_scale) const
 {
     float advance = 0.0f;
+    const size_t end_char =
+        ceguimin(text.length(), start_char + ceguimin(length, text.length()));
 
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = start_char; c < end_char; ++c)
     {
         if (const FontGlyph* glyph = getGlyphData(text[c]))
             advance += glyph->getAdvance(x_scale);
@@ -282,6 +325,11 @@ void Font::setNativeResolution(const Sizef& size)
         System::getSingleton().getRenderer()->getDisplaySize());
 }
 
+//----------------------------------------------------------------------------//
+void Font::notifyFrameStarted()
+{
+}
+
 //----------------------------------------------------------------------------//
 const Sizef& Font::getNativeResolution() const
 {
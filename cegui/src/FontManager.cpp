@@ -129,6 +129,15 @@ void FontManager::notifyDisplaySizeChanged(const Sizef& size)
         pos->second->notifyDisplaySizeChanged(size);
 }
 
+//----------------------------------------------------------------------------//
+void FontManager::notifyFrameStarted()
+{
+    ObjectRegistry::iterator pos = d_objects.begin(), end = d_objects.end();
+
+    for (; pos != end; ++pos)
+        pos->second->notifyFrameStarted();
+}
+
 //----------------------------------------------------------------------------//
 FontManager::FontIterator FontManager::getIterator(void) const
 {
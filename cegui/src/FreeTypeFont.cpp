@@ -31,6 +31,7 @@
 #include "CEGUI/Texture.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/System.h"
+#include "CEGUI/AsyncSchemeLoader.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Font_xmlHandler.h"
@@ -51,6 +52,9 @@ namespace CEGUI
 // A multiplication coefficient to convert FT_Pos values into normal floats
 #define FT_POS_COEF  (1.0/64.0)
 
+//----------------------------------------------------------------------------//
+const uint FreeTypeFont::DefaultMaxGlyphPageCount = 16;
+
 //----------------------------------------------------------------------------//
 // Font objects usage count
 static int ft_usage_count = 0;
@@ -76,7 +80,12 @@ FreeTypeFont::FreeTypeFont(const String& font_name, const float point_size,
     d_specificLineSpacing(specific_line_spacing),
     d_ptSize(point_size),
     d_antiAliased(anti_aliased),
-    d_fontFace(0)
+    d_fontFace(0),
+    d_glyphPageSize(0),
+    d_maxGlyphPages(DefaultMaxGlyphPageCount),
+    d_glyphPagesCreated(0),
+    d_glyphUseCounter(0),
+    d_frameStartGlyphUse(0)
 {
     if (!ft_usage_count++)
         FT_Init_FreeType(&ft_lib);
@@ -118,198 +127,338 @@ void FreeTypeFont::addFreeTypeFontProperties ()
 }
 
 //----------------------------------------------------------------------------//
-uint FreeTypeFont::getTextureSize(CodepointMap::const_iterator s,
-                                  CodepointMap::const_iterator e) const
+void FreeTypeFont::rasterise(utf32, utf32) const
+{
+    // Glyphs are rasterised individually as they are first looked up via
+    // findFontGlyph, so a request for a whole page of 256 codepoints (which
+    // for a CJK font could mean rasterising 256 glyphs that will likely never
+    // be used) is deliberately ignored.  Use prewarmGlyphs to rasterise a set
+    // of glyphs up front.
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::prewarmGlyphs(const String& codepoints) const
+{
+    for (size_t c = 0; c < codepoints.length(); ++c)
+        findFontGlyph(codepoints[c]);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::prewarmGlyphs(utf32 start_codepoint,
+                                 utf32 end_codepoint) const
+{
+    CodepointMap::iterator s = d_cp_map.lower_bound(start_codepoint);
+    const CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
+
+    for ( ; s != e; ++s)
+        findFontGlyph(s->first);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setMaxGlyphPageCount(const uint count)
+{
+    if (count == 0)
+        CEGUI_THROW(InvalidRequestException(
+            "A font needs at least one glyph page."));
+
+    d_maxGlyphPages = count;
+    releaseExcessGlyphPages(false);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::notifyFrameStarted()
 {
-    uint texsize = 32; // start with 32x32
-    uint max_texsize = System::getSingleton().getRenderer()->getMaxTextureSize();
-    uint glyph_count = 0;
+    // the pages added while the last frame was drawn are released here, where
+    // invalidating the cached rendering cannot affect a frame in progress.
+    releaseExcessGlyphPages(true);
+    d_frameStartGlyphUse = d_glyphUseCounter;
+}
 
-    // Compute approximatively the optimal texture size for font
-    while (texsize < max_texsize)
+//----------------------------------------------------------------------------//
+void FreeTypeFont::releaseExcessGlyphPages(bool keep_recent)
+{
+    bool released = false;
+
+    while (d_glyphPages.size() > d_maxGlyphPages)
     {
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-        for (CodepointMap::const_iterator c = s; c != e; ++c)
-        {
-            // skip glyphs that are already rendered
-            if (c->second.getImage())
-                continue;
-
-            // load glyph metrics (don't render)
-            if (FT_Load_Char(d_fontFace, c->first,
-                             FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT))
-                continue;
-
-            uint glyph_w = int (ceil(d_fontFace->glyph->metrics.width * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-            uint glyph_h = int (ceil(d_fontFace->glyph->metrics.height * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-
-            x += glyph_w;
-            if (x > texsize)
-            {
-                x = INTER_GLYPH_PAD_SPACE;
-                y = yb;
-            }
-            uint yy = y + glyph_h;
-            if (yy > texsize)
-                goto too_small;
+        GlyphPageVector::iterator lru = d_glyphPages.begin();
+        for (GlyphPageVector::iterator i = lru + 1; i != d_glyphPages.end(); ++i)
+            if ((*i)->d_lastUsed < (*lru)->d_lastUsed)
+                lru = i;
 
-            if (yy > yb)
-                yb = yy;
+        if (keep_recent && (*lru)->d_lastUsed > d_frameStartGlyphUse)
+            break;
 
-            ++glyph_count;
-        }
-        // Okay, the texture size is enough for holding our glyphs
-        break;
+        evictGlyphPage(**lru);
+        System::getSingleton().getRenderer()->destroyTexture(*(*lru)->d_texture);
+        delete *lru;
+        const GlyphPageVector::iterator moved = d_glyphPages.erase(lru);
+        released = true;
+
+        // the pages after the released one moved down one place.
+        for (GlyphPageVector::iterator i = moved; i != d_glyphPages.end(); ++i)
+            setGlyphPageIndex(**i, static_cast<uint>(i - d_glyphPages.begin()));
+    }
 
-    too_small:
+    // geometry that is already cached may reference the evicted glyphs.
+    if (released)
+        System::getSingleton().invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setGlyphPageIndex(GlyphPage& page, uint index) const
+{
+    page.d_index = index;
+
+    for (size_t i = 0; i < page.d_codepoints.size(); ++i)
+        if (FontGlyph* glyph = findIndexedGlyph(page.d_codepoints[i]))
+            glyph->setPageIndex(index);
+}
+
+//----------------------------------------------------------------------------//
+uint FreeTypeFont::getMaxGlyphPageCount() const
+{
+    return d_maxGlyphPages;
+}
+
+//----------------------------------------------------------------------------//
+uint FreeTypeFont::getGlyphPageCount() const
+{
+    return static_cast<uint>(d_glyphPages.size());
+}
+
+//----------------------------------------------------------------------------//
+uint FreeTypeFont::getGlyphPageSize() const
+{
+    return d_glyphPageSize;
+}
+
+//----------------------------------------------------------------------------//
+uint FreeTypeFont::calculateGlyphPageSize() const
+{
+    const uint max_texsize =
+        System::getSingleton().getRenderer()->getMaxTextureSize();
+
+    // enough room for a 16 x 16 grid of glyphs the size of a line.
+    const uint cell_size = static_cast<uint>(
+        ceil(d_fontFace->size->metrics.height * FT_POS_COEF)) +
+        INTER_GLYPH_PAD_SPACE;
+
+    uint texsize = 32;
+    while (texsize < cell_size * 16 && texsize < max_texsize)
         texsize *= 2;
+
+    return ceguimin(texsize, max_texsize);
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeFont::GlyphPage* FreeTypeFont::createGlyphPage() const
+{
+    const String texture_name(d_name + "_auto_glyph_images_" +
+        PropertyHelper<uint>::toString(d_glyphPagesCreated++));
+
+    GlyphPage* page = new GlyphPage;
+    page->d_texture = &System::getSingleton().getRenderer()->createTexture(
+        texture_name, Sizef(static_cast<float>(d_glyphPageSize),
+                            static_cast<float>(d_glyphPageSize)));
+    page->d_lastUsed = d_glyphUseCounter;
+    page->d_index = static_cast<uint>(d_glyphPages.size());
+    d_glyphPages.push_back(page);
+
+    clearGlyphPageTexture(*page);
+
+    return page;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::clearGlyphPageTexture(GlyphPage& page) const
+{
+    // the padding around glyphs is never written again, so it must be
+    // transparent for filtering at the glyph edges to work.
+    std::vector<argb_t> mem_buffer(d_glyphPageSize * d_glyphPageSize, 0);
+    page.d_texture->loadFromMemory(&mem_buffer[0],
+        Sizef(static_cast<float>(d_glyphPageSize),
+              static_cast<float>(d_glyphPageSize)),
+        Texture::PF_RGBA);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::evictGlyphPage(GlyphPage& page) const
+{
+    for (size_t i = 0; i < page.d_codepoints.size(); ++i)
+    {
+        FontGlyph* glyph = findIndexedGlyph(page.d_codepoints[i]);
+        if (!glyph)
+            continue;
+
+        delete glyph->getImage();
+        glyph->setImage(0);
     }
 
-    return glyph_count ? texsize : 0;
+    page.d_codepoints.clear();
+    page.d_shelves.clear();
 }
 
 //----------------------------------------------------------------------------//
-void FreeTypeFont::rasterise(utf32 start_codepoint, utf32 end_codepoint) const
+bool FreeTypeFont::allocateGlyphArea(GlyphPage& page, uint page_size,
+                                     uint width, uint height, uint& x, uint& y)
 {
-    CodepointMap::iterator s = d_cp_map.lower_bound(start_codepoint);
-    if (s == d_cp_map.end())
-        return;
+    // Use the shelf that fits the area most tightly; avoid shelves much taller
+    // than the area while there is still room to start a new shelf.
+    GlyphShelf* best = 0;
+    for (size_t i = 0; i < page.d_shelves.size(); ++i)
+    {
+        GlyphShelf& shelf = page.d_shelves[i];
+        if (shelf.d_height >= height && shelf.d_height <= height + height / 2 &&
+            shelf.d_used + width <= page_size &&
+            (!best || shelf.d_height < best->d_height))
+                best = &shelf;
+    }
 
-    CodepointMap::iterator orig_s = s;
-    CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
-    while (true)
+    if (!best)
     {
-        // Create a new Imageset for glyphs
-        uint texsize = getTextureSize(s, e);
-        // If all glyphs were already rendered, do nothing
-        if (!texsize)
-            break;
+        const uint top = page.d_shelves.empty() ? INTER_GLYPH_PAD_SPACE :
+            page.d_shelves.back().d_top + page.d_shelves.back().d_height;
 
-        const String texture_name(d_name + "_auto_glyph_images_" +
-                                   PropertyHelper<int>::toString(s->first));
-        Texture& texture = System::getSingleton().getRenderer()->createTexture(
-            texture_name, Sizef(static_cast<float>(texsize), static_cast<float>(texsize)));
-        d_glyphTextures.push_back(&texture);
-
-        // Create a memory buffer where we will render our glyphs
-        argb_t* mem_buffer = new argb_t[texsize * texsize];
-        memset(mem_buffer, 0, texsize * texsize * sizeof(argb_t));
-
-        // Go ahead, line by line, top-left to bottom-right
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-
-        // Set to true when we finish rendering all glyphs we were asked to
-        bool finished = false;
-        // Set to false when we reach d_cp_map.end() and we start going backward
-        bool forward = true;
-
-        /* To conserve texture space we will render more glyphs than asked,
-         * but never less than asked. First we render all glyphs from s to e
-         * and after that we render glyphs until we reach d_cp_map.end(),
-         * and if there's still free texture space we will go backward
-         * from s until we hit d_cp_map.begin().
-         */
-        while (s != d_cp_map.end())
+        if (top + height <= page_size && INTER_GLYPH_PAD_SPACE + width <= page_size)
         {
-            // Check if we finished rendering all the required glyphs
-            finished |= (s == e);
-
-            // Check if glyph already rendered
-            if (!s->second.getImage())
-            {
-                // Render the glyph
-                if (FT_Load_Char(d_fontFace, s->first, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
-                                 (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
-                {
-                    std::stringstream err;
-                    err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
-                    err << static_cast<unsigned int>(s->first);
-                    err << ".  Will use an empty image for this glyph!";
-                    Logger::getSingleton().logEvent(err.str().c_str(), Errors);
-
-                    // Create a 'null' image for this glyph so we do not seg later
-                    const Rectf area(0, 0, 0, 0);
-                    const glm::vec2 offset(0, 0);
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BitmapImage* img =
-                        new BitmapImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-                }
-                else
-                {
-                    uint glyph_w = d_fontFace->glyph->bitmap.width + INTER_GLYPH_PAD_SPACE;
-                    uint glyph_h = d_fontFace->glyph->bitmap.rows + INTER_GLYPH_PAD_SPACE;
-
-                    // Check if glyph right margin does not exceed texture size
-                    uint x_next = x + glyph_w;
-                    if (x_next > texsize)
-                    {
-                        x = INTER_GLYPH_PAD_SPACE;
-                        x_next = x + glyph_w;
-                        y = yb;
-                    }
-
-                    // Check if glyph bottom margine does not exceed texture size
-                    uint y_bot = y + glyph_h;
-                    if (y_bot > texsize)
-                        break;
-
-                    // Copy rendered glyph to memory buffer in RGBA format
-                    drawGlyphToBuffer(mem_buffer + (y * texsize) + x, texsize);
-
-                    // Create a new image in the imageset
-                    const Rectf area(static_cast<float>(x),
-                                     static_cast<float>(y),
-                                     static_cast<float>(x + glyph_w - INTER_GLYPH_PAD_SPACE),
-                                     static_cast<float>(y + glyph_h - INTER_GLYPH_PAD_SPACE));
-
-                    const glm::vec2 offset(
-                        d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
-                        -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
-
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BitmapImage* img =
-                        new BitmapImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-
-                    // Advance to next position
-                    x = x_next;
-                    if (y_bot > yb)
-                    {
-                        yb = y_bot;
-                    }
-                }
-            }
+            const GlyphShelf shelf = {top, height, INTER_GLYPH_PAD_SPACE};
+            page.d_shelves.push_back(shelf);
+            best = &page.d_shelves.back();
+        }
+    }
 
-            // Go to next glyph, if we are going forward
-            if (forward)
-                if (++s == d_cp_map.end())
-                {
-                    finished = true;
-                    forward = false;
-                    s = orig_s;
-                }
-            // Go to previous glyph, if we are going backward
-            if (!forward)
-                if ((s == d_cp_map.begin()) || (--s == d_cp_map.begin()))
-                    break;
+    // the page is out of room for new shelves, so take any shelf that fits.
+    if (!best)
+    {
+        for (size_t i = 0; i < page.d_shelves.size(); ++i)
+        {
+            GlyphShelf& shelf = page.d_shelves[i];
+            if (shelf.d_height >= height && shelf.d_used + width <= page_size &&
+                (!best || shelf.d_height < best->d_height))
+                    best = &shelf;
         }
+    }
 
-        // Copy our memory buffer into the texture and free it
-        texture.loadFromMemory(mem_buffer, Sizef(static_cast<float>(texsize), static_cast<float>(texsize)), Texture::PF_RGBA);
-        delete[] mem_buffer;
+    if (!best)
+        return false;
 
-        if (finished)
-            break;
+    x = best->d_used;
+    y = best->d_top;
+    best->d_used += width;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+FreeTypeFont::GlyphPage* FreeTypeFont::findSpaceForGlyph(uint width, uint height,
+                                                         uint& x, uint& y) const
+{
+    if (INTER_GLYPH_PAD_SPACE + width > d_glyphPageSize ||
+        INTER_GLYPH_PAD_SPACE + height > d_glyphPageSize)
+            return 0;
+
+    // try the existing pages, newest first as these are the least full.
+    for (GlyphPageVector::reverse_iterator i = d_glyphPages.rbegin();
+         i != d_glyphPages.rend(); ++i)
+    {
+        if (allocateGlyphArea(**i, d_glyphPageSize, width, height, x, y))
+            return *i;
     }
+
+    // evicting a page now would invalidate geometry drawn earlier in this
+    // frame, so go over the limit; notifyFrameStarted releases the extra.
+    GlyphPage* page = createGlyphPage();
+
+    allocateGlyphArea(*page, d_glyphPageSize, width, height, x, y);
+    return page;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::rasteriseGlyph(const utf32 codepoint, FontGlyph& glyph) const
+{
+    if (FT_Load_Char(d_fontFace, codepoint, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
+                     (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
+    {
+        std::stringstream err;
+        err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
+        err << static_cast<unsigned int>(codepoint);
+        err << ".  Will use an empty image for this glyph!";
+        Logger::getSingleton().logEvent(err.str().c_str(), Errors);
+
+        // Create a 'null' image for this glyph so we do not seg later
+        GlyphPage& page = d_glyphPages.empty() ?
+            *createGlyphPage() : *d_glyphPages.back();
+        setGlyphImage(codepoint, glyph, page, Rectf(0, 0, 0, 0), glm::vec2(0, 0));
+        return;
+    }
+
+    const uint glyph_w = d_fontFace->glyph->bitmap.width;
+    const uint glyph_h = d_fontFace->glyph->bitmap.rows;
+
+    const glm::vec2 offset(
+        d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
+        -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
+
+    uint x = 0, y = 0;
+    GlyphPage* page = 0;
+    if (glyph_w && glyph_h)
+    {
+        page = findSpaceForGlyph(glyph_w + INTER_GLYPH_PAD_SPACE,
+                                 glyph_h + INTER_GLYPH_PAD_SPACE, x, y);
+
+        if (!page)
+        {
+            std::stringstream err;
+            err << "FreeTypeFont::rasteriseGlyph - The glyph for codepoint: ";
+            err << static_cast<unsigned int>(codepoint);
+            err << " is too large for a glyph page.  Will use an empty image "
+                   "for this glyph!";
+            Logger::getSingleton().logEvent(err.str().c_str(), Errors);
+        }
+    }
+
+    if (!page)
+    {
+        // nothing to draw, but the glyph still needs an image for its metrics
+        GlyphPage& any_page = d_glyphPages.empty() ?
+            *createGlyphPage() : *d_glyphPages.back();
+        setGlyphImage(codepoint, glyph, any_page, Rectf(0, 0, 0, 0), offset);
+        return;
+    }
+
+    // upload just the area of the new glyph
+    std::vector<argb_t> mem_buffer(glyph_w * glyph_h);
+    drawGlyphToBuffer(&mem_buffer[0], glyph_w);
+
+    const Rectf area(static_cast<float>(x),
+                     static_cast<float>(y),
+                     static_cast<float>(x + glyph_w),
+                     static_cast<float>(y + glyph_h));
+    page->d_texture->blitFromMemory(&mem_buffer[0], area);
+
+    setGlyphImage(codepoint, glyph, *page, area, offset);
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setGlyphImage(const utf32 codepoint, FontGlyph& glyph,
+                                 GlyphPage& page,
+                                 const Rectf& area, const glm::vec2& offset) const
+{
+    const String name(PropertyHelper<unsigned long>::toString(codepoint));
+    BitmapImage* img = new BitmapImage(name, page.d_texture, area, offset,
+                                       ASM_Disabled, d_nativeResolution);
+    glyph.setImage(img);
+    glyph.setPageIndex(page.d_index);
+
+    page.d_codepoints.push_back(codepoint);
+    page.d_lastUsed = ++d_glyphUseCounter;
+}
+
+//----------------------------------------------------------------------------//
+void FreeTypeFont::touchGlyphPage(const FontGlyph& glyph) const
+{
+    d_glyphPages[glyph.getPageIndex()]->d_lastUsed = ++d_glyphUseCounter;
 }
 
 //----------------------------------------------------------------------------//
@@ -358,15 +507,16 @@ void FreeTypeFont::free()
     if (!d_fontFace)
         return;
 
-    d_cp_map.clear();
-
-    for (size_t i = 0; i < d_glyphImages.size(); ++i)
-        delete d_glyphImages[i];
-    d_glyphImages.clear();
+    for (CodepointMap::iterator i = d_cp_map.begin(); i != d_cp_map.end(); ++i)
+        delete i->second.getImage();
+    clearFontGlyphs();
 
-    for (size_t i = 0; i < d_glyphTextures.size(); i++)
-        System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
-    d_glyphTextures.clear();
+    for (size_t i = 0; i < d_glyphPages.size(); i++)
+    {
+        System::getSingleton().getRenderer()->destroyTexture(*d_glyphPages[i]->d_texture);
+        delete d_glyphPages[i];
+    }
+    d_glyphPages.clear();
 
     FT_Done_Face(d_fontFace);
     d_fontFace = 0;
@@ -378,9 +528,14 @@ void FreeTypeFont::updateFont()
 {
     free();
 
-    System::getSingleton().getResourceProvider()->loadRawDataContainer(
-        d_filename, d_fontData, d_resourceGroup.empty() ?
-            getDefaultResourceGroup() : d_resourceGroup);
+    const String& group(d_resourceGroup.empty() ?
+        getDefaultResourceGroup() : d_resourceGroup);
+
+    // use the file content read in the background if there is any
+    AsyncSchemeLoader* const loader = AsyncSchemeLoader::getSingletonPtr();
+    if (!loader || !loader->takePreloadedFile(d_filename, group, d_fontData))
+        System::getSingleton().getResourceProvider()->loadRawDataContainer(
+            d_filename, d_fontData, group);
 
     FT_Error error;
 
@@ -462,6 +617,8 @@ void FreeTypeFont::updateFont()
         d_height = d_specificLineSpacing;
     }
 
+    d_glyphPageSize = calculateGlyphPageSize();
+
     initialiseGlyphMap();
 }
 
@@ -477,7 +634,7 @@ void FreeTypeFont::initialiseGlyphMap()
         if (max_codepoint < codepoint)
             max_codepoint = codepoint;
 
-        d_cp_map[codepoint] = FontGlyph();
+        addFontGlyph(codepoint, FontGlyph());
 
         codepoint = FT_Get_Next_Char(d_fontFace, codepoint, &gindex);
     }
@@ -488,30 +645,35 @@ void FreeTypeFont::initialiseGlyphMap()
 //----------------------------------------------------------------------------//
 const FontGlyph* FreeTypeFont::findFontGlyph(const utf32 codepoint) const
 {
-    CodepointMap::iterator pos = d_cp_map.find(codepoint);
+    FontGlyph* glyph = findIndexedGlyph(codepoint);
 
-    if (pos == d_cp_map.end())
+    if (!glyph)
         return 0;
 
-    if (!pos->second.isValid())
-        initialiseFontGlyph(pos);
+    if (!glyph->isValid())
+        initialiseFontGlyph(codepoint, *glyph);
+
+    if (!glyph->getImage())
+        rasteriseGlyph(codepoint, *glyph);
+    else
+        touchGlyphPage(*glyph);
 
-    return &pos->second;
+    return glyph;
 }
 
 //----------------------------------------------------------------------------//
-void FreeTypeFont::initialiseFontGlyph(CodepointMap::iterator cp) const
+void FreeTypeFont::initialiseFontGlyph(const utf32 codepoint, FontGlyph& glyph) const
 {
     // load-up required glyph metrics (don't render)
-    if (FT_Load_Char(d_fontFace, cp->first,
+    if (FT_Load_Char(d_fontFace, codepoint,
                      FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT))
         return;
 
     const float adv =
         d_fontFace->glyph->metrics.horiAdvance * static_cast<float>(FT_POS_COEF);
 
-    cp->second.setAdvance(adv);
-    cp->second.setValid(true);
+    glyph.setAdvance(adv);
+    glyph.setValid(true);
 }
 
 //----------------------------------------------------------------------------//
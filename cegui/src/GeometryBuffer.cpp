@@ -35,9 +35,32 @@
 #include <algorithm>
 #include <iterator>
 #include <stddef.h>
+#include <cstring>
 
 namespace CEGUI
 {
+//---------------------------------------------------------------------------//
+// Convert a value in [0, 1] to the normalised integer formats of the packed
+// vertex attributes.
+static uint8 packUnorm8(float value)
+{
+    return static_cast<uint8>(ceguimax(0.0f, ceguimin(1.0f, value)) * 255.0f + 0.5f);
+}
+
+static uint16 packUnorm16(float value)
+{
+    return static_cast<uint16>(ceguimax(0.0f, ceguimin(1.0f, value)) * 65535.0f + 0.5f);
+}
+
+//---------------------------------------------------------------------------//
+// Whether a shader parameter is set by the renderers from the state of the
+// GeometryBuffer being drawn, rather than being part of its RenderMaterial.
+static bool isSetAtDrawTime(const std::string& parameter_name)
+{
+    return parameter_name == "modelViewProjMatrix" ||
+           parameter_name == "alphaPercentage";
+}
+
 //---------------------------------------------------------------------------//
 GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_translation(0, 0, 0),
@@ -48,8 +71,11 @@ GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
     d_effect(0),
     d_blendMode(BM_NORMAL),
     d_renderMaterial(renderMaterial),
+    d_vertexCount(0),
+    d_indexedGeometry(false),
     d_polygonFillRule(PFR_NONE),
     d_postStencilVertexCount(0),
+    d_clippingActive(true),
     d_alpha(1.0f),
     d_matrixValid(false),
     d_lastRenderTarget(0),
@@ -85,32 +111,15 @@ void GeometryBuffer::appendGeometry(const std::vector<ColouredVertex>& coloured_
 void GeometryBuffer::appendGeometry(const ColouredVertex* vertex_array,
                                     std::size_t vertex_count)
 {
-    // Create a temporary array to contain our data
-    static const std::size_t vertexDataSize = 7;
-    std::size_t fullArraySize = vertexDataSize * vertex_count;
-    float* vertexData = new float[fullArraySize];
+    static const glm::vec2 noTexCoords(0.0f, 0.0f);
 
-    // Add the vertex data in their default order into an array
-    const ColouredVertex* vs = vertex_array;
-    for (std::size_t i = 0; i < vertex_count; ++i, ++vs)
-    {
-        // Add all the elements in the default order for textured and coloured
-        // geometry into the vector
-        std::size_t currentIndex = i * vertexDataSize;
-
-        vertexData[currentIndex + 0] = vs->d_position.x;
-        vertexData[currentIndex + 1] = vs->d_position.y;
-        vertexData[currentIndex + 2] = vs->d_position.z;
-        vertexData[currentIndex + 3] = vs->d_colour.x;
-        vertexData[currentIndex + 4] = vs->d_colour.y;
-        vertexData[currentIndex + 5] = vs->d_colour.z;
-        vertexData[currentIndex + 6] = vs->d_colour.w;
-    }
+    float* dest = beginAppendGeometry(vertex_count);
 
-    // Append the prepared geometry data
-    appendGeometry(vertexData, fullArraySize);
+    for (std::size_t i = 0; i < vertex_count; ++i)
+        dest = writeVertex(dest, vertex_array[i].d_position,
+                           vertex_array[i].d_colour, noTexCoords);
 
-    delete[] vertexData;
+    endAppendGeometry();
 }
 
 //---------------------------------------------------------------------------//
@@ -126,83 +135,158 @@ void GeometryBuffer::appendGeometry(const std::vector<TexturedColouredVertex>& t
 void GeometryBuffer::appendGeometry(const TexturedColouredVertex* vertex_array,
                                     std::size_t vertex_count)
 {
-    // Create a temporary array to contain our data
-    static const std::size_t vertexDataSize = 9;
-    std::size_t fullArraySize = vertexDataSize * vertex_count;
-    float* vertexData = new float[fullArraySize];
-
-    // Add the vertex data in their default order into an array
-    const TexturedColouredVertex* vs = vertex_array;
-    for (std::size_t i = 0; i < vertex_count; ++i, ++vs)
-    {
-        // Add all the elements in the default order for textured and coloured
-        // geometry into the vector
-        std::size_t currentIndex = i * vertexDataSize;
-        
-        vertexData[currentIndex + 0] = vs->d_position.x;
-        vertexData[currentIndex + 1] = vs->d_position.y;
-        vertexData[currentIndex + 2] = vs->d_position.z;
-        vertexData[currentIndex + 3] = vs->d_colour.x;
-        vertexData[currentIndex + 4] = vs->d_colour.y;
-        vertexData[currentIndex + 5] = vs->d_colour.z;
-        vertexData[currentIndex + 6] = vs->d_colour.w;
-        vertexData[currentIndex + 7] = vs->d_texCoords.x;
-        vertexData[currentIndex + 8] = vs->d_texCoords.y;
-    }
+    float* dest = beginAppendGeometry(vertex_count);
 
-    // Append the prepared geometry data
-    appendGeometry(vertexData, fullArraySize);
+    for (std::size_t i = 0; i < vertex_count; ++i)
+        dest = writeVertex(dest, vertex_array[i].d_position,
+                           vertex_array[i].d_colour, vertex_array[i].d_texCoords);
 
-    delete[] vertexData;
+    endAppendGeometry();
 }
 
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendGeometry(const float* vertex_data,
                                     std::size_t array_size)
 {
-    d_vertexData.reserve( d_vertexData.size() + array_size);
-    std::copy(vertex_data, vertex_data + array_size, std::back_inserter(d_vertexData));
+    d_vertexData.insert(d_vertexData.end(), vertex_data, vertex_data + array_size);
+
+    endAppendGeometry();
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendVertex(const TexturedColouredVertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendVertex(const ColouredVertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//---------------------------------------------------------------------------//
+float* GeometryBuffer::beginAppendGeometry(std::size_t vertex_count)
+{
+    const std::size_t old_size = d_vertexData.size();
+    d_vertexData.resize(old_size + vertex_count * getVertexAttributeElementCount());
+
+    return d_vertexData.empty() ? 0 : &d_vertexData[0] + old_size;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::endAppendGeometry()
+{
+    const uint32 first_vertex = d_vertexCount;
 
     // Update size of geometry buffer
     d_vertexCount = d_vertexData.size() / getVertexAttributeElementCount();
+
+    if (d_indexedGeometry)
+        for (uint32 i = first_vertex; i < d_vertexCount; ++i)
+            d_indexData.push_back(i);
+
+    onGeometryAppended();
 }
 
 //---------------------------------------------------------------------------//
-void GeometryBuffer::appendVertex(const TexturedColouredVertex& vertex)
+void GeometryBuffer::appendQuads(const TexturedColouredVertex* corners,
+                                 std::size_t quad_count)
 {
-    // Add the vertex data in their default order into an array
-    float vertexData[9];
+    if (!d_indexedGeometry)
+    {
+        float* dest = beginAppendGeometry(quad_count * 6);
+
+        for (std::size_t q = 0; q < quad_count; ++q, corners += 4)
+        {
+            static const int order[6] = { 0, 1, 2, 3, 0, 2 };
+
+            for (int i = 0; i < 6; ++i)
+            {
+                const TexturedColouredVertex& v = corners[order[i]];
+                dest = writeVertex(dest, v.d_position, v.d_colour, v.d_texCoords);
+            }
+        }
+
+        endAppendGeometry();
+        return;
+    }
+
+    const uint32 first_vertex = d_vertexCount;
+    float* dest = beginAppendGeometry(quad_count * 4);
+
+    for (std::size_t i = 0; i < quad_count * 4; ++i)
+        dest = writeVertex(dest, corners[i].d_position, corners[i].d_colour,
+                           corners[i].d_texCoords);
 
-    // Copy the vertex attributes into the array
-    vertexData[0] = vertex.d_position.x;
-    vertexData[1] = vertex.d_position.y;
-    vertexData[2] = vertex.d_position.z;
-    vertexData[3] = vertex.d_colour.x;
-    vertexData[4] = vertex.d_colour.y;
-    vertexData[5] = vertex.d_colour.z;
-    vertexData[6] = vertex.d_colour.w;
-    vertexData[7] = vertex.d_texCoords.x;
-    vertexData[8] = vertex.d_texCoords.y;
+    d_vertexCount = d_vertexData.size() / getVertexAttributeElementCount();
+
+    d_indexData.reserve(d_indexData.size() + quad_count * 6);
+    for (uint32 base = first_vertex; base < d_vertexCount; base += 4)
+    {
+        d_indexData.push_back(base);
+        d_indexData.push_back(base + 1);
+        d_indexData.push_back(base + 2);
+        d_indexData.push_back(base + 3);
+        d_indexData.push_back(base);
+        d_indexData.push_back(base + 2);
+    }
 
-    appendGeometry(vertexData, 9);
+    onGeometryAppended();
 }
 
 //---------------------------------------------------------------------------//
-void GeometryBuffer::appendVertex(const ColouredVertex& vertex)
+void GeometryBuffer::onGeometryAppended()
 {
-    // Add the vertex data in their default order into an array
-    float vertexData[7];
+}
 
-    // Copy the vertex attributes into the array
-    vertexData[0] = vertex.d_position.x;
-    vertexData[1] = vertex.d_position.y;
-    vertexData[2] = vertex.d_position.z;
-    vertexData[3] = vertex.d_colour.x;
-    vertexData[4] = vertex.d_colour.y;
-    vertexData[5] = vertex.d_colour.z;
-    vertexData[6] = vertex.d_colour.w;
+//---------------------------------------------------------------------------//
+float* GeometryBuffer::writeVertex(float* dest, const glm::vec3& position,
+                                   const glm::vec4& colour,
+                                   const glm::vec2& tex_coords) const
+{
+    const std::size_t attribute_count = d_vertexAttributes.size();
+    for (std::size_t i = 0; i < attribute_count; ++i)
+    {
+        switch (d_vertexAttributes[i])
+        {
+        case VAT_POSITION0:
+            *dest++ = position.x;
+            *dest++ = position.y;
+            *dest++ = position.z;
+            break;
+        case VAT_COLOUR0:
+            *dest++ = colour.x;
+            *dest++ = colour.y;
+            *dest++ = colour.z;
+            *dest++ = colour.w;
+            break;
+        case VAT_TEXCOORD0:
+            *dest++ = tex_coords.x;
+            *dest++ = tex_coords.y;
+            break;
+        case VAT_COLOUR0_PACKED:
+            {
+                const uint8 packed[4] = { packUnorm8(colour.x),
+                                          packUnorm8(colour.y),
+                                          packUnorm8(colour.z),
+                                          packUnorm8(colour.w) };
+                std::memcpy(dest++, packed, sizeof(packed));
+            }
+            break;
+        case VAT_TEXCOORD0_PACKED:
+            {
+                const uint16 packed[2] = { packUnorm16(tex_coords.x),
+                                           packUnorm16(tex_coords.y) };
+                std::memcpy(dest++, packed, sizeof(packed));
+            }
+            break;
+        default:
+            break;
+        }
+    }
 
-    appendGeometry(vertexData, 7);
+    return dest;
 }
 
 //---------------------------------------------------------------------------//
@@ -224,6 +308,10 @@ int GeometryBuffer::getVertexAttributeElementCount() const
             case VAT_TEXCOORD0:
                 count += 2;
                 break;
+            case VAT_COLOUR0_PACKED:
+            case VAT_TEXCOORD0_PACKED:
+                count += 1;
+                break;
             default:
                 break;
         }
@@ -232,6 +320,109 @@ int GeometryBuffer::getVertexAttributeElementCount() const
     return count;
 }
 
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isBatchCompatible(const Texture* texture,
+                                       bool clipping_active,
+                                       const Rectf& clipping_region,
+                                       float alpha,
+                                       BlendMode blend_mode) const
+{
+    // geometry with effects or stencil rendering must stay in its own buffer
+    if (d_effect || d_polygonFillRule != PFR_NONE)
+        return false;
+
+    if (d_alpha != alpha || d_blendMode != blend_mode ||
+        d_clippingActive != clipping_active)
+        return false;
+
+    if (clipping_active && getClippingRegion() != clipping_region)
+        return false;
+
+    // only textured buffers - position, colour and texture coordinates - can
+    // receive textured geometry
+    if (d_vertexAttributes.size() != 3 ||
+        (d_vertexAttributes[2] != VAT_TEXCOORD0 &&
+         d_vertexAttributes[2] != VAT_TEXCOORD0_PACKED))
+        return false;
+
+    const ShaderParameter* const param =
+        d_renderMaterial->getShaderParamBindings()->getParameter("texture0");
+
+    return param && param->getType() == SPT_TEXTURE &&
+        static_cast<const ShaderParameterTexture*>(param)->d_parameterValue == texture;
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isDrawCompatible(const GeometryBuffer& other) const
+{
+    if (d_effect || other.d_effect ||
+        d_polygonFillRule != PFR_NONE || other.d_polygonFillRule != PFR_NONE)
+        return false;
+
+    if (d_alpha != other.d_alpha || d_blendMode != other.d_blendMode ||
+        d_clippingActive != other.d_clippingActive)
+        return false;
+
+    if (d_clippingActive && getClippingRegion() != other.getClippingRegion())
+        return false;
+
+    if (d_vertexAttributes != other.d_vertexAttributes ||
+        d_indexedGeometry != other.d_indexedGeometry ||
+        d_renderMaterial->getShaderWrapper() !=
+            other.d_renderMaterial->getShaderWrapper())
+        return false;
+
+    if (d_renderMaterial == other.d_renderMaterial)
+        return true;
+
+    // the materials must hold the same parameters, apart from those set when
+    // drawing: the alpha is compared above and drawWith applies the
+    // transformation of each buffer.
+    typedef ShaderParameterBindings::ShaderParameterBindingsMap ParameterMap;
+    const ParameterMap& params = d_renderMaterial->getShaderParamBindings()->
+        getShaderParameterBindings();
+    const ParameterMap& other_params = other.d_renderMaterial->
+        getShaderParamBindings()->getShaderParameterBindings();
+
+    ParameterMap::const_iterator iter = params.begin();
+    ParameterMap::const_iterator other_iter = other_params.begin();
+    for (;;)
+    {
+        while (iter != params.end() && isSetAtDrawTime(iter->first))
+            ++iter;
+        while (other_iter != other_params.end() &&
+               isSetAtDrawTime(other_iter->first))
+            ++other_iter;
+
+        if (iter == params.end() || other_iter == other_params.end())
+            return iter == params.end() && other_iter == other_params.end();
+
+        if (iter->first != other_iter->first)
+            return false;
+
+        if (!iter->second || !other_iter->second)
+        {
+            if (iter->second != other_iter->second)
+                return false;
+        }
+        else if (!iter->second->equal(other_iter->second))
+            return false;
+
+        ++iter;
+        ++other_iter;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::drawWith(const GeometryBuffer* const* others,
+                              std::size_t count) const
+{
+    draw();
+
+    for (std::size_t i = 0; i < count; ++i)
+        others[i]->draw();
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::resetVertexAttributes()
 {
@@ -244,6 +435,30 @@ void GeometryBuffer::addVertexAttribute(VertexAttributeType attribute)
     d_vertexAttributes.push_back(attribute);
 }
 
+//---------------------------------------------------------------------------//
+void GeometryBuffer::setIndexedGeometryActive(bool active)
+{
+    d_indexedGeometry = active;
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isIndexedGeometryActive() const
+{
+    return d_indexedGeometry;
+}
+
+//---------------------------------------------------------------------------//
+const std::vector<uint32>& GeometryBuffer::getIndexData() const
+{
+    return d_indexData;
+}
+
+//---------------------------------------------------------------------------//
+std::size_t GeometryBuffer::getDrawCount() const
+{
+    return d_indexedGeometry ? d_indexData.size() : d_vertexCount;
+}
+
 //---------------------------------------------------------------------------//
 RefCounted<RenderMaterial> GeometryBuffer::getRenderMaterial() const
 {
@@ -262,12 +477,24 @@ void GeometryBuffer::setStencilRenderingActive(PolygonFillRule fill_rule)
     d_polygonFillRule = fill_rule;
 }
 
+//---------------------------------------------------------------------------//
+PolygonFillRule GeometryBuffer::getStencilRenderingFillRule() const
+{
+    return d_polygonFillRule;
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::setStencilPostRenderingVertexCount(unsigned int vertex_count)
 {
     d_postStencilVertexCount = vertex_count;
 }
 
+//---------------------------------------------------------------------------//
+unsigned int GeometryBuffer::getStencilPostRenderingVertexCount() const
+{
+    return d_postStencilVertexCount;
+}
+
 //----------------------------------------------------------------------------//
 void GeometryBuffer::setRenderEffect(RenderEffect* effect)
 {
@@ -336,6 +563,12 @@ void GeometryBuffer::setCustomTransform(const glm::mat4x4& transformation)
     }
 }
 
+//----------------------------------------------------------------------------//
+const glm::mat4x4& GeometryBuffer::getCustomTransform() const
+{
+    return d_customTransform;
+}
+
 //----------------------------------------------------------------------------//
 void GeometryBuffer::setClippingActive(const bool active)
 {
@@ -355,10 +588,18 @@ std::size_t GeometryBuffer::getVertexCount() const
     return d_vertexCount;
 }
 
+//----------------------------------------------------------------------------//
+const std::vector<float>& GeometryBuffer::getVertexData() const
+{
+    return d_vertexData;
+}
+
 //----------------------------------------------------------------------------//
 void GeometryBuffer::reset()
 {
     d_vertexData.clear();
+    d_indexData.clear();
+    d_vertexCount = 0;
     d_clippingActive = true;
 }
 
@@ -40,7 +40,8 @@ namespace CEGUI
 	/*************************************************************************
 		GlobalEventSet constructor.
 	*************************************************************************/
-	GlobalEventSet::GlobalEventSet()
+	GlobalEventSet::GlobalEventSet() :
+        d_eventNamesVersion(0)
 	{
         char addr_buff[32];
         sprintf(addr_buff, "(%p)", static_cast<void*>(this));
@@ -80,6 +81,12 @@ namespace CEGUI
 	*************************************************************************/
 	void GlobalEventSet::fireEvent(const String& name, EventArgs& args, const String& eventNamespace)
 	{
+        // every event fired by every EventSet ends up here, so first check
+        // whether anyone subscribed to an event with this name at all.
+        updateEventNames();
+        if (d_eventNames.find(name) == d_eventNames.end())
+            return;
+
         // here we are very explicit about how we construct the event string.
         // Doing it 'longhand' like this saves significant time when compared
         // to the obvious - and previous - implementation:
@@ -92,4 +99,30 @@ namespace CEGUI
         fireEvent_impl(evt_name, args);
 	}
 
+	/*************************************************************************
+		Rebuild the set of event names if events were added or removed.
+	*************************************************************************/
+	void GlobalEventSet::updateEventNames()
+	{
+        if (d_eventNamesVersion == d_eventsVersion)
+            return;
+
+        d_eventNames.clear();
+
+        for (EventMap::const_iterator it = d_events.begin();
+             it != d_events.end(); ++it)
+        {
+            const String& evt_name = it->first;
+
+            // the namespace itself may contain '/', so add every candidate.
+            for (String::size_type pos = evt_name.find('/');
+                 pos != String::npos; pos = evt_name.find('/', pos + 1))
+            {
+                d_eventNames.insert(evt_name.substr(pos + 1));
+            }
+        }
+
+        d_eventNamesVersion = d_eventsVersion;
+	}
+
 } // End of  CEGUI namespace section
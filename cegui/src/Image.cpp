@@ -166,6 +166,12 @@ void Image::setImageArea(const Rectf& image_area)
     }
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& Image::getImageArea() const
+{
+    return d_imageArea;
+}
+
 //----------------------------------------------------------------------------//
 void Image::setOffset(const glm::vec2& pixel_offset)
 {
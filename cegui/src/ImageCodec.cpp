@@ -51,4 +51,9 @@ const String& ImageCodec::getSupportedFormat() const
     return d_supportedFormat;
 }
 
+bool ImageCodec::isThreadSafe() const
+{
+    return false;
+}
+
 } // End of CEGUI namespace section 
@@ -204,6 +204,12 @@ Texture* PVRImageCodec::load(const RawDataContainer& data, Texture* result)
     return result;
 }
 
+//----------------------------------------------------------------------------//
+bool PVRImageCodec::isThreadSafe() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of CEGUI namespace section
@@ -52,11 +52,14 @@ STBImageCodec::~STBImageCodec()
 Texture* STBImageCodec::load(const RawDataContainer& data, Texture* result)
 {
     int width, height, comp;
+    unsigned char* image;
 
     // load image
-    unsigned char* image = stbi_load_from_memory(data.getDataPtr(),
-                                                 data.getSize(),
-                                                 &width, &height, &comp, 0);
+    {
+        MutexLock lock(d_mutex);
+        image = stbi_load_from_memory(data.getDataPtr(), data.getSize(),
+                                      &width, &height, &comp, 0);
+    }
 
     if (!image) 
     {
@@ -95,6 +98,12 @@ Texture* STBImageCodec::load(const RawDataContainer& data, Texture* result)
     return result;
 }
 
+//----------------------------------------------------------------------------//
+bool STBImageCodec::isThreadSafe() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of CEGUI namespace section
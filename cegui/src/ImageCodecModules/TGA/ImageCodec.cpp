@@ -45,6 +45,11 @@ TGAImageCodec::~TGAImageCodec()
 {
 }
 
+bool TGAImageCodec::isThreadSafe() const
+{
+    return true;
+}
+
 Texture* TGAImageCodec::load(const RawDataContainer& data, Texture* result)
 {
     Logger::getSingleton().logEvent("TGAImageCodec::load()", Informative);
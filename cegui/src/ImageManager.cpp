@@ -32,6 +32,7 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/System.h"
+#include "CEGUI/AsyncSchemeLoader.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/svg/SVGImage.h"
@@ -319,10 +320,17 @@ void ImageManager::destroyImageCollection(const String& prefix,
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
-    // create texture from image
-    Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    const String& group(resource_group.empty() ?
+        d_imagesetDefaultResourceGroup : resource_group);
+
+    // create texture from image, using any image decoded in the background
+    AsyncSchemeLoader* const loader = AsyncSchemeLoader::getSingletonPtr();
+    Texture* tex = loader ?
+        loader->createPreloadedTexture(name, filename, group) : 0;
+
+    if (!tex)
+        tex = &System::getSingleton().getRenderer()->
+            createTexture(name, filename, group);
 
     BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
     image.setTexture(tex);
@@ -510,10 +518,16 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
     }
     else
     {
-        // create texture from image
-        s_texture = &renderer->createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup :
-            resource_group);
+        const String& group(resource_group.empty() ?
+            d_imagesetDefaultResourceGroup : resource_group);
+
+        // create texture from image, using any image decoded in the background
+        AsyncSchemeLoader* const loader = AsyncSchemeLoader::getSingletonPtr();
+        s_texture = loader ?
+            loader->createPreloadedTexture(name, filename, group) : 0;
+
+        if (!s_texture)
+            s_texture = &renderer->createTexture(name, filename, group);
     }
 }
 
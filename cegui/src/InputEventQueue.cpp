@@ -0,0 +1,332 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/InputEventQueue.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+InputEventQueue::InputEventQueue(InjectedInputReceiver* receiver) :
+    d_receiver(receiver),
+    d_coalescing(true)
+{
+}
+
+//----------------------------------------------------------------------------//
+InputEventQueue::~InputEventQueue()
+{
+}
+
+//----------------------------------------------------------------------------//
+void InputEventQueue::setReceiver(InjectedInputReceiver* receiver)
+{
+    d_receiver = receiver;
+}
+
+//----------------------------------------------------------------------------//
+InjectedInputReceiver* InputEventQueue::getReceiver() const
+{
+    return d_receiver;
+}
+
+//----------------------------------------------------------------------------//
+void InputEventQueue::setCoalescingEnabled(bool setting)
+{
+    MutexLock lock(d_mutex);
+    d_coalescing = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::isCoalescingEnabled() const
+{
+    MutexLock lock(d_mutex);
+    return d_coalescing;
+}
+
+//----------------------------------------------------------------------------//
+size_t InputEventQueue::getQueuedInputCount() const
+{
+    MutexLock lock(d_mutex);
+    return d_queue.size();
+}
+
+//----------------------------------------------------------------------------//
+void InputEventQueue::clear()
+{
+    MutexLock lock(d_mutex);
+    d_queue.clear();
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::dispatch()
+{
+    // take the queued input so that injection can go on while it is being
+    // dispatched.
+    {
+        MutexLock lock(d_mutex);
+        d_dispatching.swap(d_queue);
+    }
+
+    bool handled = false;
+
+    if (d_receiver)
+    {
+        for (std::vector<QueuedInput>::const_iterator i = d_dispatching.begin();
+             i != d_dispatching.end(); ++i)
+        {
+            if (dispatchInput(*i))
+                handled = true;
+        }
+    }
+
+    d_dispatching.clear();
+    return handled;
+}
+
+//----------------------------------------------------------------------------//
+void InputEventQueue::queueInput(const QueuedInput& input)
+{
+    MutexLock lock(d_mutex);
+
+    if (d_coalescing && !d_queue.empty())
+    {
+        QueuedInput& last = d_queue.back();
+
+        switch (input.d_type)
+        {
+        case QIT_MouseMove:
+        case QIT_MouseWheelChange:
+            // deltas add up.
+            if (last.d_type == input.d_type)
+            {
+                last.d_x += input.d_x;
+                last.d_y += input.d_y;
+                return;
+            }
+            break;
+
+        case QIT_MousePosition:
+            // a new absolute position supersedes earlier moves.
+            if (last.d_type == QIT_MousePosition ||
+                last.d_type == QIT_MouseMove)
+            {
+                last = input;
+                return;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    d_queue.push_back(input);
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::dispatchInput(const QueuedInput& input)
+{
+    switch (input.d_type)
+    {
+    case QIT_MouseMove:
+        return d_receiver->injectMouseMove(input.d_x, input.d_y);
+
+    case QIT_MouseLeaves:
+        return d_receiver->injectMouseLeaves();
+
+    case QIT_MouseButtonDown:
+        return d_receiver->injectMouseButtonDown(
+            static_cast<MouseButton>(input.d_value));
+
+    case QIT_MouseButtonUp:
+        return d_receiver->injectMouseButtonUp(
+            static_cast<MouseButton>(input.d_value));
+
+    case QIT_KeyDown:
+        return d_receiver->injectKeyDown(static_cast<Key::Scan>(input.d_value));
+
+    case QIT_KeyUp:
+        return d_receiver->injectKeyUp(static_cast<Key::Scan>(input.d_value));
+
+    case QIT_Char:
+        return d_receiver->injectChar(
+            static_cast<String::value_type>(input.d_value));
+
+    case QIT_MouseWheelChange:
+        return d_receiver->injectMouseWheelChange(input.d_x);
+
+    case QIT_MousePosition:
+        return d_receiver->injectMousePosition(input.d_x, input.d_y);
+
+    case QIT_MouseButtonClick:
+        return d_receiver->injectMouseButtonClick(
+            static_cast<MouseButton>(input.d_value));
+
+    case QIT_MouseButtonDoubleClick:
+        return d_receiver->injectMouseButtonDoubleClick(
+            static_cast<MouseButton>(input.d_value));
+
+    case QIT_MouseButtonTripleClick:
+        return d_receiver->injectMouseButtonTripleClick(
+            static_cast<MouseButton>(input.d_value));
+
+    case QIT_CopyRequest:
+        return d_receiver->injectCopyRequest();
+
+    case QIT_CutRequest:
+        return d_receiver->injectCutRequest();
+
+    case QIT_PasteRequest:
+        return d_receiver->injectPasteRequest();
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseMove(float delta_x, float delta_y)
+{
+    queueInput(QueuedInput(QIT_MouseMove, delta_x, delta_y));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseLeaves()
+{
+    queueInput(QueuedInput(QIT_MouseLeaves));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseButtonDown(MouseButton button)
+{
+    QueuedInput input(QIT_MouseButtonDown);
+    input.d_value = static_cast<uint32>(button);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseButtonUp(MouseButton button)
+{
+    QueuedInput input(QIT_MouseButtonUp);
+    input.d_value = static_cast<uint32>(button);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectKeyDown(Key::Scan scan_code)
+{
+    QueuedInput input(QIT_KeyDown);
+    input.d_value = static_cast<uint32>(scan_code);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectKeyUp(Key::Scan scan_code)
+{
+    QueuedInput input(QIT_KeyUp);
+    input.d_value = static_cast<uint32>(scan_code);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectChar(String::value_type code_point)
+{
+    QueuedInput input(QIT_Char);
+    input.d_value = static_cast<uint32>(code_point);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseWheelChange(float delta)
+{
+    queueInput(QueuedInput(QIT_MouseWheelChange, delta));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMousePosition(float x_pos, float y_pos)
+{
+    queueInput(QueuedInput(QIT_MousePosition, x_pos, y_pos));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseButtonClick(const MouseButton button)
+{
+    QueuedInput input(QIT_MouseButtonClick);
+    input.d_value = static_cast<uint32>(button);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseButtonDoubleClick(const MouseButton button)
+{
+    QueuedInput input(QIT_MouseButtonDoubleClick);
+    input.d_value = static_cast<uint32>(button);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectMouseButtonTripleClick(const MouseButton button)
+{
+    QueuedInput input(QIT_MouseButtonTripleClick);
+    input.d_value = static_cast<uint32>(button);
+    queueInput(input);
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectCopyRequest()
+{
+    queueInput(QueuedInput(QIT_CopyRequest));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectCutRequest()
+{
+    queueInput(QueuedInput(QIT_CutRequest));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool InputEventQueue::injectPasteRequest()
+{
+    queueInput(QueuedInput(QIT_PasteRequest));
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -42,7 +42,8 @@ namespace CEGUI
         Constructor
     *************************************************************************/
     Logger::Logger(void) :
-            d_level(Standard)
+            d_level(Standard),
+            d_keepingAllLevels(false)
     {
     }
 
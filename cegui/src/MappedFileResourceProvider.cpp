@@ -0,0 +1,268 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/MappedFileResourceProvider.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Threading.h"
+
+#include <map>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include "CEGUI/System.h"
+#   include <windows.h>
+#   define CEGUI_HAVE_FILE_MAPPING
+#elif !defined(__ANDROID__)
+#   include <sys/types.h>
+#   include <sys/stat.h>
+#   include <sys/mman.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#   define CEGUI_HAVE_FILE_MAPPING
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Impl struct: keeps the mapping book-keeping out of the public header.
+struct MappedFileResourceProvider::Impl
+{
+    //! A mapped view of a file shared by every container loaded from it.
+    struct MappedFile
+    {
+        String d_filename;
+        uint8* d_data;
+        size_t d_size;
+        uint d_refCount;
+    };
+
+    typedef std::map<String, MappedFile*, StringFastLessCompare> FileMap;
+    typedef std::map<const uint8*, MappedFile*> ViewMap;
+
+    //! Mapped files by final file name.
+    FileMap d_files;
+    //! Mapped files by the address of their view.
+    ViewMap d_views;
+    //! Guards the maps, so files can be loaded from several threads.
+    Mutex d_mutex;
+};
+
+#ifdef CEGUI_HAVE_FILE_MAPPING
+//----------------------------------------------------------------------------//
+// Map the whole of the named file read-only.  Returns 0 if the file exists
+// but cannot be mapped, so the caller can fall back to reading it.
+static uint8* mapFile(const String& filename, size_t& size)
+{
+#   if defined(__WIN32__) || defined(_WIN32)
+    HANDLE file = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(filename).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (file == INVALID_HANDLE_VALUE)
+        CEGUI_THROW(FileIOException(filename + " does not exist"));
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 ||
+        static_cast<ULONGLONG>(file_size.QuadPart) >
+            static_cast<ULONGLONG>(static_cast<size_t>(-1)))
+    {
+        CloseHandle(file);
+        return 0;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+    CloseHandle(file);
+
+    if (!mapping)
+        return 0;
+
+    // the view keeps the mapping object alive once it is created.
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (!view)
+        return 0;
+
+    size = static_cast<size_t>(file_size.QuadPart);
+    return static_cast<uint8*>(view);
+#   else
+    const int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd == -1)
+        CEGUI_THROW(FileIOException(filename + " does not exist"));
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+        file_stat.st_size == 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    void* const view = mmap(0, static_cast<size_t>(file_stat.st_size),
+                            PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the descriptor is closed.
+    close(fd);
+
+    if (view == MAP_FAILED)
+        return 0;
+
+    size = static_cast<size_t>(file_stat.st_size);
+    return static_cast<uint8*>(view);
+#   endif
+}
+
+//----------------------------------------------------------------------------//
+static void unmapFile(uint8* data, size_t size)
+{
+#   if defined(__WIN32__) || defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#   else
+    munmap(data, size);
+#   endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+MappedFileResourceProvider::MappedFileResourceProvider() :
+    d_pimpl(new Impl)
+{
+}
+
+//----------------------------------------------------------------------------//
+MappedFileResourceProvider::~MappedFileResourceProvider()
+{
+#ifdef CEGUI_HAVE_FILE_MAPPING
+    for (Impl::FileMap::iterator i = d_pimpl->d_files.begin();
+         i != d_pimpl->d_files.end(); ++i)
+    {
+        unmapFile(i->second->d_data, i->second->d_size);
+        delete i->second;
+    }
+#endif
+
+    delete d_pimpl;
+}
+
+//----------------------------------------------------------------------------//
+size_t MappedFileResourceProvider::getMappedFileCount() const
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    return d_pimpl->d_files.size();
+}
+
+//----------------------------------------------------------------------------//
+void MappedFileResourceProvider::loadRawDataContainer(
+    const String& filename, RawDataContainer& output, const String& resourceGroup)
+{
+#ifdef CEGUI_HAVE_FILE_MAPPING
+    if (filename.empty())
+        CEGUI_THROW(InvalidRequestException(
+            "Filename supplied for data loading must be valid"));
+
+    const String final_filename(getFinalFilename(filename, resourceGroup));
+
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+
+        Impl::MappedFile* file;
+        Impl::FileMap::iterator i = d_pimpl->d_files.find(final_filename);
+
+        if (i != d_pimpl->d_files.end())
+        {
+            file = i->second;
+            ++file->d_refCount;
+        }
+        else
+        {
+            size_t size = 0;
+            uint8* const data = mapFile(final_filename, size);
+
+            if (!data)
+                file = 0;
+            else
+            {
+                file = new Impl::MappedFile;
+                file->d_filename = final_filename;
+                file->d_data = data;
+                file->d_size = size;
+                file->d_refCount = 1;
+
+                d_pimpl->d_files[final_filename] = file;
+                d_pimpl->d_views[data] = file;
+            }
+        }
+
+        if (file)
+        {
+            output.setExternalData(file->d_data);
+            output.setSize(file->d_size);
+            return;
+        }
+    }
+#endif
+
+    // the file can not be mapped; read it as the DefaultResourceProvider does.
+    DefaultResourceProvider::loadRawDataContainer(filename, output,
+                                                  resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+void MappedFileResourceProvider::unloadRawDataContainer(RawDataContainer& data)
+{
+#ifdef CEGUI_HAVE_FILE_MAPPING
+    if (!data.ownsData())
+    {
+        MutexLock lock(d_pimpl->d_mutex);
+        Impl::ViewMap::iterator i = d_pimpl->d_views.find(data.getDataPtr());
+
+        if (i != d_pimpl->d_views.end() && --i->second->d_refCount == 0)
+        {
+            Impl::MappedFile* const file = i->second;
+
+            d_pimpl->d_views.erase(i);
+            d_pimpl->d_files.erase(file->d_filename);
+            unmapFile(file->d_data, file->d_size);
+            delete file;
+        }
+    }
+#endif
+
+    data.release();
+}
+
+//----------------------------------------------------------------------------//
+bool MappedFileResourceProvider::isThreadSafe() const
+{
+    // the shared mappings are guarded by d_pimpl->d_mutex.
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
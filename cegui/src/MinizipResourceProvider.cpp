@@ -146,6 +146,12 @@ void MinizipResourceProvider::closeArchive()
     d_pimpl->d_zfile = 0;
 }
 
+//----------------------------------------------------------------------------//
+bool MinizipResourceProvider::isThreadSafe() const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void MinizipResourceProvider::loadRawDataContainer(const String& filename,
                                                    RawDataContainer& output,
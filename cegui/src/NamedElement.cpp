@@ -74,8 +74,8 @@ void NamedElement::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-                                    " as: " + name, Informative);
+    CEGUI_LOG("Renamed element at: " + getNamePath() +
+              " as: " + name, Informative);
 
     d_name = name;
 
@@ -29,11 +29,261 @@
 #include "CEGUI/PropertySet.h"
 #include "CEGUI/Property.h"
 #include "CEGUI/Exceptions.h"
+#include <map>
+#include <vector>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 
+/*************************************************************************
+    PropertySet::PropertyTable
+
+    Tables form a tree rooted at the empty table.  Each table knows the
+    table it was derived from and the single property that was added to or
+    removed from it, and indexes the tables derived from it by that change.
+    Since all instances of a class add the same static Property objects in
+    the same order, they walk the same path through the tree and end up
+    sharing one table; creating a window then only costs one lookup per
+    added property instead of a map insertion with its allocations.
+
+    A table lives while a PropertySet uses it or it has derived tables, so
+    the path to a table in use is kept, and the branch is pruned once the
+    last PropertySet leaves it.  The PropertyRegistry of a table is only
+    built when it's looked up, and is freed again once no PropertySet uses
+    the table, so the intermediate tables passed during construction only
+    keep their transitions.
+
+    Like the rest of the PropertySet, the tables and their reference counts
+    are not protected against use from several threads.
+*************************************************************************/
+class PropertySet::PropertyTable
+{
+public:
+    //! returns the empty table all PropertySets start with
+    static PropertyTable& getEmpty()
+    {
+        static PropertyTable empty(0, 0, "");
+
+        return empty;
+    }
+
+    //! returns the table with \a property added to this one
+    PropertyTable* getAdded(Property* property)
+    {
+        const AddedTables::const_iterator it = d_addedTables.find(property);
+        if (it != d_addedTables.end())
+            return it->second;
+
+        const PropertyRegistry& properties = getRegistry();
+        if (properties.find(property->getName()) != properties.end())
+        {
+            CEGUI_THROW(AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet."));
+        }
+
+        PropertyTable* const table = new PropertyTable(this, property, "");
+        d_addedTables[property] = table;
+
+        return table;
+    }
+
+    //! returns the table with property \a name removed from this one
+    PropertyTable* getRemoved(const String& name)
+    {
+        const RemovedTables::const_iterator it = d_removedTables.find(name);
+        if (it != d_removedTables.end())
+            return it->second;
+
+        const PropertyRegistry& properties = getRegistry();
+        if (properties.find(name) == properties.end())
+            return this;
+
+        PropertyTable* const table = new PropertyTable(this, 0, name);
+        d_removedTables[name] = table;
+
+        return table;
+    }
+
+    //! returns the properties in this table, building the registry if needed
+    const PropertyRegistry& getRegistry()
+    {
+        if (!d_registry)
+            buildRegistry();
+
+        return *d_registry;
+    }
+
+    void addRef()
+    {
+        ++d_refCount;
+    }
+
+    void release()
+    {
+        // the empty table keeps its (empty) registry
+        if (--d_refCount == 0 && d_parent)
+        {
+            delete d_registry;
+            d_registry = 0;
+
+            pruneIfUnused();
+        }
+    }
+
+private:
+    typedef std::map<const Property*, PropertyTable*> AddedTables;
+    typedef std::map<String, PropertyTable*, StringFastLessCompare> RemovedTables;
+
+    PropertyTable(PropertyTable* parent, Property* added_property,
+                  const String& removed_name) :
+        d_parent(parent),
+        d_addedProperty(added_property),
+        d_removedName(removed_name),
+        d_registry(parent ? 0 : new PropertyRegistry()),
+        d_refCount(0)
+    {}
+
+    ~PropertyTable()
+    {
+        // only the empty table can still have derived tables here, when it
+        // is destroyed at exit.
+        for (AddedTables::const_iterator it = d_addedTables.begin();
+             it != d_addedTables.end(); ++it)
+        {
+            it->second->d_parent = 0;
+            delete it->second;
+        }
+
+        for (RemovedTables::const_iterator it = d_removedTables.begin();
+             it != d_removedTables.end(); ++it)
+        {
+            it->second->d_parent = 0;
+            delete it->second;
+        }
+
+        delete d_registry;
+    }
+
+    // non-copyable
+    PropertyTable(const PropertyTable&);
+    PropertyTable& operator=(const PropertyTable&);
+
+    /*!
+        delete this table, and then any ancestors left unused, if neither a
+        PropertySet nor a derived table refers to it.
+    */
+    void pruneIfUnused()
+    {
+        PropertyTable* table = this;
+
+        while (table->d_parent && table->d_refCount == 0 &&
+               table->d_addedTables.empty() && table->d_removedTables.empty())
+        {
+            PropertyTable* const parent = table->d_parent;
+
+            if (table->d_addedProperty)
+                parent->d_addedTables.erase(table->d_addedProperty);
+            else
+                parent->d_removedTables.erase(table->d_removedName);
+
+            delete table;
+            table = parent;
+        }
+    }
+
+    //! apply the change this table was derived with to \a properties
+    void applyChange(PropertyRegistry& properties) const
+    {
+        if (d_addedProperty)
+            properties.insert(std::make_pair(d_addedProperty->getName(), d_addedProperty));
+        else
+            properties.erase(d_removedName);
+    }
+
+    void buildRegistry()
+    {
+        // start from the closest table that has its registry built (the
+        // empty table always does) and replay the changes made since.
+        std::vector<const PropertyTable*> changes;
+        const PropertyTable* base = this;
+        while (!base->d_registry)
+        {
+            changes.push_back(base);
+            base = base->d_parent;
+        }
+
+        d_registry = new PropertyRegistry(*base->d_registry);
+
+        for (std::vector<const PropertyTable*>::reverse_iterator it = changes.rbegin();
+             it != changes.rend(); ++it)
+        {
+            (*it)->applyChange(*d_registry);
+        }
+    }
+
+    //! table this one was derived from, 0 for the empty table
+    PropertyTable* d_parent;
+    //! property added to the parent table, 0 if a property was removed
+    Property* d_addedProperty;
+    //! name of the property removed from the parent table
+    const String d_removedName;
+    //! tables derived from this one by adding a property
+    AddedTables d_addedTables;
+    //! tables derived from this one by removing a property
+    RemovedTables d_removedTables;
+    //! properties of this table, 0 until needed
+    PropertyRegistry* d_registry;
+    //! number of PropertySets using this table
+    unsigned int d_refCount;
+};
+
+/*************************************************************************
+    Constructor
+*************************************************************************/
+PropertySet::PropertySet(void) :
+    d_propertyTable(&PropertyTable::getEmpty())
+{
+    d_propertyTable->addRef();
+}
+
+/*************************************************************************
+    Copy constructor
+*************************************************************************/
+PropertySet::PropertySet(const PropertySet& other) :
+    PropertyReceiver(other),
+    d_propertyTable(other.d_propertyTable)
+{
+    d_propertyTable->addRef();
+}
+
+/*************************************************************************
+    Destructor
+*************************************************************************/
+PropertySet::~PropertySet(void)
+{
+    d_propertyTable->release();
+}
+
+/*************************************************************************
+    Assignment operator
+*************************************************************************/
+PropertySet& PropertySet::operator=(const PropertySet& rhs)
+{
+    setPropertyTable(rhs.d_propertyTable);
+
+    return *this;
+}
+
+/*************************************************************************
+    Switch to the given table of properties
+*************************************************************************/
+void PropertySet::setPropertyTable(PropertyTable* table)
+{
+    table->addRef();
+    d_propertyTable->release();
+    d_propertyTable = table;
+}
+
 /*************************************************************************
 	Add a new property to the set
 *************************************************************************/
@@ -44,10 +294,7 @@ void PropertySet::addProperty(Property* property)
 		CEGUI_THROW(NullObjectException("The given Property object pointer is invalid."));
 	}
 
-	if (!d_properties.insert(std::make_pair(property->getName(), property)).second)
-	{
-		CEGUI_THROW(AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet."));
-	}
+    setPropertyTable(d_propertyTable->getAdded(property));
 
     property->initialisePropertyReceiver(this);
 }
@@ -57,12 +304,7 @@ void PropertySet::addProperty(Property* property)
 *************************************************************************/
 void PropertySet::removeProperty(const String& name)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
-
-	if (pos != d_properties.end())
-	{
-		d_properties.erase(pos);
-	}
+    setPropertyTable(d_propertyTable->getRemoved(name));
 }
 
 /*************************************************************************
@@ -70,9 +312,10 @@ void PropertySet::removeProperty(const String& name)
 *************************************************************************/
 Property* PropertySet::getPropertyInstance(const String& name) const
 {
-    PropertyRegistry::const_iterator pos = d_properties.find(name);
+    const PropertyRegistry& properties = d_propertyTable->getRegistry();
+    PropertyRegistry::const_iterator pos = properties.find(name);
 
-    if (pos == d_properties.end())
+    if (pos == properties.end())
     {
         CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
     }
@@ -85,7 +328,7 @@ Property* PropertySet::getPropertyInstance(const String& name) const
 *************************************************************************/
 void PropertySet::clearProperties(void)
 {
-	d_properties.clear();
+    setPropertyTable(&PropertyTable::getEmpty());
 }
 
 /*************************************************************************
@@ -93,7 +336,9 @@ void PropertySet::clearProperties(void)
 *************************************************************************/
 bool PropertySet::isPropertyPresent(const String& name) const
 {
-	return (d_properties.find(name) != d_properties.end());
+    const PropertyRegistry& properties = d_propertyTable->getRegistry();
+
+    return (properties.find(name) != properties.end());
 }
 
 /*************************************************************************
@@ -101,9 +346,10 @@ bool PropertySet::isPropertyPresent(const String& name) const
 *************************************************************************/
 const String& PropertySet::getPropertyHelp(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	PropertyRegistry::const_iterator pos = properties.find(name);
 
-	if (pos == d_properties.end())
+	if (pos == properties.end())
 	{
 		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
 	}
@@ -116,9 +362,10 @@ const String& PropertySet::getPropertyHelp(const String& name) const
 *************************************************************************/
 String PropertySet::getProperty(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	PropertyRegistry::const_iterator pos = properties.find(name);
 
-	if (pos == d_properties.end())
+	if (pos == properties.end())
 	{
 		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
 	}
@@ -131,9 +378,10 @@ String PropertySet::getProperty(const String& name) const
 *************************************************************************/
 void PropertySet::setProperty(const String& name,const String& value)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	PropertyRegistry::const_iterator pos = properties.find(name);
 
-	if (pos == d_properties.end())
+	if (pos == properties.end())
 	{
 		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
 	}
@@ -148,7 +396,9 @@ void PropertySet::setProperty(const String& name,const String& value)
 *************************************************************************/
 PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 {
-	return PropertyIterator(d_properties.begin(), d_properties.end());
+    const PropertyRegistry& properties = d_propertyTable->getRegistry();
+
+    return PropertyIterator(properties.begin(), properties.end());
 }
 
 
@@ -157,9 +407,10 @@ PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 *************************************************************************/
 bool PropertySet::isPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	PropertyRegistry::const_iterator pos = properties.find(name);
 
-	if (pos == d_properties.end())
+	if (pos == properties.end())
 	{
 		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
 	}
@@ -173,9 +424,10 @@ bool PropertySet::isPropertyDefault(const String& name) const
 *************************************************************************/
 String PropertySet::getPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	const PropertyRegistry& properties = d_propertyTable->getRegistry();
+	PropertyRegistry::const_iterator pos = properties.find(name);
 
-	if (pos == d_properties.end())
+	if (pos == properties.end())
 	{
 		CEGUI_THROW(UnknownObjectException("There is no Property named '" + name + "' available in the set."));
 	}
@@ -32,6 +32,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/TplInterpolators.h"
 #include <limits>
 
 // Start of CEGUI namespace section
@@ -46,6 +47,35 @@ const String& QuaternionSlerpInterpolator::getType() const
     return type;
 }
 
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::absolute(const glm::quat& val1,
+                                               const glm::quat& val2,
+                                               float position)
+{
+    return glm::slerp(val1, val2, position);
+}
+
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::relative(const glm::quat& bas,
+                                               const glm::quat& val1,
+                                               const glm::quat& val2,
+                                               float position)
+{
+    return bas * glm::slerp(val1, val2, position);
+}
+
+//----------------------------------------------------------------------------//
+glm::quat QuaternionSlerpInterpolator::relativeMultiply(const glm::quat& /*bas*/,
+                                                       float /*val1*/,
+                                                       float /*val2*/,
+                                                       float /*position*/)
+{
+    CEGUI_THROW(InvalidRequestException("AM_RelativeMultiply doesn't make sense "
+        "with Quaternions! Please use absolute or relative application method."));
+
+    return glm::quat(1, 0, 0, 0);
+}
+
 //----------------------------------------------------------------------------//
 String QuaternionSlerpInterpolator::interpolateAbsolute(const String& value1,
                                     const String& value2,
@@ -54,7 +84,7 @@ String QuaternionSlerpInterpolator::interpolateAbsolute(const String& value1,
     Helper::return_type val1 = Helper::fromString(value1);
     Helper::return_type val2 = Helper::fromString(value2);
 
-    return Helper::toString(glm::slerp(val1, val2, position));
+    return Helper::toString(absolute(val1, val2, position));
 }
 
 //----------------------------------------------------------------------------//
@@ -67,7 +97,7 @@ String QuaternionSlerpInterpolator::interpolateRelative(const String& base,
     Helper::return_type val1 = Helper::fromString(value1);
     Helper::return_type val2 = Helper::fromString(value2);
 
-    return Helper::toString(bas * glm::slerp(val1, val2, position));
+    return Helper::toString(relative(bas, val1, val2, position));
 }
 
 //----------------------------------------------------------------------------//
@@ -75,12 +105,19 @@ String QuaternionSlerpInterpolator::interpolateRelativeMultiply(
                                             const String& /*base*/,
                                             const String& /*value1*/,
                                             const String& /*value2*/,
-                                            float /*position*/)
+                                            float position)
 {
-    CEGUI_THROW(InvalidRequestException("AM_RelativeMultiply doesn't make sense "
-        "with Quaternions! Please use absolute or relative application method."));
+    return Helper::toString(
+        relativeMultiply(glm::quat(1, 0, 0, 0), 0.0f, 0.0f, position));
+}
 
-    return Helper::toString(glm::quat(1, 0, 0, 0));
+//----------------------------------------------------------------------------//
+Interpolator::NativeApplier* QuaternionSlerpInterpolator::createNativeApplier(
+                                            PropertyReceiver* receiver,
+                                            Property* property)
+{
+    return TplNativeApplier<glm::quat, QuaternionSlerpInterpolator>::create(
+        receiver, property);
 }
 
 //----------------------------------------------------------------------------//
@@ -31,13 +31,52 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+bool RenderQueue::s_drawMergingEnabled = false;
+
 //----------------------------------------------------------------------------//
 void RenderQueue::draw() const
 {
-    // draw the buffers
-    BufferList::const_iterator i = d_buffers.begin();
-    for ( ; i != d_buffers.end(); ++i)
-        (*i)->draw();
+    if (!s_drawMergingEnabled)
+    {
+        // draw the buffers
+        BufferList::const_iterator i = d_buffers.begin();
+        for ( ; i != d_buffers.end(); ++i)
+            (*i)->draw();
+
+        return;
+    }
+
+    // draw each run of compatible buffers in one go, keeping the order
+    const size_t count = d_buffers.size();
+    size_t first = 0;
+    while (first < count)
+    {
+        const GeometryBuffer& buffer = *d_buffers[first];
+
+        size_t end = first + 1;
+        while (end < count && buffer.isDrawCompatible(*d_buffers[end]))
+            ++end;
+
+        if (end == first + 1)
+            buffer.draw();
+        else
+            buffer.drawWith(&d_buffers[first + 1], end - first - 1);
+
+        first = end;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setDrawMergingEnabled(bool setting)
+{
+    s_drawMergingEnabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderQueue::isDrawMergingEnabled()
+{
+    return s_drawMergingEnabled;
 }
 
 //----------------------------------------------------------------------------//
@@ -34,7 +34,9 @@ namespace CEGUI
 {
 
 Renderer::Renderer():
-    d_activeRenderTarget(0)
+    d_activeRenderTarget(0),
+    d_compactGeometry(false),
+    d_packedTexCoords(false)
 {}
 
 //----------------------------------------------------------------------------//
@@ -117,6 +119,52 @@ const glm::mat4& Renderer::getViewProjectionMatrix() const
     return d_viewProjectionMatrix;
 }
 
+//----------------------------------------------------------------------------//
+bool Renderer::isCompactGeometrySupported() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setCompactGeometryEnabled(bool setting)
+{
+    d_compactGeometry = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool Renderer::isCompactGeometryEnabled() const
+{
+    return d_compactGeometry;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setPackedTexCoordsEnabled(bool setting)
+{
+    d_packedTexCoords = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool Renderer::isPackedTexCoordsEnabled() const
+{
+    return d_packedTexCoords;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::addDefaultVertexAttributes(GeometryBuffer& buffer,
+                                          bool textured) const
+{
+    const bool compact = d_compactGeometry && isCompactGeometrySupported();
+
+    buffer.addVertexAttribute(VAT_POSITION0);
+    buffer.addVertexAttribute(compact ? VAT_COLOUR0_PACKED : VAT_COLOUR0);
+
+    if (textured)
+        buffer.addVertexAttribute(compact && d_packedTexCoords ?
+                                  VAT_TEXCOORD0_PACKED : VAT_TEXCOORD0);
+
+    buffer.setIndexedGeometryActive(compact);
+}
+
 //----------------------------------------------------------------------------//
 
 }
@@ -120,12 +120,16 @@ void Direct3D11GeometryBuffer::setClippingRegion(const Rectf& region)
     d_clipRect.right(ceguimax(0.0f, region.right()));
 }
 
-
 //----------------------------------------------------------------------------//
-void Direct3D11GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+const Rectf& Direct3D11GeometryBuffer::getClippingRegion() const
 {
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
+    return d_clipRect;
+}
+
 
+//----------------------------------------------------------------------------//
+void Direct3D11GeometryBuffer::onGeometryAppended()
+{
     updateVertexBuffer();
 }
 
@@ -132,6 +132,12 @@ void DirectFBGeometryBuffer::setClippingRegion(const Rectf& region)
     d_clipRect.right(ceguimax(0.0f, region.right()));
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& DirectFBGeometryBuffer::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
 //----------------------------------------------------------------------------//
 void DirectFBGeometryBuffer::appendVertex(const Vertex& vertex)
 {
@@ -184,6 +184,12 @@ void IrrlichtGeometryBuffer::setClippingRegion(const Rectf& region)
     d_clipRect.right(ceguimax(0.0f, region.right()));
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& IrrlichtGeometryBuffer::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
 //----------------------------------------------------------------------------//
 void IrrlichtGeometryBuffer::appendVertex(const Vertex& vertex)
 {
@@ -85,6 +85,12 @@ void IrrlichtResourceProvider::unloadRawDataContainer(RawDataContainer& data)
     }
 }
 
+//----------------------------------------------------------------------------//
+bool IrrlichtResourceProvider::isThreadSafe() const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
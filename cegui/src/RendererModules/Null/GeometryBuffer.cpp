@@ -68,12 +68,19 @@ void NullGeometryBuffer::setClippingRegion(const Rectf& region)
     d_clipRect.right(ceguimax(0.0f, region.right()));
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& NullGeometryBuffer::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
 //----------------------------------------------------------------------------//
 void NullGeometryBuffer::appendGeometry(const std::vector<float>& vertex_data)
 {
-    d_vertexData.insert(d_vertexData.end(), vertex_data.begin(), vertex_data.end());
-    // Update size of geometry buffer
-    d_vertexCount = d_vertexData.size();
+    if (vertex_data.empty())
+        return;
+
+    GeometryBuffer::appendGeometry(&vertex_data[0], vertex_data.size());
 }
 
 //----------------------------------------------------------------------------//
@@ -134,9 +134,7 @@ GeometryBuffer& NullRenderer::createGeometryBufferTextured(RefCounted<RenderMate
 {
     NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
 
-    geom_buffer->addVertexAttribute(VAT_POSITION0);
-    geom_buffer->addVertexAttribute(VAT_COLOUR0);
-    geom_buffer->addVertexAttribute(VAT_TEXCOORD0);
+    addDefaultVertexAttributes(*geom_buffer, true);
 
     addGeometryBuffer(*geom_buffer);
     return *geom_buffer;
@@ -147,8 +145,7 @@ GeometryBuffer& NullRenderer::createGeometryBufferColoured(RefCounted<RenderMate
 {
     NullGeometryBuffer* geom_buffer = new NullGeometryBuffer(renderMaterial);
 
-    geom_buffer->addVertexAttribute(VAT_POSITION0);
-    geom_buffer->addVertexAttribute(VAT_COLOUR0);
+    addDefaultVertexAttributes(*geom_buffer, false);
 
     addGeometryBuffer(*geom_buffer);
     return *geom_buffer;
@@ -325,6 +322,12 @@ const String& NullRenderer::getIdentifierString() const
     return d_rendererID;
 }
 
+//----------------------------------------------------------------------------//
+bool NullRenderer::isCompactGeometrySupported() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 NullRenderer::NullRenderer() :
     d_displayDPI(96, 96),
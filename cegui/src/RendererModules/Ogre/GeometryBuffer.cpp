@@ -146,10 +146,14 @@ void OgreGeometryBuffer::setClippingRegion(const Rectf& region)
 }
 
 //----------------------------------------------------------------------------//
-void OgreGeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+const Rectf& OgreGeometryBuffer::getClippingRegion() const
 {
-    GeometryBuffer::appendGeometry(vertex_data, array_size);
+    return d_clipRect;
+}
 
+//----------------------------------------------------------------------------//
+void OgreGeometryBuffer::onGeometryAppended()
+{
     d_dataAppended = true;
 }
 
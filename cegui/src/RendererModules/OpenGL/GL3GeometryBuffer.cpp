@@ -37,6 +37,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_access.hpp>
 
 #define BUFFER_OFFSET(i) ((char *)NULL + (i))
 
@@ -47,7 +48,11 @@ namespace CEGUI
 OpenGL3GeometryBuffer::OpenGL3GeometryBuffer(OpenGL3Renderer& owner, CEGUI::RefCounted<RenderMaterial> renderMaterial) :
     OpenGLGeometryBufferBase(owner, renderMaterial),
     d_glStateChanger(owner.getOpenGLStateChanger()),
-    d_bufferSize(0)
+    d_bufferSize(0),
+    d_indexBufferSize(0),
+    d_mergedVAO(0),
+    d_mergedVBO(0),
+    d_mergedEBO(0)
 {
     initialiseVertexBuffers();
 }
@@ -64,19 +69,7 @@ void OpenGL3GeometryBuffer::draw() const
     if(d_vertexData.empty())
         return;
 
-    CEGUI::Rectf viewPort = d_owner.getActiveViewPort();
-
-    if (d_clippingActive)
-    {
-        d_glStateChanger->scissor(static_cast<GLint>(d_clipRect.left()),
-            static_cast<GLint>(viewPort.getHeight() - d_clipRect.bottom()),
-            static_cast<GLint>(d_clipRect.getWidth()),
-            static_cast<GLint>(d_clipRect.getHeight()));
-
-        d_glStateChanger->enable(GL_SCISSOR_TEST);
-    }
-    else
-        d_glStateChanger->disable(GL_SCISSOR_TEST);
+    setupClippingAndBlendMode();
 
     // Update the model view projection matrix
     updateMatrix();
@@ -87,9 +80,6 @@ void OpenGL3GeometryBuffer::draw() const
     shaderParameterBindings->setParameter("modelViewProjMatrix", d_matrix);
     shaderParameterBindings->setParameter("alphaPercentage", d_alpha);
 
-    // activate desired blending mode
-    d_owner.setupRenderingBlendMode(d_blendMode);
-
     // Bind our vao
     d_glStateChanger->bindVertexArray(d_verticesVAO);
 
@@ -113,6 +103,134 @@ void OpenGL3GeometryBuffer::draw() const
     updateRenderTargetData(d_owner.getActiveRenderTarget());
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawWith(const GeometryBuffer* const* others,
+                                     std::size_t count) const
+{
+    // The geometry of all buffers is pre-transformed by each buffer's model
+    // matrix, so that it can be drawn with the view projection matrix alone.
+    // That needs the model matrices to be affine, which they normally are.
+    const glm::mat4 identity(1.0f);
+    const glm::vec4 affineRow(0.0f, 0.0f, 0.0f, 1.0f);
+
+    for (std::size_t i = 0; i <= count; ++i)
+    {
+        const GeometryBuffer& buffer = i == 0 ? *this : *others[i - 1];
+
+        if (glm::row(buffer.getModelMatrix(), 3) != affineRow)
+        {
+            GeometryBuffer::drawWith(others, count);
+            return;
+        }
+    }
+
+    // offset of the position within a vertex
+    std::size_t positionOffset = 0;
+    for (std::size_t a = 0; a < d_vertexAttributes.size() &&
+                            d_vertexAttributes[a] != VAT_POSITION0; ++a)
+        positionOffset += d_vertexAttributes[a] == VAT_COLOUR0 ? 4 :
+                          d_vertexAttributes[a] == VAT_TEXCOORD0 ? 2 : 1;
+
+    const std::size_t stride = getVertexAttributeElementCount();
+
+    d_mergedVertexData.clear();
+    d_mergedIndexData.clear();
+    for (std::size_t i = 0; i <= count; ++i)
+    {
+        const GeometryBuffer& buffer = i == 0 ? *this : *others[i - 1];
+        const std::vector<float>& data = buffer.getVertexData();
+        const std::size_t start = d_mergedVertexData.size();
+        d_mergedVertexData.insert(d_mergedVertexData.end(),
+                                  data.begin(), data.end());
+
+        // the indices of each buffer are offset by the vertices before it
+        const uint32 base_vertex = static_cast<uint32>(start / stride);
+        const std::vector<uint32>& indices = buffer.getIndexData();
+        for (std::size_t n = 0; n < indices.size(); ++n)
+            d_mergedIndexData.push_back(indices[n] + base_vertex);
+
+        const glm::mat4 model(buffer.getModelMatrix());
+        if (model == identity)
+            continue;
+
+        for (std::size_t v = start + positionOffset;
+             v + 2 < d_mergedVertexData.size(); v += stride)
+        {
+            const glm::vec4 position(model * glm::vec4(d_mergedVertexData[v],
+                                                       d_mergedVertexData[v + 1],
+                                                       d_mergedVertexData[v + 2],
+                                                       1.0f));
+            d_mergedVertexData[v] = position.x;
+            d_mergedVertexData[v + 1] = position.y;
+            d_mergedVertexData[v + 2] = position.z;
+        }
+    }
+
+    if (d_mergedVertexData.empty())
+        return;
+
+    setupClippingAndBlendMode();
+
+    CEGUI::ShaderParameterBindings* shaderParameterBindings = (*d_renderMaterial).getShaderParamBindings();
+    shaderParameterBindings->setParameter("modelViewProjMatrix", d_owner.getViewProjectionMatrix());
+    shaderParameterBindings->setParameter("alphaPercentage", d_alpha);
+
+    if (!d_mergedVAO)
+    {
+        glGenVertexArrays(1, &d_mergedVAO);
+        glGenBuffers(1, &d_mergedVBO);
+        glGenBuffers(1, &d_mergedEBO);
+
+        // the element buffer binding is part of the vao state
+        d_glStateChanger->bindVertexArray(d_mergedVAO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_mergedEBO);
+    }
+
+    // stream the merged geometry into our second vbo
+    d_glStateChanger->bindVertexArray(d_mergedVAO);
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_mergedVBO);
+    glBufferData(GL_ARRAY_BUFFER, d_mergedVertexData.size() * sizeof(float),
+                 &d_mergedVertexData[0], GL_STREAM_DRAW);
+    setupVertexAttributePointers();
+
+    if (d_indexedGeometry && !d_mergedIndexData.empty())
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     d_mergedIndexData.size() * sizeof(uint32),
+                     &d_mergedIndexData[0], GL_STREAM_DRAW);
+
+    d_renderMaterial->prepareForRendering();
+
+    d_glStateChanger->disable(GL_CULL_FACE);
+    d_glStateChanger->disable(GL_STENCIL_TEST);
+
+    if (d_indexedGeometry)
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(d_mergedIndexData.size()),
+                       GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+    else
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(d_mergedVertexData.size() / stride));
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::setupClippingAndBlendMode() const
+{
+    CEGUI::Rectf viewPort = d_owner.getActiveViewPort();
+
+    if (d_clippingActive)
+    {
+        d_glStateChanger->scissor(static_cast<GLint>(d_clipRect.left()),
+            static_cast<GLint>(viewPort.getHeight() - d_clipRect.bottom()),
+            static_cast<GLint>(d_clipRect.getWidth()),
+            static_cast<GLint>(d_clipRect.getHeight()));
+
+        d_glStateChanger->enable(GL_SCISSOR_TEST);
+    }
+    else
+        d_glStateChanger->disable(GL_SCISSOR_TEST);
+
+    // activate desired blending mode
+    d_owner.setupRenderingBlendMode(d_blendMode);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::reset()
 {
@@ -132,6 +250,10 @@ void OpenGL3GeometryBuffer::initialiseVertexBuffers()
 
     glBufferData(GL_ARRAY_BUFFER, 0, 0, GL_STATIC_DRAW);
 
+    // Generate the element buffer; its binding is stored in the vao
+    glGenBuffers(1, &d_indicesEBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_indicesEBO);
+
     // Unbind Vertex Attribute Array (VAO)
     d_glStateChanger->bindVertexArray(0);
 
@@ -147,6 +269,12 @@ void OpenGL3GeometryBuffer::finaliseVertexAttributes()
     d_glStateChanger->bindVertexArray(d_verticesVAO);
     d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesVBO);
 
+    setupVertexAttributePointers();
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::setupVertexAttributePointers() const
+{
     GLsizei stride = getVertexAttributeElementCount() * sizeof(GL_FLOAT);
 
     const CEGUI::OpenGLBaseShaderWrapper* gl3_shader_wrapper = static_cast<const CEGUI::OpenGLBaseShaderWrapper*>(d_renderMaterial->getShaderWrapper());
@@ -182,6 +310,22 @@ void OpenGL3GeometryBuffer::finaliseVertexAttributes()
                 dataOffset += 2;
             }
             break;
+        case VAT_COLOUR0_PACKED:
+            {
+                GLint shader_colour_loc = gl3_shader_wrapper->getAttributeLocation("inColour");
+                glVertexAttribPointer(shader_colour_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, BUFFER_OFFSET(dataOffset * sizeof(GL_FLOAT)));
+                glEnableVertexAttribArray(shader_colour_loc);
+                dataOffset += 1;
+            }
+            break;
+        case VAT_TEXCOORD0_PACKED:
+            {
+                GLint texture_coord_loc = gl3_shader_wrapper->getAttributeLocation("inTexCoord");
+                glVertexAttribPointer(texture_coord_loc, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, BUFFER_OFFSET(dataOffset * sizeof(GL_FLOAT)));
+                glEnableVertexAttribArray(texture_coord_loc);
+                dataOffset += 1;
+            }
+            break;
         default:
             break;
         }
@@ -194,6 +338,14 @@ void OpenGL3GeometryBuffer::deinitialiseOpenGLBuffers()
 {
     glDeleteVertexArrays(1, &d_verticesVAO);
     glDeleteBuffers(1, &d_verticesVBO);
+    glDeleteBuffers(1, &d_indicesEBO);
+
+    if (d_mergedVAO)
+    {
+        glDeleteVertexArrays(1, &d_mergedVAO);
+        glDeleteBuffers(1, &d_mergedVBO);
+        glDeleteBuffers(1, &d_mergedEBO);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -226,25 +378,45 @@ void OpenGL3GeometryBuffer::updateOpenGLBuffers()
     {
         glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, vertexData);
     }
+
+    if(!d_indexedGeometry)
+        return;
+
+    // The element buffer is bound through our vao
+    d_glStateChanger->bindVertexArray(d_verticesVAO);
+
+    const size_t indexCount = d_indexData.size();
+    const uint32* indexData = d_indexData.empty() ? 0 : &d_indexData[0];
+    const GLsizei indexDataSize = indexCount * sizeof(uint32);
+
+    if(d_indexBufferSize < indexCount)
+    {
+        d_indexBufferSize = indexCount;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexDataSize, indexData, GL_STATIC_DRAW);
+    }
+    else
+    {
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indexDataSize, indexData);
+    }
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+void OpenGL3GeometryBuffer::onGeometryAppended()
 {
-    OpenGLGeometryBufferBase::appendGeometry(vertex_data, array_size);
-
     updateOpenGLBuffers();
 }
 
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
 {
+    const unsigned int draw_count = getDrawCount();
+
     if(d_polygonFillRule == PFR_NONE)
     {
         d_glStateChanger->disable(GL_CULL_FACE);
         d_glStateChanger->disable(GL_STENCIL_TEST);
 
-        glDrawArrays(GL_TRIANGLES, 0, d_vertexCount);
+        drawTriangles(0, draw_count);
     }
     else if(d_polygonFillRule == PFR_EVEN_ODD)
     {
@@ -259,13 +431,13 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         glClear(GL_STENCIL_BUFFER_BIT);
         glStencilFunc(GL_ALWAYS, 0x00, 0xFF);
         glStencilOp(GL_INVERT, GL_KEEP, GL_INVERT);
-        glDrawArrays(GL_TRIANGLES, 0, d_vertexCount - d_postStencilVertexCount);
+        drawTriangles(0, draw_count - d_postStencilVertexCount);
 
-        unsigned int postStencilStart = d_vertexCount - d_postStencilVertexCount;
+        unsigned int postStencilStart = draw_count - d_postStencilVertexCount;
         glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
         glStencilMask(0x00);
         glStencilFunc(GL_EQUAL, 0xFF, 0xFF);
-        glDrawArrays(GL_TRIANGLES, postStencilStart, d_postStencilVertexCount);
+        drawTriangles(postStencilStart, d_postStencilVertexCount);
     }
     else if(d_polygonFillRule == PFR_NON_ZERO)
     {
@@ -275,7 +447,7 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         //A resulting 0 value means we are outside.
         glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 
-        unsigned int solid_fill_count = d_vertexCount - d_postStencilVertexCount;
+        unsigned int solid_fill_count = draw_count - d_postStencilVertexCount;
         unsigned int vertex_pos = 0;
 
         //Performing the back/front faces stencil incr and decr stencil op
@@ -287,11 +459,11 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
 
         glCullFace(GL_FRONT);
         glStencilOp(GL_KEEP, GL_KEEP, GL_INCR_WRAP);
-        glDrawArrays(GL_TRIANGLES, vertex_pos, solid_fill_count);
+        drawTriangles(vertex_pos, solid_fill_count);
 
         glCullFace(GL_BACK);
         glStencilOp(GL_KEEP, GL_KEEP, GL_DECR_WRAP);
-        glDrawArrays(GL_TRIANGLES, vertex_pos, solid_fill_count);
+        drawTriangles(vertex_pos, solid_fill_count);
 
         vertex_pos += solid_fill_count;
 
@@ -304,12 +476,21 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         if(d_postStencilVertexCount != 0)
         {
             glStencilFunc(GL_NOTEQUAL, 0x00, 0xFF);
-            glDrawArrays(GL_TRIANGLES, d_vertexCount - d_postStencilVertexCount, d_postStencilVertexCount);
+            drawTriangles(draw_count - d_postStencilVertexCount, d_postStencilVertexCount);
         }
     }
 }
 
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawTriangles(GLint first, GLsizei count) const
+{
+    if(d_indexedGeometry)
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, BUFFER_OFFSET(first * sizeof(uint32)));
+    else
+        glDrawArrays(GL_TRIANGLES, first, count);
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -329,6 +329,12 @@ bool OpenGL3Renderer::isS3TCSupported() const
     return d_s3tcSupported;
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isCompactGeometrySupported() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultShaderType shaderType) const
 {
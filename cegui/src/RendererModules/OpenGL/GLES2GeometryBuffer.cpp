@@ -251,10 +251,8 @@ void GLES2GeometryBuffer::updateOpenGLBuffers()
 }
 
 //----------------------------------------------------------------------------//
-void GLES2GeometryBuffer::appendGeometry(const float* vertex_data, std::size_t array_size)
+void GLES2GeometryBuffer::onGeometryAppended()
 {
-    OpenGLGeometryBufferBase::appendGeometry(vertex_data, array_size);
-
     updateOpenGLBuffers();
 }
 
@@ -60,6 +60,12 @@ void OpenGLGeometryBufferBase::setClippingRegion(const Rectf& region)
     d_clipRect.right(ceguimax(0.0f, region.right()));
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& OpenGLGeometryBufferBase::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLGeometryBufferBase::updateMatrix() const
 {
@@ -106,9 +106,7 @@ GeometryBuffer& OpenGLRendererBase::createGeometryBufferTextured(CEGUI::RefCount
 {
     OpenGLGeometryBufferBase* geom_buffer = createGeometryBuffer_impl(renderMaterial);
 
-    geom_buffer->addVertexAttribute(VAT_POSITION0);
-    geom_buffer->addVertexAttribute(VAT_COLOUR0);
-    geom_buffer->addVertexAttribute(VAT_TEXCOORD0);
+    addDefaultVertexAttributes(*geom_buffer, true);
     geom_buffer->finaliseVertexAttributes();
 
     addGeometryBuffer(*geom_buffer);
@@ -120,8 +118,7 @@ GeometryBuffer& OpenGLRendererBase::createGeometryBufferColoured(CEGUI::RefCount
 {
     OpenGLGeometryBufferBase* geom_buffer = createGeometryBuffer_impl(renderMaterial);
 
-    geom_buffer->addVertexAttribute(VAT_POSITION0);
-    geom_buffer->addVertexAttribute(VAT_COLOUR0);
+    addDefaultVertexAttributes(*geom_buffer, false);
     geom_buffer->finaliseVertexAttributes();
 
     addGeometryBuffer(*geom_buffer);
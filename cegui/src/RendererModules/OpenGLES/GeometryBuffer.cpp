@@ -130,6 +130,12 @@ void OpenGLESGeometryBuffer::setClippingRegion(const Rectf& region)
     d_clipRect = region;
 }
 
+//----------------------------------------------------------------------------//
+const Rectf& OpenGLESGeometryBuffer::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLESGeometryBuffer::appendGeometry(const Vertex* const vbuff,
     uint vertex_count)
@@ -0,0 +1,159 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/ShaderParameterBindings.h"
+#include "CEGUI/RenderEffect.h"
+#include "CEGUI/RenderMaterial.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner,
+        CEGUI::RefCounted<RenderMaterial> renderMaterial) :
+    GeometryBuffer(renderMaterial),
+    d_owner(owner),
+    d_clipRect(0, 0, 0, 0),
+    d_matrix(1.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::~SoftwareGeometryBuffer()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw() const
+{
+    SoftwareTexture* surface = d_owner.getActiveSurface();
+    if (d_vertexData.empty() || !surface)
+        return;
+
+    updateMatrix();
+
+    SoftwareRasteriser& rasteriser = d_owner.getRasteriser();
+    rasteriser.setSurface(*surface);
+    rasteriser.setTransform(d_matrix);
+    rasteriser.setClipRect(d_clippingActive ? &d_clipRect : 0);
+    rasteriser.setTexture(getActiveTexture());
+    rasteriser.setBlendMode(d_blendMode);
+    rasteriser.setAlpha(d_alpha);
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        d_renderMaterial->prepareForRendering();
+
+        // draw the geometry
+        drawDependingOnFillRule();
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+
+    updateRenderTargetData(d_owner.getActiveRenderTarget());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::drawDependingOnFillRule() const
+{
+    SoftwareRasteriser& rasteriser = d_owner.getRasteriser();
+    const int stride = getVertexAttributeElementCount();
+    const float* vertices = &d_vertexData[0];
+
+    if (d_polygonFillRule == PFR_NONE)
+    {
+        rasteriser.setStencilTest(SoftwareRasteriser::ST_NONE);
+        rasteriser.drawTriangles(vertices, d_vertexCount, stride);
+        return;
+    }
+
+    // the stencil is filled with the fill geometry, which then masks the
+    // geometry that follows it, as with the stencil buffer on the GPU.
+    const uint fill_count = d_vertexCount - d_postStencilVertexCount;
+
+    rasteriser.clearStencil();
+    rasteriser.drawStencilTriangles(vertices, fill_count, stride,
+        d_polygonFillRule == PFR_EVEN_ODD ?
+            SoftwareRasteriser::SO_INVERT :
+            SoftwareRasteriser::SO_INCREMENT_DECREMENT);
+
+    rasteriser.setStencilTest(d_polygonFillRule == PFR_EVEN_ODD ?
+        SoftwareRasteriser::ST_EQUAL_FULL : SoftwareRasteriser::ST_NOT_ZERO);
+    rasteriser.drawTriangles(vertices + fill_count * stride,
+                             d_postStencilVertexCount, stride);
+    rasteriser.setStencilTest(SoftwareRasteriser::ST_NONE);
+}
+
+//----------------------------------------------------------------------------//
+const SoftwareTexture* SoftwareGeometryBuffer::getActiveTexture() const
+{
+    ShaderParameter* param =
+        d_renderMaterial->getShaderParamBindings()->getParameter("texture0");
+
+    if (!param || param->getType() != SPT_TEXTURE)
+        return 0;
+
+    return static_cast<const SoftwareTexture*>(
+        static_cast<ShaderParameterTexture*>(param)->d_parameterValue);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::updateMatrix() const
+{
+    if (!d_matrixValid)
+    {
+        d_matrix = getModelMatrix();
+        d_matrixValid = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingRegion(const Rectf& region)
+{
+    d_clipRect.top(ceguimax(0.0f, region.top()));
+    d_clipRect.bottom(ceguimax(0.0f, region.bottom()));
+    d_clipRect.left(ceguimax(0.0f, region.left()));
+    d_clipRect.right(ceguimax(0.0f, region.right()));
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& SoftwareGeometryBuffer::getClippingRegion() const
+{
+    return d_clipRect;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,780 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+namespace
+{
+//! returns a * b / 255, rounded, for a and b in the range 0 - 255.
+inline uint32 mul255(const uint32 a, const uint32 b)
+{
+    const uint32 t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+//! linearly interpolates all four channels of two colours; w is 0 - 256.
+inline argb_t lerpColour(const argb_t a, const argb_t b, const uint32 w)
+{
+    // two channels are processed at once in each of rb and ag.
+    const uint32 rb = ((a & 0x00FF00FF) * (256 - w) +
+                       (b & 0x00FF00FF) * w) >> 8;
+    const uint32 ag = (((a >> 8) & 0x00FF00FF) * (256 - w) +
+                       ((b >> 8) & 0x00FF00FF) * w) >> 8;
+
+    return (rb & 0x00FF00FF) | ((ag & 0x00FF00FF) << 8);
+}
+
+//! converts a colour channel from 0 - 255 floating point to an integer.
+inline uint32 toChannel(const float value)
+{
+    if (value <= 0.0f)
+        return 0;
+    if (value >= 255.0f)
+        return 255;
+
+    return static_cast<uint32>(value + 0.5f);
+}
+
+//! blends src onto dst in the same way as BM_NORMAL on the GPU renderers.
+inline argb_t blendNormal(const argb_t src, const argb_t dst)
+{
+    const uint32 sa = src >> 24;
+    const uint32 da = dst >> 24;
+    const uint32 inv_sa = 255 - sa;
+
+    const uint32 r = mul255((src >> 16) & 0xFF, sa) + mul255((dst >> 16) & 0xFF, inv_sa);
+    const uint32 g = mul255((src >> 8) & 0xFF, sa) + mul255((dst >> 8) & 0xFF, inv_sa);
+    const uint32 b = mul255(src & 0xFF, sa) + mul255(dst & 0xFF, inv_sa);
+    const uint32 a = mul255(sa, 255 - da) + da;
+
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+//! blends src onto dst in the same way as BM_RTT_PREMULTIPLIED on the GPU.
+inline argb_t blendPremultiplied(const argb_t src, const argb_t dst)
+{
+    const uint32 inv_sa = 255 - (src >> 24);
+
+    const uint32 r = ceguimin<uint32>(255, ((src >> 16) & 0xFF) + mul255((dst >> 16) & 0xFF, inv_sa));
+    const uint32 g = ceguimin<uint32>(255, ((src >> 8) & 0xFF) + mul255((dst >> 8) & 0xFF, inv_sa));
+    const uint32 b = ceguimin<uint32>(255, (src & 0xFF) + mul255(dst & 0xFF, inv_sa));
+    const uint32 a = (src >> 24) + mul255(dst >> 24, inv_sa);
+
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+const int SoftwareRasteriser::TILE_HEIGHT = 32;
+const int SoftwareRasteriser::MIN_THREADED_PIXELS = 64 * 1024;
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::SoftwareRasteriser() :
+    d_surface(0),
+    d_clipLeft(0),
+    d_clipTop(0),
+    d_clipRight(-1),
+    d_clipBottom(-1),
+    d_clippingActive(false),
+    d_clipRect(0, 0, 0, 0),
+    d_texture(0),
+    d_blendMode(BM_NORMAL),
+    d_alpha(1.0f),
+    d_transform(1.0f),
+    d_stencilTest(ST_NONE),
+    d_drawSerial(0),
+    d_nextBandTop(0),
+    d_lastBandRow(-1),
+    d_bandsTextured(false),
+    d_busyWorkers(0),
+    d_stopWorkers(false)
+{
+    setWorkerThreadCount(ceguimin<uint>(7, Thread::getHardwareConcurrency() - 1));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::~SoftwareRasteriser()
+{
+    stopWorkers();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setWorkerThreadCount(uint count)
+{
+    stopWorkers();
+
+    d_busyWorkers = count;
+    d_workers.reserve(count);
+
+    CEGUI_TRY
+    {
+        for (uint i = 0; i < count; ++i)
+            d_workers.push_back(new Thread(&workerThreadMain, this));
+    }
+    CEGUI_CATCH(...)
+    {
+        stopWorkers();
+        d_busyWorkers = 0;
+        CEGUI_RETHROW;
+    }
+
+    // a worker must see the serial of the next draw change, so wait for all
+    // of them to have started before a draw can be queued.
+    MutexLock lock(d_bandMutex);
+    while (d_busyWorkers != 0)
+        d_bandsDone.wait(d_bandMutex);
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRasteriser::getWorkerThreadCount() const
+{
+    return static_cast<uint>(d_workers.size());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::stopWorkers()
+{
+    {
+        MutexLock lock(d_bandMutex);
+        d_stopWorkers = true;
+    }
+    d_bandsQueued.notifyAll();
+
+    // destroying a Thread waits for it to exit.
+    for (size_t i = 0; i < d_workers.size(); ++i)
+        delete d_workers[i];
+
+    d_workers.clear();
+    d_stopWorkers = false;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::workerThreadMain(void* rasteriser)
+{
+    static_cast<SoftwareRasteriser*>(rasteriser)->runWorker();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::runWorker()
+{
+    MutexLock lock(d_bandMutex);
+    uint serial = d_drawSerial;
+
+    if (--d_busyWorkers == 0)
+        d_bandsDone.notifyOne();
+
+    for (;;)
+    {
+        while (!d_stopWorkers && serial == d_drawSerial)
+            d_bandsQueued.wait(d_bandMutex);
+
+        if (d_stopWorkers)
+            return;
+
+        serial = d_drawSerial;
+
+        d_bandMutex.unlock();
+        rasteriseQueuedBands();
+        d_bandMutex.lock();
+
+        if (--d_busyWorkers == 0)
+            d_bandsDone.notifyOne();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::rasteriseQueuedBands()
+{
+    for (;;)
+    {
+        int band_top;
+        bool textured;
+        {
+            MutexLock lock(d_bandMutex);
+            if (d_nextBandTop > d_lastBandRow)
+                return;
+
+            band_top = d_nextBandTop;
+            textured = d_bandsTextured;
+            d_nextBandTop += TILE_HEIGHT;
+        }
+
+        rasteriseBand(band_top, textured);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setSurface(SoftwareTexture& surface)
+{
+    d_surface = &surface;
+
+    const size_t pixel_count =
+        static_cast<size_t>(surface.getPixelWidth()) * surface.getPixelHeight();
+    if (d_stencil.size() < pixel_count)
+        d_stencil.resize(pixel_count, 0);
+
+    updateClipBounds();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setClipRect(const Rectf* rect)
+{
+    d_clippingActive = rect != 0;
+    if (rect)
+        d_clipRect = *rect;
+
+    updateClipBounds();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::updateClipBounds()
+{
+    const float width = d_surface ?
+        static_cast<float>(d_surface->getPixelWidth()) : 0.0f;
+    const float height = d_surface ?
+        static_cast<float>(d_surface->getPixelHeight()) : 0.0f;
+
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = width;
+    float bottom = height;
+
+    if (d_clippingActive)
+    {
+        left = ceguimax(left, d_clipRect.left());
+        top = ceguimax(top, d_clipRect.top());
+        right = ceguimin(right, d_clipRect.right());
+        bottom = ceguimin(bottom, d_clipRect.bottom());
+    }
+
+    // truncate like the scissor rectangles of the hardware renderers.
+    d_clipLeft = static_cast<int>(left);
+    d_clipTop = static_cast<int>(top);
+    d_clipRight = static_cast<int>(right) - 1;
+    d_clipBottom = static_cast<int>(bottom) - 1;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setTexture(const SoftwareTexture* texture)
+{
+    d_texture = texture;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setBlendMode(BlendMode mode)
+{
+    d_blendMode = mode;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setAlpha(float alpha)
+{
+    d_alpha = alpha;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setTransform(const glm::mat4& transform)
+{
+    d_transform = transform;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setStencilTest(StencilTest test)
+{
+    d_stencilTest = test;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::clearStencil()
+{
+    std::fill(d_stencil.begin(), d_stencil.end(), 0);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::drawTriangles(const float* vertex_data,
+                                       uint vertex_count, int stride)
+{
+    if (!d_surface)
+        return;
+
+    const bool textured = stride >= 9 && d_texture &&
+                          d_texture->getPixelWidth() != 0 &&
+                          d_texture->getPixelHeight() != 0;
+
+    setupTriangles(vertex_data, vertex_count, stride, textured);
+    if (d_triangles.empty())
+        return;
+
+    int min_y = d_triangles.front().d_minY;
+    int max_y = d_triangles.front().d_maxY;
+    size_t pixel_count = 0;
+    for (size_t i = 0; i < d_triangles.size(); ++i)
+    {
+        const Triangle& tri = d_triangles[i];
+        min_y = ceguimin(min_y, tri.d_minY);
+        max_y = ceguimax(max_y, tri.d_maxY);
+        pixel_count += static_cast<size_t>(tri.d_maxX - tri.d_minX + 1) *
+                       (tri.d_maxY - tri.d_minY + 1);
+    }
+
+    if (d_workers.empty() || max_y - min_y < TILE_HEIGHT ||
+        pixel_count < static_cast<size_t>(MIN_THREADED_PIXELS))
+    {
+        for (int band_top = min_y; band_top <= max_y; band_top += TILE_HEIGHT)
+            rasteriseBand(band_top, textured);
+
+        return;
+    }
+
+    {
+        MutexLock lock(d_bandMutex);
+        d_nextBandTop = min_y;
+        d_lastBandRow = max_y;
+        d_bandsTextured = textured;
+        d_busyWorkers = static_cast<uint>(d_workers.size());
+        ++d_drawSerial;
+    }
+    d_bandsQueued.notifyAll();
+
+    rasteriseQueuedBands();
+
+    // the surface must be complete before the next draw starts blending.
+    MutexLock lock(d_bandMutex);
+    while (d_busyWorkers != 0)
+        d_bandsDone.wait(d_bandMutex);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::rasteriseBand(int band_top, bool textured) const
+{
+    const int band_bottom = band_top + TILE_HEIGHT - 1;
+
+    // triangles are processed in submission order within each band, so
+    // blending gives the same result as drawing them one after another.
+    for (size_t i = 0; i < d_triangles.size(); ++i)
+    {
+        const Triangle& tri = d_triangles[i];
+        if (tri.d_maxY < band_top || tri.d_minY > band_bottom)
+            continue;
+
+        const int y_end = ceguimin(tri.d_maxY, band_bottom);
+        for (int y = ceguimax(tri.d_minY, band_top); y <= y_end; ++y)
+        {
+            int x_start, x_end;
+            if (getSpan(tri, y, x_start, x_end))
+                fillSpan(tri, y, x_start, x_end, textured);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::drawStencilTriangles(const float* vertex_data,
+                                              uint vertex_count, int stride,
+                                              StencilOperation op)
+{
+    if (!d_surface)
+        return;
+
+    setupTriangles(vertex_data, vertex_count, stride, false);
+
+    const int width = static_cast<int>(d_surface->getPixelWidth());
+
+    for (size_t i = 0; i < d_triangles.size(); ++i)
+    {
+        const Triangle& tri = d_triangles[i];
+
+        for (int y = tri.d_minY; y <= tri.d_maxY; ++y)
+        {
+            int x_start, x_end;
+            if (!getSpan(tri, y, x_start, x_end))
+                continue;
+
+            uint8* stencil = &d_stencil[y * width];
+
+            if (op == SO_INVERT)
+            {
+                for (int x = x_start; x <= x_end; ++x)
+                    stencil[x] = ~stencil[x];
+            }
+            else
+            {
+                const uint8 delta = tri.d_frontFacing ? 1 : 0xFF;
+                for (int x = x_start; x <= x_end; ++x)
+                    stencil[x] += delta;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setupTriangles(const float* vertex_data,
+                                        uint vertex_count, int stride,
+                                        bool textured)
+{
+    d_triangles.clear();
+
+    if (d_clipLeft > d_clipRight || d_clipTop > d_clipBottom)
+        return;
+
+    const uint triangle_count = vertex_count / 3;
+    d_triangles.reserve(triangle_count);
+
+    Triangle tri;
+    const float* v = vertex_data;
+    for (uint i = 0; i < triangle_count; ++i, v += 3 * stride)
+    {
+        if (setupTriangle(v, v + stride, v + 2 * stride, textured, tri))
+            d_triangles.push_back(tri);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::setupTriangle(const float* v0, const float* v1,
+                                       const float* v2, bool textured,
+                                       Triangle& tri) const
+{
+    const float* const v[3] = { v0, v1, v2 };
+    const glm::mat4& m = d_transform;
+
+    float x[3];
+    float y[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        x[i] = m[0][0] * v[i][0] + m[1][0] * v[i][1] + m[2][0] * v[i][2] + m[3][0];
+        y[i] = m[0][1] * v[i][0] + m[1][1] * v[i][1] + m[2][1] * v[i][2] + m[3][1];
+    }
+
+    const float area = (x[1] - x[0]) * (y[2] - y[0]) -
+                       (y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0.0f)
+        return false;
+
+    // pixel bounds, clamped to the scissor rectangle before converting so
+    // that far off-screen geometry can not overflow.
+    const float min_x = ceguimin(x[0], ceguimin(x[1], x[2]));
+    const float max_x = ceguimax(x[0], ceguimax(x[1], x[2]));
+    const float min_y = ceguimin(y[0], ceguimin(y[1], y[2]));
+    const float max_y = ceguimax(y[0], ceguimax(y[1], y[2]));
+
+    tri.d_minX = static_cast<int>(std::floor(
+        ceguimax(min_x, static_cast<float>(d_clipLeft))));
+    tri.d_maxX = static_cast<int>(std::ceil(
+        ceguimin(max_x, static_cast<float>(d_clipRight + 1)))) - 1;
+    tri.d_minY = static_cast<int>(std::floor(
+        ceguimax(min_y, static_cast<float>(d_clipTop))));
+    tri.d_maxY = static_cast<int>(std::ceil(
+        ceguimin(max_y, static_cast<float>(d_clipBottom + 1)))) - 1;
+
+    if (tri.d_minX > tri.d_maxX || tri.d_minY > tri.d_maxY)
+        return false;
+
+    // edge functions, oriented to be positive inside the triangle.
+    const float sign = area > 0.0f ? 1.0f : -1.0f;
+    for (int i = 0; i < 3; ++i)
+    {
+        const int a = i;
+        const int b = (i + 1) % 3;
+
+        tri.d_edgeA[i] = (y[a] - y[b]) * sign;
+        tri.d_edgeB[i] = (x[b] - x[a]) * sign;
+        tri.d_edgeC[i] = -(tri.d_edgeA[i] * x[a] + tri.d_edgeB[i] * y[a]);
+        // top-left fill convention, so shared edges are only drawn once.
+        tri.d_edgeInclusive[i] = tri.d_edgeA[i] > 0.0f ||
+            (tri.d_edgeA[i] == 0.0f && tri.d_edgeB[i] > 0.0f);
+    }
+
+    tri.d_frontFacing = area < 0.0f;
+
+    // attribute values at the vertices: colour then texture co-ordinates.
+    float attr[3][ATTRIBUTE_COUNT];
+    for (int i = 0; i < 3; ++i)
+    {
+        attr[i][0] = v[i][3];
+        attr[i][1] = v[i][4];
+        attr[i][2] = v[i][5];
+        attr[i][3] = v[i][6] * d_alpha;
+        attr[i][4] = textured ? v[i][7] : 0.0f;
+        attr[i][5] = textured ? v[i][8] : 0.0f;
+    }
+
+    tri.d_flatColour =
+        attr[0][0] == attr[1][0] && attr[0][0] == attr[2][0] &&
+        attr[0][1] == attr[1][1] && attr[0][1] == attr[2][1] &&
+        attr[0][2] == attr[1][2] && attr[0][2] == attr[2][2] &&
+        attr[0][3] == attr[1][3] && attr[0][3] == attr[2][3];
+
+    // the edge function of edge i is proportional to the barycentric
+    // weight of the vertex opposite to it.
+    const float inv_area = 1.0f / (area * sign);
+    for (int k = 0; k < ATTRIBUTE_COUNT; ++k)
+    {
+        tri.d_attrDx[k] = tri.d_attrDy[k] = tri.d_attrC[k] = 0.0f;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const float value = attr[(i + 2) % 3][k] * inv_area;
+            tri.d_attrDx[k] += tri.d_edgeA[i] * value;
+            tri.d_attrDy[k] += tri.d_edgeB[i] * value;
+            tri.d_attrC[k] += tri.d_edgeC[i] * value;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::getSpan(const Triangle& tri, int y,
+                                 int& x_start, int& x_end)
+{
+    const float py = static_cast<float>(y) + 0.5f;
+
+    float start = static_cast<float>(tri.d_minX);
+    float end = static_cast<float>(tri.d_maxX);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const float a = tri.d_edgeA[i];
+        const float row = tri.d_edgeB[i] * py + tri.d_edgeC[i];
+
+        if (a == 0.0f)
+        {
+            if (row < 0.0f || (row == 0.0f && !tri.d_edgeInclusive[i]))
+                return false;
+
+            continue;
+        }
+
+        // pixel x is covered when a * (x + 0.5) + row >= 0 (or > 0).
+        const float t = -row / a - 0.5f;
+
+        if (a > 0.0f)
+            start = ceguimax(start, tri.d_edgeInclusive[i] ?
+                std::ceil(t) : std::floor(t) + 1.0f);
+        else
+            end = ceguimin(end, tri.d_edgeInclusive[i] ?
+                std::floor(t) : std::ceil(t) - 1.0f);
+    }
+
+    if (start > end)
+        return false;
+
+    x_start = static_cast<int>(start);
+    x_end = static_cast<int>(end);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::fillSpan(const Triangle& tri, int y, int x_start,
+                                  int x_end, bool textured) const
+{
+    const size_t row_offset =
+        static_cast<size_t>(y) * d_surface->getPixelWidth();
+    argb_t* dst = d_surface->getPixels() + row_offset;
+    const uint8* stencil =
+        d_stencilTest == ST_NONE ? 0 : &d_stencil[row_offset];
+    const float py = static_cast<float>(y) + 0.5f;
+
+    if (tri.d_flatColour && !textured)
+    {
+        const float px = static_cast<float>(x_start) + 0.5f;
+        uint32 channel[4];
+        for (int k = 0; k < 4; ++k)
+            channel[k] = toChannel(255.0f * (tri.d_attrDx[k] * px +
+                tri.d_attrDy[k] * py + tri.d_attrC[k]));
+
+        fillSolidSpan(dst + x_start, stencil ? stencil + x_start : 0,
+                      x_end - x_start + 1,
+                      (channel[3] << 24) | (channel[0] << 16) |
+                      (channel[1] << 8) | channel[2]);
+    }
+    else if (d_blendMode == BM_RTT_PREMULTIPLIED)
+    {
+        if (textured)
+            fillInterpolatedSpan<true, true>(tri, dst, stencil, x_start, x_end, py);
+        else
+            fillInterpolatedSpan<false, true>(tri, dst, stencil, x_start, x_end, py);
+    }
+    else
+    {
+        if (textured)
+            fillInterpolatedSpan<true, false>(tri, dst, stencil, x_start, x_end, py);
+        else
+            fillInterpolatedSpan<false, false>(tri, dst, stencil, x_start, x_end, py);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::fillSolidSpan(argb_t* dst, const uint8* stencil,
+                                       int count, argb_t colour) const
+{
+    const uint32 alpha = colour >> 24;
+
+    if (stencil)
+    {
+        for (int i = 0; i < count; ++i)
+            if (stencilPasses(stencil[i]))
+                dst[i] = blend(colour, dst[i]);
+    }
+    // opaque fragments replace the destination under both blend modes.
+    else if (alpha == 255)
+        std::fill(dst, dst + count, colour);
+    else if (alpha == 0 && d_blendMode != BM_RTT_PREMULTIPLIED)
+        return;
+    else if (d_blendMode == BM_RTT_PREMULTIPLIED)
+    {
+        for (int i = 0; i < count; ++i)
+            dst[i] = blendPremultiplied(colour, dst[i]);
+    }
+    else
+    {
+        for (int i = 0; i < count; ++i)
+            dst[i] = blendNormal(colour, dst[i]);
+    }
+}
+
+//----------------------------------------------------------------------------//
+template<bool Textured, bool Premultiplied>
+void SoftwareRasteriser::fillInterpolatedSpan(const Triangle& tri,
+                                              argb_t* dst,
+                                              const uint8* stencil,
+                                              int x_start, int x_end,
+                                              float py) const
+{
+    const float px = static_cast<float>(x_start) + 0.5f;
+
+    float value[ATTRIBUTE_COUNT];
+    for (int k = 0; k < ATTRIBUTE_COUNT; ++k)
+        value[k] = tri.d_attrDx[k] * px + tri.d_attrDy[k] * py + tri.d_attrC[k];
+
+    for (int x = x_start; x <= x_end; ++x)
+    {
+        if (!stencil || stencilPasses(stencil[x]))
+        {
+            float r = value[0];
+            float g = value[1];
+            float b = value[2];
+            float a = value[3];
+
+            if (Textured)
+            {
+                const argb_t texel = sampleTexture(value[4], value[5]);
+                r *= static_cast<float>((texel >> 16) & 0xFF);
+                g *= static_cast<float>((texel >> 8) & 0xFF);
+                b *= static_cast<float>(texel & 0xFF);
+                a *= static_cast<float>(texel >> 24);
+            }
+            else
+            {
+                r *= 255.0f;
+                g *= 255.0f;
+                b *= 255.0f;
+                a *= 255.0f;
+            }
+
+            const argb_t src = (toChannel(a) << 24) | (toChannel(r) << 16) |
+                               (toChannel(g) << 8) | toChannel(b);
+
+            dst[x] = Premultiplied ? blendPremultiplied(src, dst[x]) :
+                                     blendNormal(src, dst[x]);
+        }
+
+        for (int k = 0; k < ATTRIBUTE_COUNT; ++k)
+            value[k] += tri.d_attrDx[k];
+    }
+}
+
+//----------------------------------------------------------------------------//
+argb_t SoftwareRasteriser::sampleTexture(float u, float v) const
+{
+    const int width = static_cast<int>(d_texture->getPixelWidth());
+    const int height = static_cast<int>(d_texture->getPixelHeight());
+
+    // texel centres are at half integers; clamp to edge like the GPU
+    // renderers, before converting so that large co-ordinates can not
+    // overflow.
+    const float fx = ceguimax(-1.0f, ceguimin(static_cast<float>(width),
+        u * width - 0.5f));
+    const float fy = ceguimax(-1.0f, ceguimin(static_cast<float>(height),
+        v * height - 0.5f));
+    const float floor_x = std::floor(fx);
+    const float floor_y = std::floor(fy);
+
+    const uint32 wx = static_cast<uint32>((fx - floor_x) * 256.0f + 0.5f);
+    const uint32 wy = static_cast<uint32>((fy - floor_y) * 256.0f + 0.5f);
+
+    const int x0 = static_cast<int>(floor_x);
+    const int y0 = static_cast<int>(floor_y);
+    const int cx0 = ceguimax(0, ceguimin(width - 1, x0));
+    const int cx1 = ceguimax(0, ceguimin(width - 1, x0 + 1));
+    const int cy0 = ceguimax(0, ceguimin(height - 1, y0));
+    const int cy1 = ceguimax(0, ceguimin(height - 1, y0 + 1));
+
+    const argb_t* row0 = d_texture->getPixels() + cy0 * width;
+    const argb_t* row1 = d_texture->getPixels() + cy1 * width;
+
+    // pixel aligned geometry samples exactly at texel centres.
+    if (wx == 0 && wy == 0)
+        return row0[cx0];
+
+    return lerpColour(lerpColour(row0[cx0], row0[cx1], wx),
+                      lerpColour(row1[cx0], row1[cx1], wx),
+                      wy);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::stencilPasses(uint8 value) const
+{
+    switch (d_stencilTest)
+    {
+    case ST_EQUAL_FULL:
+        return value == 0xFF;
+
+    case ST_NOT_ZERO:
+        return value != 0;
+
+    default:
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+argb_t SoftwareRasteriser::blend(argb_t src, argb_t dst) const
+{
+    return d_blendMode == BM_RTT_PREMULTIPLIED ?
+        blendPremultiplied(src, dst) : blendNormal(src, dst);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
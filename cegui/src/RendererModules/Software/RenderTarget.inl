@@ -0,0 +1,106 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+template<typename T>
+SoftwareRenderTarget<T>::SoftwareRenderTarget(SoftwareRenderer& owner,
+                                              SoftwareTexture* surface) :
+    d_owner(owner),
+    d_surface(surface)
+{
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+SoftwareRenderTarget<T>::~SoftwareRenderTarget()
+{
+    if (d_owner.getActiveSurface() == d_surface)
+        d_owner.setActiveSurface(0);
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+void SoftwareRenderTarget<T>::activate()
+{
+    d_owner.setActiveSurface(d_surface);
+
+    RenderTarget::activate();
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+void SoftwareRenderTarget<T>::deactivate()
+{
+    RenderTarget::deactivate();
+
+    d_owner.setActiveSurface(0);
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+void SoftwareRenderTarget<T>::unprojectPoint(const GeometryBuffer& buff,
+    const glm::vec2& p_in, glm::vec2& p_out) const
+{
+    // geometry is projected orthographically, so the point on the plane of
+    // the buffer is found by inverting the 2D part of the model matrix.
+    const glm::mat4 m(buff.getModelMatrix());
+
+    const float det = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+    if (det == 0.0f)
+    {
+        p_out = p_in;
+        return;
+    }
+
+    const float x = p_in.x - m[3][0];
+    const float y = p_in.y - m[3][1];
+
+    p_out.x = (m[1][1] * x - m[1][0] * y) / det;
+    p_out.y = (m[0][0] * y - m[0][1] * x) / det;
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+bool SoftwareRenderTarget<T>::isImageryCache() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+template <typename T>
+SoftwareRenderer& SoftwareRenderTarget<T>::getOwner()
+{
+    return d_owner;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,399 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RendererModules/Software/ShaderWrapper.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Logger.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+    "CEGUI::SoftwareRenderer - CPU based software rasteriser renderer.");
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Sizef& display_size,
+                                                    const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    if (System::getSingletonPtr())
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is already initialised."));
+
+    SoftwareRenderer& renderer = create(display_size);
+    DefaultResourceProvider* rp(new DefaultResourceProvider());
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys;
+    if (!(sys = System::getSingletonPtr()))
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is not created or was already destroyed."));
+
+    SoftwareRenderer* renderer = static_cast<SoftwareRenderer*>(sys->getRenderer());
+    DefaultResourceProvider* rp =
+        static_cast<DefaultResourceProvider*>(sys->getResourceProvider());
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Sizef& display_size,
+                                           const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    return *new SoftwareRenderer(display_size);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture& SoftwareRenderer::getFrameBuffer() const
+{
+    return *d_frameBuffer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setActiveSurface(SoftwareTexture* surface)
+{
+    d_activeSurface = surface;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture* SoftwareRenderer::getActiveSurface() const
+{
+    return d_activeSurface;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser& SoftwareRenderer::getRasteriser() const
+{
+    return *d_rasteriser;
+}
+
+//----------------------------------------------------------------------------//
+RenderTarget& SoftwareRenderer::getDefaultRenderTarget()
+{
+    return *d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+RefCounted<RenderMaterial> SoftwareRenderer::createRenderMaterial(const DefaultShaderType shaderType) const
+{
+    if(shaderType == DS_TEXTURED)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperTextured));
+
+        return render_material;
+    }
+    else if(shaderType == DS_SOLID)
+    {
+        RefCounted<RenderMaterial> render_material(new RenderMaterial(d_shaderWrapperSolid));
+
+        return render_material;
+    }
+    else
+    {
+        CEGUI_THROW(RendererException(
+            "A default shader of this type does not exist."));
+
+        return RefCounted<RenderMaterial>();
+    }
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VAT_POSITION0);
+    geom_buffer->addVertexAttribute(VAT_COLOUR0);
+    geom_buffer->addVertexAttribute(VAT_TEXCOORD0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VAT_POSITION0);
+    geom_buffer->addVertexAttribute(VAT_COLOUR0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget()
+{
+    TextureTarget* tt = new SoftwareTextureTarget(*this);
+    d_textureTargets.push_back(tt);
+    return tt;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                              d_textureTargets.end(),
+                                              target);
+
+    if (d_textureTargets.end() != i)
+    {
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const String& filename,
+                                         const String& resourceGroup)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, filename, resourceGroup);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const Sizef& size)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, size);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::throwIfNameExists(const String& name) const
+{
+    if (d_textures.find(name) != d_textures.end())
+        CEGUI_THROW(AlreadyExistsException(
+            "[SoftwareRenderer] Texture already exists: " + name));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureCreation(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Created texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    destroyTexture(texture.getName());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(const String& name)
+{
+    TextureMap::iterator i = d_textures.find(name);
+
+    if (d_textures.end() != i)
+    {
+        logTextureDestruction(name);
+        delete i->second;
+        d_textures.erase(i);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureDestruction(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Destroyed texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(d_textures.begin()->first);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::getTexture(const String& name) const
+{
+    TextureMap::const_iterator i = d_textures.find(name);
+
+    if (i == d_textures.end())
+        CEGUI_THROW(UnknownObjectException(
+            "Texture does not exist: " + name));
+
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTextureDefined(const String& name) const
+{
+    return d_textures.find(name) != d_textures.end();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+const glm::vec2& SoftwareRenderer::getDisplayDPI() const
+{
+    return d_displayDPI;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRenderer::getMaxTextureSize() const
+{
+    return d_maxTextureSize;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Sizef& display_size) :
+    d_displaySize(0, 0),
+    d_displayDPI(96, 96),
+    d_frameBuffer(new SoftwareTexture("_software_frame_buffer_")),
+    d_defaultTarget(0),
+    d_activeSurface(0),
+    d_rasteriser(new SoftwareRasteriser()),
+    d_maxTextureSize(8192),
+    d_shaderWrapperTextured(new SoftwareShaderWrapper()),
+    d_shaderWrapperSolid(new SoftwareShaderWrapper())
+{
+    // create default target & rendering root (surface) that uses it
+    d_defaultTarget = new SoftwareRenderTarget<>(*this, d_frameBuffer);
+
+    setDisplaySize(display_size);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    delete d_shaderWrapperTextured;
+    delete d_shaderWrapperSolid;
+
+    destroyAllGeometryBuffers();
+    destroyAllTextureTargets();
+    destroyAllTextures();
+
+    delete d_defaultTarget;
+    delete d_frameBuffer;
+    delete d_rasteriser;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Sizef& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+        d_frameBuffer->resize(sz);
+
+        Rectf area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
+//----------------------------------------------------------------------------//
+// Implementation of template base class
+#include "./RenderTarget.inl"
@@ -0,0 +1,246 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+argb_t* SoftwareTexture::getPixels()
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+const argb_t* SoftwareTexture::getPixels() const
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelWidth() const
+{
+    return d_pixelWidth;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelHeight() const
+{
+    return d_pixelHeight;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::resize(const Sizef& sz)
+{
+    d_pixelWidth = static_cast<uint>(ceguimax(0.0f, sz.d_width));
+    d_pixelHeight = static_cast<uint>(ceguimax(0.0f, sz.d_height));
+
+    d_pixels.assign(static_cast<size_t>(d_pixelWidth) * d_pixelHeight, 0);
+
+    d_size = d_dataSize = Sizef(static_cast<float>(d_pixelWidth),
+                                static_cast<float>(d_pixelHeight));
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::clear(argb_t colour)
+{
+    std::fill(d_pixels.begin(), d_pixels.end(), colour);
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareTexture::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const glm::vec2& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        CEGUI_THROW(RendererException(
+            "CEGUI::System object has not been created!"));
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+                                                     resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    // throw exception if data was load loaded to texture.
+    if (!res)
+        CEGUI_THROW(RendererException(
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Sizef& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        CEGUI_THROW(InvalidRequestException(
+            "Data was supplied in an unsupported pixel format."));
+
+    resize(buffer_size);
+
+    if (pixel_format == PF_RGBA)
+    {
+        blitFromMemory(buffer, Rectf(glm::vec2(0, 0), d_size));
+        return;
+    }
+
+    const uint8* src = static_cast<const uint8*>(buffer);
+    for (size_t i = 0; i < d_pixels.size(); ++i, src += 3)
+        d_pixels[i] = 0xFF000000 | (src[0] << 16) | (src[1] << 8) | src[2];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitFromMemory(const void* sourceData, const Rectf& area)
+{
+    const int left = static_cast<int>(area.left());
+    const int top = static_cast<int>(area.top());
+    const int width = static_cast<int>(area.getWidth());
+    const int height = static_cast<int>(area.getHeight());
+
+    if (left < 0 || top < 0 ||
+        left + width > static_cast<int>(d_pixelWidth) ||
+        top + height > static_cast<int>(d_pixelHeight))
+        CEGUI_THROW(InvalidRequestException(
+            "The area to blit lies outside of the texture."));
+
+    const uint8* src = static_cast<const uint8*>(sourceData);
+    for (int y = 0; y < height; ++y)
+    {
+        argb_t* dst = &d_pixels[(top + y) * d_pixelWidth + left];
+
+        for (int x = 0; x < width; ++x, src += 4)
+            dst[x] = (src[3] << 24) | (src[0] << 16) | (src[1] << 8) | src[2];
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitToMemory(void* targetData)
+{
+    uint8* dst = static_cast<uint8*>(targetData);
+    for (size_t i = 0; i < d_pixels.size(); ++i, dst += 4)
+    {
+        const argb_t pixel = d_pixels[i];
+        dst[0] = static_cast<uint8>(pixel >> 16);
+        dst[1] = static_cast<uint8>(pixel >> 8);
+        dst[2] = static_cast<uint8>(pixel);
+        dst[3] = static_cast<uint8>(pixel >> 24);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::updateCachedScaleValues()
+{
+    d_texelScaling.x = d_size.d_width > 0.0f ? 1.0f / d_size.d_width : 0.0f;
+    d_texelScaling.y = d_size.d_height > 0.0f ? 1.0f / d_size.d_height : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const String& filename,
+                                 const String& resourceGroup) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const Sizef& sz) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    resize(sz);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    return fmt == PF_RGBA || fmt == PF_RGB;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
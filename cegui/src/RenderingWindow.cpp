@@ -260,7 +260,7 @@ void RenderingWindow::realiseGeometry_impl()
 
     const Rectf area(0, 0, d_size.d_width, d_size.d_height);
     const glm::vec4 colour(1.0, 1.0, 1.0, 1.0);
-    TexturedColouredVertex vbuffer[6];
+    TexturedColouredVertex vbuffer[4];
 
     // vertex 0
     vbuffer[0].d_position   = glm::vec3(area.d_min.d_x, area.d_min.d_y, 0.0f);
@@ -282,18 +282,8 @@ void RenderingWindow::realiseGeometry_impl()
     vbuffer[3].d_colour = colour;
     vbuffer[3].d_texCoords = glm::vec2(tex_rect.d_max.d_x, tex_rect.d_min.d_y);
 
-    // vertex 4
-    vbuffer[4].d_position   = glm::vec3(area.d_min.d_x, area.d_min.d_y, 0.0f);
-    vbuffer[4].d_colour = colour;
-    vbuffer[4].d_texCoords = glm::vec2(tex_rect.d_min.d_x, tex_rect.d_min.d_y);
-
-    // vertex 5
-    vbuffer[5].d_position   = glm::vec3(area.d_max.d_x, area.d_max.d_y, 0.0f);
-    vbuffer[5].d_colour = colour;
-    vbuffer[5].d_texCoords = glm::vec2(tex_rect.d_max.d_x, tex_rect.d_max.d_y);
-
     d_geometryBuffer.setTexture("texture0", &tex);
-    d_geometryBuffer.appendGeometry(vbuffer, 6);
+    d_geometryBuffer.appendQuads(vbuffer, 1);
 }
 
 //----------------------------------------------------------------------------//
@@ -450,4 +450,1072 @@ void	swap(String& str1, String& str2)
 
 } // End of  CEGUI namespace section
 
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <utility>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+
+// definition of 'no position' value
+const String::size_type String::npos = (String::size_type)(-1);
+
+//----------------------------------------------------------------------------//
+// Returns the length of the valid UTF-8 sequence at ptr, or 0 if the bytes do
+// not form a valid (shortest form, non-surrogate) sequence.
+static size_t getValidSequenceLength(const utf8* ptr, const utf8* end)
+{
+    const utf8 lead = *ptr;
+
+    if (lead < 0x80)
+        return 1;
+
+    size_t length;
+    if (lead >= 0xC2 && lead <= 0xDF)
+        length = 2;
+    else if (lead >= 0xE0 && lead <= 0xEF)
+        length = 3;
+    else if (lead >= 0xF0 && lead <= 0xF4)
+        length = 4;
+    else
+        return 0;
+
+    if (static_cast<size_t>(end - ptr) < length)
+        return 0;
+
+    for (size_t i = 1; i < length; ++i)
+        if ((ptr[i] & 0xC0) != 0x80)
+            return 0;
+
+    // reject overlong forms, surrogates and code points above U+10FFFF
+    if ((lead == 0xE0 && ptr[1] < 0xA0) ||
+        (lead == 0xED && ptr[1] >= 0xA0) ||
+        (lead == 0xF0 && ptr[1] < 0x90) ||
+        (lead == 0xF4 && ptr[1] >= 0x90))
+        return 0;
+
+    return length;
+}
+
+//----------------------------------------------------------------------------//
+// Returns the offset of the first occurrence of needle in haystack at or after
+// 'from', or String::npos.
+static size_t findBytes(const char* haystack, size_t haystack_len, size_t from,
+                        const char* needle, size_t needle_len)
+{
+    if (needle_len > haystack_len)
+        return String::npos;
+
+    const size_t last = haystack_len - needle_len;
+    for (size_t pos = from; pos <= last; ++pos)
+    {
+        const void* found = std::memchr(haystack + pos, needle[0], last - pos + 1);
+        if (!found)
+            break;
+
+        pos = static_cast<const char*>(found) - haystack;
+        if (std::memcmp(haystack + pos, needle, needle_len) == 0)
+            return pos;
+    }
+
+    return String::npos;
+}
+
+//----------------------------------------------------------------------------//
+// Returns the offset of the last occurrence of needle in haystack starting at
+// or before 'from', or String::npos.
+static size_t rfindBytes(const char* haystack, size_t haystack_len, size_t from,
+                         const char* needle, size_t needle_len)
+{
+    if (needle_len > haystack_len)
+        return String::npos;
+
+    for (size_t pos = std::min(from, haystack_len - needle_len); ; --pos)
+    {
+        if (std::memcmp(haystack + pos, needle, needle_len) == 0)
+            return pos;
+
+        if (pos == 0)
+            break;
+    }
+
+    return String::npos;
+}
+
+//----------------------------------------------------------------------------//
+utf32 String::decode(const char* ptr)
+{
+    const utf8* p = reinterpret_cast<const utf8*>(ptr);
+
+    if (p[0] < 0x80)
+        return p[0];
+
+    if (p[0] < 0xE0)
+        return ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+
+    if (p[0] < 0xF0)
+        return ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+
+    return ((p[0] & 0x07) << 18) | ((p[1] & 0x3F) << 12) |
+           ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::encode(utf32 code_point, char* dest)
+{
+    // surrogates and values beyond the Unicode range can not be encoded
+    if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF)
+        code_point = 0xFFFD;
+
+    if (code_point < 0x80)
+    {
+        dest[0] = static_cast<char>(code_point);
+        return 1;
+    }
+
+    if (code_point < 0x800)
+    {
+        dest[0] = static_cast<char>(0xC0 | (code_point >> 6));
+        dest[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+
+    if (code_point < 0x10000)
+    {
+        dest[0] = static_cast<char>(0xE0 | (code_point >> 12));
+        dest[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        dest[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+
+    dest[0] = static_cast<char>(0xF0 | (code_point >> 18));
+    dest[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    dest[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    dest[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+//----------------------------------------------------------------------------//
+void String::reserve(size_type num)
+{
+    if (num <= d_capacity)
+        return;
+
+    if (num > max_size())
+        CEGUI_THROW(std::length_error("Resulting CEGUI::String would be too big"));
+
+    char* new_buffer = new char[num + 1];
+    std::memcpy(new_buffer, d_buffer, d_length + 1);
+
+    if (d_buffer != d_smallBuffer)
+        delete[] d_buffer;
+
+    d_buffer = new_buffer;
+    d_capacity = num;
+}
+
+//----------------------------------------------------------------------------//
+void String::shrink_to_fit()
+{
+    if (d_buffer == d_smallBuffer || d_length == d_capacity)
+        return;
+
+    char* new_buffer = d_smallBuffer;
+    size_type new_capacity = CEGUI_STR_SMALL_BUFFER_SIZE - 1;
+
+    if (d_length >= CEGUI_STR_SMALL_BUFFER_SIZE)
+    {
+        new_buffer = new char[d_length + 1];
+        new_capacity = d_length;
+    }
+
+    std::memcpy(new_buffer, d_buffer, d_length + 1);
+    delete[] d_buffer;
+
+    d_buffer = new_buffer;
+    d_capacity = new_capacity;
+}
+
+//----------------------------------------------------------------------------//
+int String::compare(size_type idx, size_type len, const String& str,
+                    size_type str_idx, size_type str_len) const
+{
+    if (idx > d_cplength || str_idx > str.d_cplength)
+        CEGUI_THROW(std::out_of_range("Index is out of range for CEGUI::String"));
+
+    len = std::min(len, d_cplength - idx);
+    str_len = std::min(str_len, str.d_cplength - str_idx);
+
+    const size_type begin = getEncodedOffset(idx);
+    const size_type end = getEncodedOffset(idx + len);
+    const size_type str_begin = str.getEncodedOffset(str_idx);
+    const size_type str_end = str.getEncodedOffset(str_idx + str_len);
+
+    return compareEncoded(d_buffer + begin, end - begin,
+                          str.d_buffer + str_begin, str_end - str_begin);
+}
+
+//----------------------------------------------------------------------------//
+utf32 String::at(size_type idx) const
+{
+    if (idx >= d_cplength)
+        CEGUI_THROW(std::out_of_range("Index is out of range for CEGUI::String"));
+
+    return (*this)[idx];
+}
+
+//----------------------------------------------------------------------------//
+String& String::assign(const String& str, size_type str_idx, size_type str_num)
+{
+    return replace(0, d_cplength, str, str_idx, str_num);
+}
+
+//----------------------------------------------------------------------------//
+String& String::assign(const std::string& std_str, size_type str_idx, size_type str_num)
+{
+    if (str_idx == 0 && str_num == npos)
+        return assign(std_str.data(), std_str.size());
+
+    // indices are in code points, so the data must be decoded first
+    return assign(String(std_str), str_idx, str_num);
+}
+
+//----------------------------------------------------------------------------//
+void String::swap(String& str) CEGUI_STRING_NOEXCEPT
+{
+    if (this == &str)
+        return;
+
+    const bool this_small = d_buffer == d_smallBuffer;
+    const bool str_small = str.d_buffer == str.d_smallBuffer;
+
+    std::swap(d_buffer, str.d_buffer);
+    std::swap(d_length, str.d_length);
+    std::swap(d_capacity, str.d_capacity);
+    std::swap(d_cplength, str.d_cplength);
+    std::swap(d_cacheIndex, str.d_cacheIndex);
+    std::swap(d_cacheOffset, str.d_cacheOffset);
+    std::swap_ranges(d_smallBuffer, d_smallBuffer + CEGUI_STR_SMALL_BUFFER_SIZE,
+                     str.d_smallBuffer);
+
+    // inline data moved along with the buffers, so point at our own copy
+    if (str_small)
+        d_buffer = d_smallBuffer;
+    if (this_small)
+        str.d_buffer = str.d_smallBuffer;
+}
+
+//----------------------------------------------------------------------------//
+String& String::append(size_type num, utf32 code_point)
+{
+    char encoded[4];
+    const size_type encoded_length = encode(code_point, encoded);
+
+    if (num > (max_size() - d_length) / encoded_length)
+        CEGUI_THROW(std::length_error("Resulting CEGUI::String would be too big"));
+
+    const size_type new_length = d_length + num * encoded_length;
+    if (new_length > d_capacity)
+        reserve(std::max(new_length, d_capacity * 2));
+
+    char* dest = d_buffer + d_length;
+    for (size_type i = 0; i < num; ++i, dest += encoded_length)
+        std::memcpy(dest, encoded, encoded_length);
+
+    setLength(new_length, d_cplength + num);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+String& String::append(const_iterator iter_beg, const_iterator iter_end)
+{
+    size_type count = 0;
+    for (const_iterator iter = iter_beg; iter != iter_end; ++iter)
+        ++count;
+
+    return replaceEncoded(d_length, 0, 0, iter_beg.getEncodedPtr(),
+                          iter_end.getEncodedPtr() - iter_beg.getEncodedPtr(),
+                          count);
+}
+
+//----------------------------------------------------------------------------//
+String::iterator String::insert(iterator pos, utf32 code_point)
+{
+    const size_type offset = pos.getEncodedPtr() - d_buffer;
+
+    char encoded[4];
+    replaceEncoded(offset, 0, 0, encoded, encode(code_point, encoded), 1);
+
+    return iterator(d_buffer + offset);
+}
+
+//----------------------------------------------------------------------------//
+String& String::erase(iterator iter_beg, iterator iter_end)
+{
+    size_type count = 0;
+    for (const_iterator iter = iter_beg; iter != iter_end; ++iter)
+        ++count;
+
+    const size_type offset = iter_beg.getEncodedPtr() - d_buffer;
+    return replaceEncoded(offset,
+                          iter_end.getEncodedPtr() - iter_beg.getEncodedPtr(),
+                          count, 0, 0, 0);
+}
+
+//----------------------------------------------------------------------------//
+void String::resize(size_type num, utf32 code_point)
+{
+    if (num < d_cplength)
+        erase(num);
+    else
+        append(num - d_cplength, code_point);
+}
+
+//----------------------------------------------------------------------------//
+String& String::replace(size_type idx, size_type len, const String& str,
+                        size_type str_idx, size_type str_num)
+{
+    if (idx > d_cplength || str_idx > str.d_cplength)
+        CEGUI_THROW(std::out_of_range("Index is out of range for CEGUI::String"));
+
+    len = std::min(len, d_cplength - idx);
+    str_num = std::min(str_num, str.d_cplength - str_idx);
+
+    const size_type begin = getEncodedOffset(idx);
+    const size_type end = getEncodedOffset(idx + len);
+    const size_type str_begin = str.getEncodedOffset(str_idx);
+    const size_type str_end = str.getEncodedOffset(str_idx + str_num);
+
+    return replaceEncoded(begin, end - begin, len,
+                          str.d_buffer + str_begin, str_end - str_begin, str_num);
+}
+
+//----------------------------------------------------------------------------//
+String& String::replace(iterator iter_beg, iterator iter_end, const String& str)
+{
+    size_type count = 0;
+    for (const_iterator iter = iter_beg; iter != iter_end; ++iter)
+        ++count;
+
+    const size_type offset = iter_beg.getEncodedPtr() - d_buffer;
+    return replaceEncoded(offset,
+                          iter_end.getEncodedPtr() - iter_beg.getEncodedPtr(),
+                          count, str.d_buffer, str.d_length, str.d_cplength);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find(utf32 code_point, size_type idx) const
+{
+    if (idx >= d_cplength)
+        return npos;
+
+    char encoded[4];
+    const size_type offset = findBytes(d_buffer, d_length, getEncodedOffset(idx),
+                                       encoded, encode(code_point, encoded));
+
+    return offset == npos ? npos : getCodePointIndex(offset);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::rfind(utf32 code_point, size_type idx) const
+{
+    if (d_cplength == 0)
+        return npos;
+
+    char encoded[4];
+    const size_type offset =
+        rfindBytes(d_buffer, d_length,
+                   getEncodedOffset(std::min(idx, d_cplength - 1)),
+                   encoded, encode(code_point, encoded));
+
+    return offset == npos ? npos : getCodePointIndex(offset);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find(const String& str, size_type idx) const
+{
+    if (idx > d_cplength)
+        return npos;
+
+    if (str.empty())
+        return idx;
+
+    const size_type offset = findBytes(d_buffer, d_length, getEncodedOffset(idx),
+                                       str.d_buffer, str.d_length);
+
+    return offset == npos ? npos : getCodePointIndex(offset);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::rfind(const String& str, size_type idx) const
+{
+    if (str.d_cplength > d_cplength)
+        return npos;
+
+    const size_type start = std::min(idx, d_cplength - str.d_cplength);
+
+    if (str.empty())
+        return start;
+
+    const size_type offset = rfindBytes(d_buffer, d_length, getEncodedOffset(start),
+                                        str.d_buffer, str.d_length);
+
+    return offset == npos ? npos : getCodePointIndex(offset);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find_first_of(const String& str, size_type idx) const
+{
+    if (idx >= d_cplength)
+        return npos;
+
+    const_iterator iter(d_buffer + getEncodedOffset(idx));
+    for (; idx < d_cplength; ++idx, ++iter)
+        if (str.find(*iter) != npos)
+            return idx;
+
+    return npos;
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find_first_not_of(const String& str, size_type idx) const
+{
+    if (idx >= d_cplength)
+        return npos;
+
+    const_iterator iter(d_buffer + getEncodedOffset(idx));
+    for (; idx < d_cplength; ++idx, ++iter)
+        if (str.find(*iter) == npos)
+            return idx;
+
+    return npos;
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find_last_of(const String& str, size_type idx) const
+{
+    if (d_cplength == 0)
+        return npos;
+
+    idx = std::min(idx, d_cplength - 1);
+    const_iterator iter(d_buffer + getEncodedOffset(idx));
+    for (; ; --idx, --iter)
+    {
+        if (str.find(*iter) != npos)
+            return idx;
+
+        if (idx == 0)
+            return npos;
+    }
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::find_last_not_of(const String& str, size_type idx) const
+{
+    if (d_cplength == 0)
+        return npos;
+
+    idx = std::min(idx, d_cplength - 1);
+    const_iterator iter(d_buffer + getEncodedOffset(idx));
+    for (; ; --idx, --iter)
+    {
+        if (str.find(*iter) == npos)
+            return idx;
+
+        if (idx == 0)
+            return npos;
+    }
+}
+
+//----------------------------------------------------------------------------//
+String String::substr(size_type idx, size_type len) const
+{
+    if (idx > d_cplength)
+        CEGUI_THROW(std::out_of_range("Index is out of range for CEGUI::String"));
+
+    len = std::min(len, d_cplength - idx);
+
+    const size_type begin = getEncodedOffset(idx);
+    const size_type end = getEncodedOffset(idx + len);
+
+    String result;
+    result.replaceEncoded(0, 0, 0, d_buffer + begin, end - begin, len);
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+String& String::replaceEncoded(size_type offset, size_type length,
+                               size_type cplength,
+                               const char* data, size_type data_length,
+                               size_type data_cplength)
+{
+    const size_type tail_length = d_length - offset - length;
+    const size_type new_length = offset + data_length + tail_length;
+
+    if (data_length > max_size() - offset - tail_length)
+        CEGUI_THROW(std::length_error("Resulting CEGUI::String would be too big"));
+
+    if (new_length > d_capacity)
+    {
+        // grow geometrically so that repeated appends are amortised
+        const size_type new_capacity = std::max(new_length, d_capacity * 2);
+        char* new_buffer = new char[new_capacity + 1];
+
+        std::memcpy(new_buffer, d_buffer, offset);
+        std::memcpy(new_buffer + offset, data, data_length);
+        std::memcpy(new_buffer + offset + data_length,
+                    d_buffer + offset + length, tail_length);
+
+        if (d_buffer != d_smallBuffer)
+            delete[] d_buffer;
+
+        d_buffer = new_buffer;
+        d_capacity = new_capacity;
+    }
+    else if (data_length != 0 &&
+             data + data_length > d_buffer && data < d_buffer + d_length)
+    {
+        // the data is part of this string and would be overwritten
+        const std::string temp(data, data_length);
+        return replaceEncoded(offset, length, cplength,
+                              temp.data(), data_length, data_cplength);
+    }
+    else
+    {
+        std::memmove(d_buffer + offset + data_length,
+                     d_buffer + offset + length, tail_length);
+        if (data_length != 0)
+            std::memcpy(d_buffer + offset, data, data_length);
+    }
+
+    // code points before the modified range keep their offsets
+    if (d_cacheOffset > offset)
+    {
+        d_cacheIndex = 0;
+        d_cacheOffset = 0;
+    }
+
+    setLength(new_length, d_cplength - cplength + data_cplength);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+String& String::replaceRaw(size_type offset, size_type length,
+                           const char* chars, size_type chars_len)
+{
+    size_type cplength = d_cplength;
+    if (length == 0)
+        cplength = 0;
+    else if (length != d_length)
+        cplength = getCodePointIndex(offset + length) - getCodePointIndex(offset);
+
+    const utf8* pos = reinterpret_cast<const utf8*>(chars);
+    const utf8* const end = pos + chars_len;
+    size_type count = 0;
+
+    // common case: the data is valid UTF-8 and can be copied as it is
+    while (pos != end)
+    {
+        // skip ASCII a word at a time
+        if (static_cast<size_t>(end - pos) >= sizeof(uint64))
+        {
+            uint64 word;
+            std::memcpy(&word, pos, sizeof(word));
+            if (!(word & 0x8080808080808080ULL))
+            {
+                pos += sizeof(word);
+                count += sizeof(word);
+                continue;
+            }
+        }
+
+        if (*pos < 0x80)
+        {
+            ++pos;
+            ++count;
+            continue;
+        }
+
+        const size_t sequence_length = getValidSequenceLength(pos, end);
+        if (!sequence_length)
+            break;
+
+        pos += sequence_length;
+        ++count;
+    }
+
+    if (pos == end)
+        return replaceEncoded(offset, length, cplength, chars, chars_len, count);
+
+    // otherwise take invalid bytes as Latin-1 code points
+    std::vector<char> encoded(reinterpret_cast<const char*>(pos) - chars);
+    encoded.reserve(chars_len * 2);
+    if (!encoded.empty())
+        std::memcpy(&encoded[0], chars, encoded.size());
+
+    while (pos != end)
+    {
+        const size_t sequence_length = getValidSequenceLength(pos, end);
+
+        if (sequence_length)
+        {
+            encoded.insert(encoded.end(), pos, pos + sequence_length);
+            pos += sequence_length;
+        }
+        else
+        {
+            char latin1[4];
+            encoded.insert(encoded.end(), latin1, latin1 + encode(*pos++, latin1));
+        }
+
+        ++count;
+    }
+
+    return replaceEncoded(offset, length, cplength,
+                          &encoded[0], encoded.size(), count);
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::getEncodedOffset(size_type idx) const
+{
+    if (idx >= d_cplength)
+        return d_length;
+
+    // pure ASCII, so indices and offsets are the same
+    if (d_length == d_cplength)
+        return idx;
+
+    // start from whichever of the start, the end and the cached position is
+    // closest to the requested code point
+    size_type index = d_cacheIndex;
+    size_type offset = d_cacheOffset;
+    const size_type cache_distance =
+        idx > d_cacheIndex ? idx - d_cacheIndex : d_cacheIndex - idx;
+
+    if (idx <= cache_distance)
+    {
+        index = 0;
+        offset = 0;
+    }
+    else if (d_cplength - idx < cache_distance)
+    {
+        index = d_cplength;
+        offset = d_length;
+    }
+
+    for (; index < idx; ++index)
+        offset += sequenceLength(d_buffer[offset]);
+
+    for (; index > idx; --index)
+    {
+        do
+            --offset;
+        while (isContinuationByte(d_buffer[offset]));
+    }
+
+    d_cacheIndex = index;
+    d_cacheOffset = offset;
+    return offset;
+}
+
+//----------------------------------------------------------------------------//
+String::size_type String::getCodePointIndex(size_type offset) const
+{
+    if (offset >= d_length)
+        return d_cplength;
+
+    if (d_length == d_cplength)
+        return offset;
+
+    size_type index = 0;
+    size_type position = 0;
+
+    if (d_length - offset < offset - std::min(offset, d_cacheOffset))
+    {
+        // closer to the end, so walk backwards from there
+        index = d_cplength;
+        position = d_length;
+
+        while (position > offset)
+        {
+            do
+                --position;
+            while (isContinuationByte(d_buffer[position]));
+
+            --index;
+        }
+    }
+    else
+    {
+        if (d_cacheOffset <= offset)
+        {
+            index = d_cacheIndex;
+            position = d_cacheOffset;
+        }
+
+        for (; position < offset; ++index)
+            position += sequenceLength(d_buffer[position]);
+    }
+
+    d_cacheIndex = index;
+    d_cacheOffset = position;
+    return index;
+}
+
+//----------------------------------------------------------------------------//
+int String::compareRaw(const char* chars, size_type chars_len) const
+{
+    const utf8* pos = reinterpret_cast<const utf8*>(chars);
+    const utf8* const end = pos + chars_len;
+
+    while (pos != end)
+    {
+        const size_t sequence_length = getValidSequenceLength(pos, end);
+        if (!sequence_length)
+            // compare against the data as it would be stored in a String
+            return compare(String(chars, chars_len));
+
+        pos += sequence_length;
+    }
+
+    return compareEncoded(d_buffer, d_length, chars, chars_len);
+}
+
+//----------------------------------------------------------------------------//
+int String::compareEncoded(const char* a, size_type a_len,
+                           const char* b, size_type b_len)
+{
+    // UTF-8 byte order is the same as code point order
+    const int result = std::memcmp(a, b, std::min(a_len, b_len));
+
+    if (result != 0)
+        return result;
+
+    return a_len < b_len ? -1 : (a_len > b_len ? 1 : 0);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Comparison operators
+//////////////////////////////////////////////////////////////////////////
+bool operator==(const String& str1, const String& str2)
+{
+    return str1.utf8_length() == str2.utf8_length() &&
+           std::memcmp(str1.c_str(), str2.c_str(), str1.utf8_length()) == 0;
+}
+
+bool operator==(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) == 0;
+}
+
+bool operator==(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) == 0;
+}
+
+bool operator==(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) == 0;
+}
+
+bool operator==(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) == 0;
+}
+
+bool operator==(const String& str, const char* c_str)
+{
+    return str.compare(c_str) == 0;
+}
+
+bool operator==(const char* c_str, const String& str)
+{
+    return str.compare(c_str) == 0;
+}
+
+bool operator!=(const String& str1, const String& str2)
+{
+    return !(str1 == str2);
+}
+
+bool operator!=(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) != 0;
+}
+
+bool operator!=(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) != 0;
+}
+
+bool operator!=(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) != 0;
+}
+
+bool operator!=(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) != 0;
+}
+
+bool operator!=(const String& str, const char* c_str)
+{
+    return str.compare(c_str) != 0;
+}
+
+bool operator!=(const char* c_str, const String& str)
+{
+    return str.compare(c_str) != 0;
+}
+
+bool operator<(const String& str1, const String& str2)
+{
+    return str1.compare(str2) < 0;
+}
+
+bool operator<(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) < 0;
+}
+
+bool operator<(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) > 0;
+}
+
+bool operator<(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) < 0;
+}
+
+bool operator<(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) > 0;
+}
+
+bool operator<(const String& str, const char* c_str)
+{
+    return str.compare(c_str) < 0;
+}
+
+bool operator<(const char* c_str, const String& str)
+{
+    return str.compare(c_str) > 0;
+}
+
+bool operator>(const String& str1, const String& str2)
+{
+    return str1.compare(str2) > 0;
+}
+
+bool operator>(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) > 0;
+}
+
+bool operator>(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) < 0;
+}
+
+bool operator>(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) > 0;
+}
+
+bool operator>(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) < 0;
+}
+
+bool operator>(const String& str, const char* c_str)
+{
+    return str.compare(c_str) > 0;
+}
+
+bool operator>(const char* c_str, const String& str)
+{
+    return str.compare(c_str) < 0;
+}
+
+bool operator<=(const String& str1, const String& str2)
+{
+    return str1.compare(str2) <= 0;
+}
+
+bool operator<=(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) <= 0;
+}
+
+bool operator<=(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) >= 0;
+}
+
+bool operator<=(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) <= 0;
+}
+
+bool operator<=(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) >= 0;
+}
+
+bool operator<=(const String& str, const char* c_str)
+{
+    return str.compare(c_str) <= 0;
+}
+
+bool operator<=(const char* c_str, const String& str)
+{
+    return str.compare(c_str) >= 0;
+}
+
+bool operator>=(const String& str1, const String& str2)
+{
+    return str1.compare(str2) >= 0;
+}
+
+bool operator>=(const String& str, const std::string& std_str)
+{
+    return str.compare(std_str) >= 0;
+}
+
+bool operator>=(const std::string& std_str, const String& str)
+{
+    return str.compare(std_str) <= 0;
+}
+
+bool operator>=(const String& str, const utf8* utf8_str)
+{
+    return str.compare(utf8_str) >= 0;
+}
+
+bool operator>=(const utf8* utf8_str, const String& str)
+{
+    return str.compare(utf8_str) <= 0;
+}
+
+bool operator>=(const String& str, const char* c_str)
+{
+    return str.compare(c_str) >= 0;
+}
+
+bool operator>=(const char* c_str, const String& str)
+{
+    return str.compare(c_str) <= 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Concatenation operator functions
+//////////////////////////////////////////////////////////////////////////
+String operator+(const String& str1, const String& str2)
+{
+    String temp;
+    temp.reserve(str1.utf8_length() + str2.utf8_length());
+    temp.append(str1);
+    temp.append(str2);
+    return temp;
+}
+
+String operator+(const String& str, const std::string& std_str)
+{
+    String temp(str);
+    temp.append(std_str);
+    return temp;
+}
+
+String operator+(const std::string& std_str, const String& str)
+{
+    String temp(std_str);
+    temp.append(str);
+    return temp;
+}
+
+String operator+(const String& str, const utf8* utf8_str)
+{
+    String temp(str);
+    temp.append(utf8_str);
+    return temp;
+}
+
+String operator+(const utf8* utf8_str, const String& str)
+{
+    String temp(utf8_str);
+    temp.append(str);
+    return temp;
+}
+
+String operator+(const String& str, utf32 code_point)
+{
+    String temp(str);
+    temp.push_back(code_point);
+    return temp;
+}
+
+String operator+(utf32 code_point, const String& str)
+{
+    String temp(1, code_point);
+    temp.append(str);
+    return temp;
+}
+
+String operator+(const String& str, const char* c_str)
+{
+    String temp(str);
+    temp.append(c_str);
+    return temp;
+}
+
+String operator+(const char* c_str, const String& str)
+{
+    String temp(c_str);
+    temp.append(str);
+    return temp;
+}
+
+#ifdef CEGUI_STRING_HAS_MOVE_SEMANTICS
+String operator+(String&& str1, const String& str2)
+{
+    str1.append(str2);
+    return std::move(str1);
+}
+
+String operator+(String&& str, const char* c_str)
+{
+    str.append(c_str);
+    return std::move(str);
+}
+
+String operator+(String&& str, utf32 code_point)
+{
+    str.push_back(code_point);
+    return std::move(str);
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Output (stream) functions
+//////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& s, const String& str)
+{
+    return s << str.c_str();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Modifying operations
+//////////////////////////////////////////////////////////////////////////
+void swap(String& str1, String& str2)
+{
+    str1.swap(str2);
+}
+
+} // End of  CEGUI namespace section
+
 #endif
@@ -421,6 +421,7 @@ const String& System::getVerboseVersion()
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
+    FontManager::getSingleton().notifyFrameStarted();
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -438,6 +439,7 @@ void System::renderAllGUIContexts()
 
 void System::renderAllGUIContextsOnTarget(Renderer* contained_in)
 {
+    FontManager::getSingleton().notifyFrameStarted();
     d_renderer->beginRendering();
 
     for (GUIContextCollection::iterator i = d_guiContexts.begin();
@@ -0,0 +1,261 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Threading.h"
+#include "CEGUI/Exceptions.h"
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#   include <process.h>
+#else
+#   include <pthread.h>
+#   include <unistd.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+#if defined(__WIN32__) || defined(_WIN32)
+//----------------------------------------------------------------------------//
+Mutex::Mutex() :
+    d_impl(new CRITICAL_SECTION)
+{
+    InitializeCriticalSection(static_cast<CRITICAL_SECTION*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Mutex::~Mutex()
+{
+    DeleteCriticalSection(static_cast<CRITICAL_SECTION*>(d_impl));
+    delete static_cast<CRITICAL_SECTION*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::lock()
+{
+    EnterCriticalSection(static_cast<CRITICAL_SECTION*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::unlock()
+{
+    LeaveCriticalSection(static_cast<CRITICAL_SECTION*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Condition::Condition() :
+    d_impl(new CONDITION_VARIABLE)
+{
+    InitializeConditionVariable(static_cast<CONDITION_VARIABLE*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Condition::~Condition()
+{
+    delete static_cast<CONDITION_VARIABLE*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Condition::wait(Mutex& mutex)
+{
+    SleepConditionVariableCS(static_cast<CONDITION_VARIABLE*>(d_impl),
+                             static_cast<CRITICAL_SECTION*>(mutex.d_impl),
+                             INFINITE);
+}
+
+//----------------------------------------------------------------------------//
+void Condition::notifyOne()
+{
+    WakeConditionVariable(static_cast<CONDITION_VARIABLE*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+void Condition::notifyAll()
+{
+    WakeAllConditionVariable(static_cast<CONDITION_VARIABLE*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Thread::Thread(Function function, void* userData) :
+    d_impl(0),
+    d_function(function),
+    d_userData(userData),
+    d_joined(false)
+{
+    d_impl = reinterpret_cast<void*>(
+        _beginthreadex(0, 0, &Thread::threadEntry, this, 0, 0));
+
+    if (!d_impl)
+        CEGUI_THROW(GenericException("Failed to create a thread."));
+}
+
+//----------------------------------------------------------------------------//
+Thread::~Thread()
+{
+    join();
+}
+
+//----------------------------------------------------------------------------//
+void Thread::join()
+{
+    if (d_joined)
+        return;
+
+    WaitForSingleObject(static_cast<HANDLE>(d_impl), INFINITE);
+    CloseHandle(static_cast<HANDLE>(d_impl));
+    d_joined = true;
+}
+
+//----------------------------------------------------------------------------//
+unsigned __stdcall Thread::threadEntry(void* thread)
+{
+    Thread* const t = static_cast<Thread*>(thread);
+    t->d_function(t->d_userData);
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+uint Thread::getHardwareConcurrency()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors > 0 ?
+        static_cast<uint>(info.dwNumberOfProcessors) : 1;
+}
+
+#else
+//----------------------------------------------------------------------------//
+Mutex::Mutex() :
+    d_impl(new pthread_mutex_t)
+{
+    pthread_mutex_init(static_cast<pthread_mutex_t*>(d_impl), 0);
+}
+
+//----------------------------------------------------------------------------//
+Mutex::~Mutex()
+{
+    pthread_mutex_destroy(static_cast<pthread_mutex_t*>(d_impl));
+    delete static_cast<pthread_mutex_t*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::lock()
+{
+    pthread_mutex_lock(static_cast<pthread_mutex_t*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::unlock()
+{
+    pthread_mutex_unlock(static_cast<pthread_mutex_t*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Condition::Condition() :
+    d_impl(new pthread_cond_t)
+{
+    pthread_cond_init(static_cast<pthread_cond_t*>(d_impl), 0);
+}
+
+//----------------------------------------------------------------------------//
+Condition::~Condition()
+{
+    pthread_cond_destroy(static_cast<pthread_cond_t*>(d_impl));
+    delete static_cast<pthread_cond_t*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Condition::wait(Mutex& mutex)
+{
+    pthread_cond_wait(static_cast<pthread_cond_t*>(d_impl),
+                      static_cast<pthread_mutex_t*>(mutex.d_impl));
+}
+
+//----------------------------------------------------------------------------//
+void Condition::notifyOne()
+{
+    pthread_cond_signal(static_cast<pthread_cond_t*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+void Condition::notifyAll()
+{
+    pthread_cond_broadcast(static_cast<pthread_cond_t*>(d_impl));
+}
+
+//----------------------------------------------------------------------------//
+Thread::Thread(Function function, void* userData) :
+    d_impl(new pthread_t),
+    d_function(function),
+    d_userData(userData),
+    d_joined(false)
+{
+    if (pthread_create(static_cast<pthread_t*>(d_impl), 0,
+                       &Thread::threadEntry, this) != 0)
+    {
+        delete static_cast<pthread_t*>(d_impl);
+        CEGUI_THROW(GenericException("Failed to create a thread."));
+    }
+}
+
+//----------------------------------------------------------------------------//
+Thread::~Thread()
+{
+    join();
+    delete static_cast<pthread_t*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Thread::join()
+{
+    if (d_joined)
+        return;
+
+    pthread_join(*static_cast<pthread_t*>(d_impl), 0);
+    d_joined = true;
+}
+
+//----------------------------------------------------------------------------//
+void* Thread::threadEntry(void* thread)
+{
+    Thread* const t = static_cast<Thread*>(thread);
+    t->d_function(t->d_userData);
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+uint Thread::getHardwareConcurrency()
+{
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<uint>(count) : 1;
+}
+
+#endif
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
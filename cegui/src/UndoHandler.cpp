@@ -180,5 +180,17 @@ UndoHandler::UndoAction UndoHandler::getLastAction()
     return lastAction;
 }
 
+//----------------------------------------------------------------------------//
+UndoHandler::UndoAction UndoHandler::getUndoAction()
+{
+    return d_undoList[d_undoPosition];
+}
+
+//----------------------------------------------------------------------------//
+UndoHandler::UndoAction UndoHandler::getRedoAction()
+{
+    return d_undoList[d_undoPosition + 1];
+}
+
 } // End of  CEGUI namespace section
 
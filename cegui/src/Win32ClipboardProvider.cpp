@@ -67,7 +67,7 @@ void Win32ClipboardProvider::sendToClipboard(const String& mime_type, void* buff
       if(OpenClipboard(0))
       {
          // Transcode buffer to UTF-16
-#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UNICODE
+#if CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_STD
          String str(static_cast<const utf8*>(buffer), size);
 #else
          String str(static_cast<const char*>(buffer), size);
@@ -180,6 +180,7 @@ Window::Window(const String& type, const String& name):
     // basic state
     d_initialising(false),
     d_destructionStarted(false),
+    d_registryIndex(static_cast<size_t>(-1)),
     d_enabled(true),
     d_visible(true),
     d_active(false),
@@ -257,11 +258,16 @@ Window::Window(const String& type, const String& name):
     d_outerRectClipper(0, 0, 0, 0),
     d_innerRectClipper(0, 0, 0, 0),
     d_hitTestRect(0, 0, 0, 0),
+    d_hitTestBounds(0, 0, 0, 0),
 
     // cached pixel rect validity flags
     d_outerRectClipperValid(false),
     d_innerRectClipperValid(false),
     d_hitTestRectValid(false),
+    d_hitTestBoundsValid(false),
+    d_hitTestBoundsUnbounded(false),
+    d_hitTestGridArea(0, 0, 0, 0),
+    d_hitTestGridSize(0),
 
     // Initial update mode
     d_updateMode(WUM_VISIBLE),
@@ -581,6 +587,33 @@ bool Window::isHit(const glm::vec2& position, const bool allow_disabled) const
     return test_area.isPointInRect(position);
 }
 
+//----------------------------------------------------------------------------//
+// windows with fewer visible children than this are scanned linearly.
+static const size_t HitTestGridMinChildren = 32;
+// upper limit for the number of columns and rows of a hit test grid.
+static const size_t HitTestGridMaxSize = 64;
+
+//----------------------------------------------------------------------------//
+static void extendRect(Rectf& rect, const Rectf& other)
+{
+    rect.left(ceguimin(rect.left(), other.left()));
+    rect.top(ceguimin(rect.top(), other.top()));
+    rect.right(ceguimax(rect.right(), other.right()));
+    rect.bottom(ceguimax(rect.bottom(), other.bottom()));
+}
+
+//----------------------------------------------------------------------------//
+static size_t getHitTestGridCell(float position, float start, float extent,
+                                 size_t cells)
+{
+    const float cell = (position - start) * cells / extent;
+
+    if (cell <= 0.0f)
+        return 0;
+
+    return ceguimin(static_cast<size_t>(cell), cells - 1);
+}
+
 //----------------------------------------------------------------------------//
 Window* Window::getChildAtPosition(const glm::vec2& position) const
 {
@@ -599,12 +632,36 @@ Window* Window::getChildAtPosition(const glm::vec2& position,
     else
         p = position;
 
-    const ChildDrawList::const_reverse_iterator end = d_drawList.rend();
+    if (!d_hitTestBoundsValid)
+        updateHitTestBounds();
+
+    // windows with many children only test those in the grid cell holding
+    // the position, which lists them in draw order as well.
+    const ChildDrawList* candidates = &d_drawList;
+
+    if (!d_hitTestGrid.empty())
+    {
+        if (!d_hitTestGridArea.isPointInRect(p))
+            return 0;
+
+        const size_t column = getHitTestGridCell(p.x,
+            d_hitTestGridArea.left(), d_hitTestGridArea.getWidth(),
+            d_hitTestGridSize);
+        const size_t row = getHitTestGridCell(p.y,
+            d_hitTestGridArea.top(), d_hitTestGridArea.getHeight(),
+            d_hitTestGridSize);
+
+        candidates = &d_hitTestGrid[row * d_hitTestGridSize + column];
+    }
+
+    const ChildDrawList::const_reverse_iterator end = candidates->rend();
     ChildDrawList::const_reverse_iterator child;
 
-    for (child = d_drawList.rbegin(); child != end; ++child)
+    // Test the bounds first; they are cached, whereas isEffectiveVisible
+    // walks up to the root.
+    for (child = candidates->rbegin(); child != end; ++child)
     {
-        if ((*child)->isEffectiveVisible())
+        if ((*child)->isHitTestBoundsHit(p) && (*child)->isEffectiveVisible())
         {
             // recursively scan for hit on children of this child window...
             if (Window* const wnd = (*child)->getChildAtPosition(p, hittestfunc, allow_disabled))
@@ -619,6 +676,144 @@ Window* Window::getChildAtPosition(const glm::vec2& position,
     return 0;
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isHitTestBoundsHit(const glm::vec2& position) const
+{
+    if (!d_hitTestBoundsValid)
+        updateHitTestBounds();
+
+    return d_hitTestBoundsUnbounded || d_hitTestBounds.isPointInRect(position);
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateHitTestBounds() const
+{
+    // children of a window with RenderingWindow backing are tested with
+    // unprojected positions, so we can't reject anything for this subtree.
+    d_hitTestBoundsUnbounded = d_surface && d_surface->isRenderingWindow();
+    d_hitTestBounds = getHitTestRect();
+
+    const ChildDrawList::const_iterator end = d_drawList.end();
+    for (ChildDrawList::const_iterator child = d_drawList.begin();
+         child != end; ++child)
+    {
+        // hidden windows and their descendants can't be hit
+        if (!(*child)->isVisible())
+            continue;
+
+        if (!(*child)->d_hitTestBoundsValid)
+            (*child)->updateHitTestBounds();
+
+        if ((*child)->d_hitTestBoundsUnbounded)
+            d_hitTestBoundsUnbounded = true;
+
+        const Rectf& child_bounds = (*child)->d_hitTestBounds;
+
+        if ((child_bounds.getWidth() <= 0.0f) ||
+            (child_bounds.getHeight() <= 0.0f))
+            continue;
+
+        if ((d_hitTestBounds.getWidth() <= 0.0f) ||
+            (d_hitTestBounds.getHeight() <= 0.0f))
+            d_hitTestBounds = child_bounds;
+        else
+            extendRect(d_hitTestBounds, child_bounds);
+    }
+
+    updateHitTestGrid();
+    d_hitTestBoundsValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateHitTestGrid() const
+{
+    size_t count = 0;
+
+    const ChildDrawList::const_iterator end = d_drawList.end();
+    for (ChildDrawList::const_iterator child = d_drawList.begin();
+         child != end; ++child)
+    {
+        if (!(*child)->isVisible())
+            continue;
+
+        // such a child has to be tested for every position.
+        if ((*child)->d_hitTestBoundsUnbounded)
+        {
+            count = 0;
+            break;
+        }
+
+        const Rectf& child_bounds = (*child)->d_hitTestBounds;
+
+        if ((child_bounds.getWidth() <= 0.0f) ||
+            (child_bounds.getHeight() <= 0.0f))
+            continue;
+
+        if (count++ == 0)
+            d_hitTestGridArea = child_bounds;
+        else
+            extendRect(d_hitTestGridArea, child_bounds);
+    }
+
+    // a linear scan is cheaper for a handful of children.
+    if (count < HitTestGridMinChildren)
+    {
+        d_hitTestGrid.clear();
+        return;
+    }
+
+    // aim for about one child per cell; the cells are reused when possible.
+    d_hitTestGridSize = ceguimin(HitTestGridMaxSize,
+        static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(count)))));
+    d_hitTestGrid.resize(d_hitTestGridSize * d_hitTestGridSize);
+
+    for (size_t i = 0; i < d_hitTestGrid.size(); ++i)
+        d_hitTestGrid[i].clear();
+
+    const float width = d_hitTestGridArea.getWidth();
+    const float height = d_hitTestGridArea.getHeight();
+
+    for (ChildDrawList::const_iterator child = d_drawList.begin();
+         child != end; ++child)
+    {
+        if (!(*child)->isVisible())
+            continue;
+
+        const Rectf& child_bounds = (*child)->d_hitTestBounds;
+
+        if ((child_bounds.getWidth() <= 0.0f) ||
+            (child_bounds.getHeight() <= 0.0f))
+            continue;
+
+        const size_t first_column = getHitTestGridCell(child_bounds.left(),
+            d_hitTestGridArea.left(), width, d_hitTestGridSize);
+        const size_t last_column = getHitTestGridCell(child_bounds.right(),
+            d_hitTestGridArea.left(), width, d_hitTestGridSize);
+        const size_t first_row = getHitTestGridCell(child_bounds.top(),
+            d_hitTestGridArea.top(), height, d_hitTestGridSize);
+        const size_t last_row = getHitTestGridCell(child_bounds.bottom(),
+            d_hitTestGridArea.top(), height, d_hitTestGridSize);
+
+        for (size_t row = first_row; row <= last_row; ++row)
+            for (size_t column = first_column; column <= last_column; ++column)
+                d_hitTestGrid[row * d_hitTestGridSize + column].push_back(*child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateHitTestBounds()
+{
+    d_hitTestBoundsValid = false;
+
+    // ancestors that are already invalid will update us when they update
+    // themselves, so we can stop at the first one.
+    for (Window* wnd = getParent(); wnd && wnd->d_hitTestBoundsValid;
+         wnd = wnd->getParent())
+    {
+        wnd->d_hitTestBoundsValid = false;
+    }
+}
+
 //----------------------------------------------------------------------------//
 Window* Window::getTargetChildAtPosition(const glm::vec2& position,
                                          const bool allow_disabled) const
@@ -698,6 +893,7 @@ void Window::setVisible(bool setting)
         return;
 
     d_visible = setting;
+    invalidateHitTestBounds();
     WindowEventArgs args(this);
     d_visible ? onShown(args) : onHidden(args);
 
@@ -1153,9 +1349,11 @@ void Window::syncTargetSurface()
 //----------------------------------------------------------------------------//
 void Window::cleanupChildren(void)
 {
+    // children are taken from the back, so that removing each one is cheap
+    // no matter how many children there are.
     while(getChildCount() != 0)
     {
-        Window* wnd = static_cast<Window*>(d_children[0]);
+        Window* wnd = static_cast<Window*>(d_children.back());
 
         // always remove child
         removeChild(wnd);
@@ -1202,19 +1400,15 @@ void Window::removeChild_impl(Element* element)
     // remove from draw list
     removeWindowFromDrawList(*wnd);
 
-    Element::removeChild_impl(wnd);
-
-    // find this window in the child list
-    const ChildList::iterator position =
-        std::find(d_children.begin(), d_children.end(), wnd);
-
-    // if the window was found in the child list
-    if (position != d_children.end())
+    // if the window is one of our children
+    if (wnd->getParentElement() == this)
     {
         // unban properties window could write as a root window
         wnd->unbanPropertyFromXML("RestoreOldCapture");
     }
 
+    Element::removeChild_impl(wnd);
+
     wnd->onZChange_impl();
 }
 
@@ -1845,6 +2039,7 @@ void Window::markCachedWindowRectsInvalid()
     d_outerRectClipperValid = false;
     d_innerRectClipperValid = false;
     d_hitTestRectValid = false;
+    invalidateHitTestBounds();
 }
 
 //----------------------------------------------------------------------------//
@@ -1873,7 +2068,7 @@ void Window::setLookNFeel(const String& look)
     }
 
     d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
+    CEGUI_LOG("Assigning LookNFeel '" + look +
         "' to window '" + d_name + "'.", Informative);
 
     // Work to initialise the look and feel...
@@ -2125,6 +2320,9 @@ void Window::addWindowToDrawList(Window& wnd, bool at_back)
         // add window to draw list
         d_drawList.insert(position.base(), &wnd);
     }
+
+    // the hit test grid lists the children in draw order.
+    invalidateHitTestBounds();
 }
 
 //----------------------------------------------------------------------------//
@@ -2133,14 +2331,17 @@ void Window::removeWindowFromDrawList(const Window& wnd)
     // if draw list is not empty
     if (!d_drawList.empty())
     {
-        // attempt to find the window in the draw list
-        const ChildDrawList::iterator position =
-            std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+        // attempt to find the window in the draw list, searching from the
+        // back where windows are most often removed from.
+        const ChildDrawList::reverse_iterator position =
+            std::find(d_drawList.rbegin(), d_drawList.rend(), &wnd);
 
         // remove the window if it was found in the draw list
-        if (position != d_drawList.end())
-            d_drawList.erase(position);
+        if (position != d_drawList.rend())
+            d_drawList.erase(position.base() - 1);
     }
+
+    invalidateHitTestBounds();
 }
 
 //----------------------------------------------------------------------------//
@@ -2237,22 +2438,7 @@ void Window::onFontChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onAlphaChanged(WindowEventArgs& e)
 {
-    // scan child list and call this method for all children that inherit alpha
-    const size_t child_count = getChildCount();
-
-    for (size_t i = 0; i < child_count; ++i)
-    {
-        if (getChildAtIdx(i)->inheritsAlpha())
-        {
-            WindowEventArgs args(getChildAtIdx(i));
-            getChildAtIdx(i)->onAlphaChanged(args);
-        }
-
-    }
-
-    updateGeometryBuffersAlpha();
-    invalidateRenderingSurface();
-    getGUIContext().markAsDirty();
+    updateEffectiveAlpha();
 
     fireEvent(EventAlphaChanged, e, EventNamespace);
 }
@@ -2322,8 +2508,12 @@ void Window::onDisabled(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onClippingChanged(WindowEventArgs& e)
 {
-    invalidate();
-    notifyClippingChanged();
+    // only the clip regions of this window and its children change, the
+    // cached geometry itself remains valid.
+    notifyScreenAreaChanged();
+    invalidateRenderingSurface();
+    getGUIContext().markAsDirty();
+
     fireEvent(EventClippedByParentChanged, e, EventNamespace);
 }
 
@@ -2336,7 +2526,8 @@ void Window::onParentDestroyChanged(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onInheritsAlphaChanged(WindowEventArgs& e)
 {
-    invalidate();
+    updateEffectiveAlpha();
+
     fireEvent(EventInheritsAlphaChanged, e, EventNamespace);
 }
 
@@ -2699,7 +2890,7 @@ void Window::setWindowRenderer(const String& name)
 
     if (!name.empty())
     {
-        Logger::getSingleton().logEvent("Assigning the window renderer '" +
+        CEGUI_LOG("Assigning the window renderer '" +
             name + "' to the window '" + d_name + "'", Informative);
         d_windowRenderer = wrm.createWindowRenderer(name);
         WindowEventArgs e(this);
@@ -3447,6 +3638,7 @@ void Window::moveInFront(const Window* const window)
 
     // reinsert ourselves at the right location
     getParent()->d_drawList.insert(++i, this);
+    getParent()->invalidateHitTestBounds();
 
     // handle event notifications for affected windows.
     onZChange_impl();
@@ -3479,6 +3671,7 @@ void Window::moveBehind(const Window* const window)
 
     // reinsert ourselves at the right location
     getParent()->d_drawList.insert(i, this);
+    getParent()->invalidateHitTestBounds();
 
     // handle event notifications for affected windows.
     onZChange_impl();
@@ -3810,6 +4003,26 @@ void Window::updateGeometryBuffersAlpha()
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::updateEffectiveAlpha()
+{
+    // scan child list and notify all children that inherit alpha
+    const size_t child_count = getChildCount();
+
+    for (size_t i = 0; i < child_count; ++i)
+    {
+        if (getChildAtIdx(i)->inheritsAlpha())
+        {
+            WindowEventArgs args(getChildAtIdx(i));
+            getChildAtIdx(i)->onAlphaChanged(args);
+        }
+    }
+
+    updateGeometryBuffersAlpha();
+    invalidateRenderingSurface();
+    getGUIContext().markAsDirty();
+}
+
 //----------------------------------------------------------------------------//
 
 #if defined(_MSC_VER)
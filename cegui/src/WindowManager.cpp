@@ -107,10 +107,14 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     Window* newWindow = factory->createWindow(finalName);
 
-    char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addr_buff, Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingLevelKept(Informative))
+    {
+        char addr_buff[32];
+        sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
+        logger.logEvent("Window '" + finalName +"' of type '" +
+            type + "' has been created. " + addr_buff, Informative);
+    }
 
     // see if we need to assign a look to this window
     if (wfMgr.isFalagardMappedType(type))
@@ -125,6 +129,7 @@ Window* WindowManager::createWindow(const String& type, const String& name)
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
 
+    newWindow->d_registryIndex = d_windowRegistry.size();
 	d_windowRegistry.push_back(newWindow);
 
     // fire event to notify interested parites about the new window.
@@ -188,16 +193,11 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
     char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
 
-	if (iter == d_windowRegistry.end())
+	if (!isAlive(window))
     {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + String(addr_buff) +
             ". WARNING: This could indicate a double-deletion issue!!",
@@ -205,10 +205,21 @@ void WindowManager::destroyWindow(Window* window)
         return;
     }
 
-    d_windowRegistry.erase(iter);
+    // move the last registered window into the slot being vacated, so that
+    // removal takes constant time.
+    Window* const last = d_windowRegistry.back();
+    d_windowRegistry[window->d_registryIndex] = last;
+    last->d_registryIndex = window->d_registryIndex;
+    d_windowRegistry.pop_back();
+    window->d_registryIndex = static_cast<size_t>(-1);
 
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addr_buff, Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isLoggingLevelKept(Informative))
+    {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
+        logger.logEvent("Window at '" + window->getNamePath() +
+            "' will be added to dead pool. " + addr_buff, Informative);
+    }
 
     // do 'safe' part of cleanup
     window->destroy();
@@ -229,18 +240,16 @@ void WindowManager::destroyWindow(Window* window)
 void WindowManager::destroyAllWindows(void)
 {
 	while (!d_windowRegistry.empty())
-		destroyWindow(*d_windowRegistry.begin());
+		destroyWindow(d_windowRegistry.back());
 }
 
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
-	return iter != d_windowRegistry.end();
+    // a window is alive if the registry slot it records holds the window
+    return window &&
+        window->d_registryIndex < d_windowRegistry.size() &&
+        d_windowRegistry[window->d_registryIndex] == window;
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
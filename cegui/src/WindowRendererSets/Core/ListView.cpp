@@ -72,7 +72,14 @@ void FalagardListView::render(ListView* list_view)
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(list_view, items_area));
 
-    for (size_t i = 0; i < list_view->getItems().size(); ++i)
+    size_t first, end;
+    list_view->getVisibleItemRange(first, end);
+    if (first == end)
+        return;
+
+    item_pos.y += list_view->getRenderedItemOffset(first);
+
+    for (size_t i = first; i < end; ++i)
     {
         ListViewItemRenderingState* item = list_view->getItems().at(i);
         RenderedString& rendered_string = item->d_string;
@@ -97,20 +97,26 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
+        // only rows intersecting the list area are drawn, so skip straight
+        // to the first row visible at the current scroll position.
+        const float scrollPos = vertScrollbar->getScrollPosition();
+        const uint firstRow = w->getRowAtOffset(scrollPos);
+
         // set up initial positional details for items
-        itemPos.y = itemsArea.top() - vertScrollbar->getScrollPosition();
+        itemPos.y = itemsArea.top() - scrollPos + w->getRowOffset(firstRow);
         itemPos.z = 0.0f;
 
         const float alpha = w->getEffectiveAlpha();
 
-        // loop through the items
-        for (uint i = 0; i < w->getRowCount(); ++i)
+        // loop through the visible items
+        for (uint i = firstRow;
+             i < w->getRowCount() && itemPos.y < itemsArea.bottom(); ++i)
         {
             // set initial x position for this row.
             itemPos.x = itemsArea.left() - horzScrollbar->getScrollPosition();
 
             // calculate height for this row.
-            itemSize.d_height = w->getHighestRowItemHeight(i);
+            itemSize.d_height = w->getRowOffset(i + 1) - w->getRowOffset(i);
 
             // loop through the columns in this row
             for (uint j = 0; j < w->getColumnCount(); ++j)
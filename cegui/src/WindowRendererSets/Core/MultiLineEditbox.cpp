@@ -145,7 +145,7 @@ void FalagardMultiLineEditbox::cacheCaretImagery(const Rectf& textArea)
             // calculate pixel offsets to where caret should be drawn
             size_t caretLineIdx = w->getCaretIndex() - d_lines[caretLine].d_startIdx;
             float ypos = caretLine * fnt->getLineSpacing();
-            float xpos = fnt->getTextAdvance(w->getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+            float xpos = fnt->getTextAdvance(w->getText(), d_lines[caretLine].d_startIdx, caretLineIdx);
 
 //             // get base offset to target layer for cursor.
 //             Renderer* renderer = System::getSingleton().getRenderer();
@@ -62,82 +62,77 @@ void FalagardTreeView::render()
     imagery->render(*tree_view);
 
     Rectf items_area(getViewRenderArea());
-    glm::vec2 item_pos(getItemRenderStartPosition(tree_view, items_area));
-    renderTreeItem(tree_view, items_area, item_pos, &tree_view->getRootItemState(), 0);
+    glm::vec2 start_pos(getItemRenderStartPosition(tree_view, items_area));
+
+    size_t first, end;
+    tree_view->getVisibleItemRange(first, end);
+
+    const std::vector<TreeViewItemRenderingState*>& items =
+        tree_view->getRenderedItems();
+    for (size_t i = first; i < end; ++i)
+    {
+        TreeViewItemRenderingState* item = items.at(i);
+        glm::vec2 item_pos(
+            start_pos.x + getSubtreeExpanderXIndent(item->d_nestedLevel),
+            start_pos.y + tree_view->getRenderedItemOffset(i));
+
+        renderTreeItem(tree_view, items_area, item_pos, item);
+    }
 }
 
 //----------------------------------------------------------------------------//
 void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_area,
-    glm::vec2& item_pos, const TreeViewItemRenderingState* item_to_render,
-    size_t depth)
+    const glm::vec2& item_pos, TreeViewItemRenderingState* item)
 {
     float expander_margin = tree_view->getSubtreeExpanderMargin();
-    for (size_t i = 0; i < item_to_render->d_renderedChildren.size(); ++i)
-    {
-        TreeViewItemRenderingState* item = item_to_render->d_renderedChildren.at(i);
-        RenderedString& rendered_string = item->d_string;
-        Sizef size(item->d_size);
-
-        // center the expander compared to the item's height
-        float half_diff = (size.d_height - d_subtreeExpanderImagerySize.d_height) / 2.0f;
-
-        size.d_width = ceguimax(items_area.getWidth(), size.d_width);
-        float indent = d_subtreeExpanderImagerySize.d_width + expander_margin * 2;
-        if (item->d_totalChildCount > 0)
-        {
-            const ImagerySection* section = item->d_subtreeIsExpanded
-                ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
+    RenderedString& rendered_string = item->d_string;
+    Sizef size(item->d_size);
 
-            Rectf button_rect;
-            button_rect.left(item_pos.x + expander_margin);
-            button_rect.top(item_pos.y +
-                (half_diff > 0 ? half_diff : 0));
-            button_rect.setSize(d_subtreeExpanderImagerySize);
+    // center the expander compared to the item's height
+    float half_diff = (size.d_height - d_subtreeExpanderImagerySize.d_height) / 2.0f;
 
-            Rectf button_clipper(button_rect.getIntersection(items_area));
-            section->render(*tree_view, button_rect, 0, &button_clipper);
-
-            indent = button_rect.getWidth() + expander_margin * 2;
-        }
-
-        Rectf item_rect;
-        item_rect.left(item_pos.x + indent);
-        item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
-        item_rect.setSize(size);
-
-        if (!item->d_icon.empty())
-        {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
-
-            Rectf icon_rect(item_rect);
-            icon_rect.setWidth(size.d_height);
-            icon_rect.setHeight(size.d_height);
+    size.d_width = ceguimax(items_area.getWidth(), size.d_width);
+    float indent = d_subtreeExpanderImagerySize.d_width + expander_margin * 2;
+    if (item->d_totalChildCount > 0)
+    {
+        const ImagerySection* section = item->d_subtreeIsExpanded
+            ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
 
-            Rectf icon_clipper(icon_rect.getIntersection(items_area));
-            img.render(tree_view->getGeometryBuffers(), icon_rect, &icon_clipper,
-                true, ICON_COLOUR_RECT, 1.0f);
+        Rectf button_rect;
+        button_rect.left(item_pos.x + expander_margin);
+        button_rect.top(item_pos.y +
+            (half_diff > 0 ? half_diff : 0));
+        button_rect.setSize(d_subtreeExpanderImagerySize);
 
-            item_rect.left(item_rect.left() + icon_rect.getWidth());
-        }
+        Rectf button_clipper(button_rect.getIntersection(items_area));
+        section->render(*tree_view, button_rect, 0, &button_clipper);
 
-        Rectf item_clipper(item_rect.getIntersection(items_area));
-        renderString(tree_view, rendered_string, item_rect,
-            tree_view->getFont(), &item_clipper, item->d_isSelected);
+        indent = button_rect.getWidth() + expander_margin * 2;
+    }
 
-        item_pos.y += ceguimax(size.d_height, d_subtreeExpanderImagerySize.d_height);
+    Rectf item_rect;
+    item_rect.left(item_pos.x + indent);
+    item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
+    item_rect.setSize(size);
 
-        if (item->d_renderedChildren.empty())
-            continue;
+    if (!item->d_icon.empty())
+    {
+        Image& img = ImageManager::getSingleton().get(item->d_icon);
 
-        item_pos.x += indent;
+        Rectf icon_rect(item_rect);
+        icon_rect.setWidth(size.d_height);
+        icon_rect.setHeight(size.d_height);
 
-        if (item->d_subtreeIsExpanded)
-        {
-            renderTreeItem(tree_view, items_area, item_pos, item, depth + 1);
-        }
+        Rectf icon_clipper(icon_rect.getIntersection(items_area));
+        img.render(tree_view->getGeometryBuffers(), icon_rect, &icon_clipper,
+            true, ICON_COLOUR_RECT, 1.0f);
 
-        item_pos.x -= indent;
+        item_rect.left(item_rect.left() + icon_rect.getWidth());
     }
+
+    Rectf item_clipper(item_rect.getIntersection(items_area));
+    renderString(tree_view, rendered_string, item_rect,
+        tree_view->getFont(), &item_clipper, item->d_isSelected);
 }
 
 static Sizef getImagerySize(const ImagerySection& section)
@@ -0,0 +1,450 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLCompiler.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Compiled data layout (all integers are little endian uint32):
+//
+//   signature "CGXB", format version, string count
+//   string table: for each string, its UTF-8 byte length then the bytes
+//   attribute set count
+//   attribute set table: for each distinct attribute list, its attribute
+//   count then name / value per attribute
+//   records until the end of the data, each starting with a RecordType byte:
+//     ElementStart: name, index into the attribute set table
+//     ElementEnd:   name
+//     Text:         text
+//   where every name, value and text is an index into the string table.
+//----------------------------------------------------------------------------//
+static const uint8 CompiledSignature[] = { 'C', 'G', 'X', 'B' };
+
+enum RecordType
+{
+    RT_ElementStart = 1,
+    RT_ElementEnd,
+    RT_Text
+};
+
+const uint32 XMLCompiler::FormatVersion = 2;
+
+//----------------------------------------------------------------------------//
+static void appendUint32(std::vector<uint8>& out, uint32 value)
+{
+    out.push_back(static_cast<uint8>(value));
+    out.push_back(static_cast<uint8>(value >> 8));
+    out.push_back(static_cast<uint8>(value >> 16));
+    out.push_back(static_cast<uint8>(value >> 24));
+}
+
+//----------------------------------------------------------------------------//
+/*!
+    XMLHandler that records every notification it receives in compiled form,
+    interning the strings and attribute lists as it goes.
+*/
+class CompilingXMLHandler : public XMLHandler
+{
+public:
+    const String& getDefaultResourceGroup() const
+    {
+        static const String group;
+        return group;
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes)
+    {
+        flushText();
+        d_records.push_back(RT_ElementStart);
+        appendUint32(d_records, getStringIndex(element));
+
+        AttributeSet set;
+        set.reserve(attributes.getCount() * 2);
+
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+        {
+            set.push_back(getStringIndex(attributes.getName(i)));
+            set.push_back(getStringIndex(attributes.getValue(i)));
+        }
+
+        appendUint32(d_records, getAttributeSetIndex(set));
+    }
+
+    void elementEnd(const String& element)
+    {
+        flushText();
+        d_records.push_back(RT_ElementEnd);
+        appendUint32(d_records, getStringIndex(element));
+    }
+
+    void text(const String& text)
+    {
+        // parsers may deliver a text node in several pieces; store it whole.
+        d_text += text;
+    }
+
+    void write(OutStream& out)
+    {
+        std::vector<uint8> data;
+        encode(data);
+
+        out.write(reinterpret_cast<const char*>(&data[0]), data.size());
+
+        if (!out)
+            CEGUI_THROW(FileIOException(
+                "failed to write the compiled XML data to the output stream."));
+    }
+
+    void write(RawDataContainer& output)
+    {
+        std::vector<uint8> data;
+        encode(data);
+
+        uint8* const buffer = new uint8[data.size()];
+        std::memcpy(buffer, &data[0], data.size());
+
+        output.setData(buffer);
+        output.setSize(data.size());
+    }
+
+private:
+    typedef std::map<String, uint32> StringIndexMap;
+    //! name / value string index pairs of one attribute list.
+    typedef std::vector<uint32> AttributeSet;
+    typedef std::map<AttributeSet, uint32> AttributeSetIndexMap;
+
+    void encode(std::vector<uint8>& data)
+    {
+        flushText();
+
+        data.assign(CompiledSignature,
+                    CompiledSignature + sizeof(CompiledSignature));
+        appendUint32(data, XMLCompiler::FormatVersion);
+        appendUint32(data, static_cast<uint32>(d_strings.size()));
+
+        for (size_t i = 0; i < d_strings.size(); ++i)
+        {
+            const char* const str =
+                reinterpret_cast<const char*>(d_strings[i]->c_str());
+            const size_t len = std::strlen(str);
+
+            appendUint32(data, static_cast<uint32>(len));
+            data.insert(data.end(), str, str + len);
+        }
+
+        appendUint32(data, static_cast<uint32>(d_attributeSets.size()));
+
+        for (size_t i = 0; i < d_attributeSets.size(); ++i)
+        {
+            const AttributeSet& set = *d_attributeSets[i];
+
+            appendUint32(data, static_cast<uint32>(set.size() / 2));
+            for (size_t j = 0; j < set.size(); ++j)
+                appendUint32(data, set[j]);
+        }
+
+        data.insert(data.end(), d_records.begin(), d_records.end());
+    }
+
+    uint32 getStringIndex(const String& str)
+    {
+        std::pair<StringIndexMap::iterator, bool> result = d_stringIndices.insert(
+            std::make_pair(str, static_cast<uint32>(d_strings.size())));
+
+        if (result.second)
+            d_strings.push_back(&result.first->first);
+
+        return result.first->second;
+    }
+
+    uint32 getAttributeSetIndex(const AttributeSet& set)
+    {
+        std::pair<AttributeSetIndexMap::iterator, bool> result =
+            d_attributeSetIndices.insert(std::make_pair(
+                set, static_cast<uint32>(d_attributeSets.size())));
+
+        if (result.second)
+            d_attributeSets.push_back(&result.first->first);
+
+        return result.first->second;
+    }
+
+    void flushText()
+    {
+        if (d_text.empty())
+            return;
+
+        d_records.push_back(RT_Text);
+        appendUint32(d_records, getStringIndex(d_text));
+        d_text.clear();
+    }
+
+    //! Interned strings, mapped to their index in the string table.
+    StringIndexMap d_stringIndices;
+    //! String table in index order; points at the keys of d_stringIndices.
+    std::vector<const String*> d_strings;
+    //! Interned attribute lists, mapped to their index in the set table.
+    AttributeSetIndexMap d_attributeSetIndices;
+    //! Attribute set table in index order; points at the keys above.
+    std::vector<const AttributeSet*> d_attributeSets;
+    //! Encoded record stream.
+    std::vector<uint8> d_records;
+    //! Text received since the last element notification.
+    String d_text;
+};
+
+//----------------------------------------------------------------------------//
+/*!
+    Bounds checked sequential reader over compiled data.
+*/
+class CompiledXMLReader
+{
+public:
+    CompiledXMLReader(const uint8* data, size_t size) :
+        d_pos(data),
+        d_end(data + size)
+    {}
+
+    bool atEnd() const
+    {
+        return d_pos == d_end;
+    }
+
+    size_t remaining() const
+    {
+        return static_cast<size_t>(d_end - d_pos);
+    }
+
+    uint8 readByte()
+    {
+        return *read(1);
+    }
+
+    uint32 readUint32()
+    {
+        const uint8* const p = read(4);
+
+        return static_cast<uint32>(p[0]) |
+               (static_cast<uint32>(p[1]) << 8) |
+               (static_cast<uint32>(p[2]) << 16) |
+               (static_cast<uint32>(p[3]) << 24);
+    }
+
+    const uint8* read(size_t count)
+    {
+        if (count > remaining())
+            CEGUI_THROW(GenericException("compiled XML data is truncated."));
+
+        const uint8* const p = d_pos;
+        d_pos += count;
+        return p;
+    }
+
+private:
+    const uint8* d_pos;
+    const uint8* const d_end;
+};
+
+//----------------------------------------------------------------------------//
+static const String& readStringRef(CompiledXMLReader& reader,
+                                   const std::vector<String>& strings)
+{
+    const uint32 index = reader.readUint32();
+
+    if (index >= strings.size())
+        CEGUI_THROW(GenericException(
+            "compiled XML data refers to string " +
+            PropertyHelper<uint>::toString(index) + " but only " +
+            PropertyHelper<uint>::toString(static_cast<uint>(strings.size())) +
+            " strings are defined."));
+
+    return strings[index];
+}
+
+//----------------------------------------------------------------------------//
+static const XMLAttributes& readAttributeSetRef(
+    CompiledXMLReader& reader, const std::vector<XMLAttributes>& sets)
+{
+    const uint32 index = reader.readUint32();
+
+    if (index >= sets.size())
+        CEGUI_THROW(GenericException(
+            "compiled XML data refers to attribute set " +
+            PropertyHelper<uint>::toString(index) + " but only " +
+            PropertyHelper<uint>::toString(static_cast<uint>(sets.size())) +
+            " attribute sets are defined."));
+
+    return sets[index];
+}
+
+//----------------------------------------------------------------------------//
+void XMLCompiler::compileFile(const String& filename,
+                              const String& resourceGroup,
+                              OutStream& out)
+{
+    CompilingXMLHandler handler;
+
+    // validation is pointless here; the compiled data carries no schema.
+    System::getSingleton().getXMLParser()->parseXMLFile(
+        handler, filename, "", resourceGroup, false);
+
+    handler.write(out);
+}
+
+//----------------------------------------------------------------------------//
+void XMLCompiler::compileString(const String& source, OutStream& out)
+{
+    CompilingXMLHandler handler;
+
+    System::getSingleton().getXMLParser()->parseXMLString(
+        handler, source, "", false);
+
+    handler.write(out);
+}
+
+//----------------------------------------------------------------------------//
+void XMLCompiler::compile(const RawDataContainer& source,
+                          RawDataContainer& output)
+{
+    CompilingXMLHandler handler;
+
+    if (isCompiled(source))
+        parseCompiled(handler, source);
+    else
+        System::getSingleton().getXMLParser()->parseXML(
+            handler, source, "", false);
+
+    handler.write(output);
+}
+
+//----------------------------------------------------------------------------//
+bool XMLCompiler::isCompiled(const RawDataContainer& data)
+{
+    return data.getSize() >= sizeof(CompiledSignature) &&
+           std::memcmp(data.getDataPtr(), CompiledSignature,
+                       sizeof(CompiledSignature)) == 0;
+}
+
+//----------------------------------------------------------------------------//
+void XMLCompiler::parseCompiled(XMLHandler& handler, const RawDataContainer& data)
+{
+    if (!isCompiled(data))
+        CEGUI_THROW(GenericException(
+            "the data does not hold compiled XML."));
+
+    CompiledXMLReader reader(data.getDataPtr(), data.getSize());
+    reader.read(sizeof(CompiledSignature));
+
+    const uint32 version = reader.readUint32();
+    if (version != FormatVersion)
+        CEGUI_THROW(GenericException(
+            "compiled XML data has format version " +
+            PropertyHelper<uint>::toString(version) + " but version " +
+            PropertyHelper<uint>::toString(FormatVersion) +
+            " is required; the data must be compiled again."));
+
+    // every string takes at least its length field, which bounds the count
+    // before anything is allocated for it.
+    const uint32 string_count = reader.readUint32();
+    if (string_count > reader.remaining() / 4)
+        CEGUI_THROW(GenericException("compiled XML data is truncated."));
+
+    std::vector<String> strings;
+    strings.reserve(string_count);
+
+    for (uint32 i = 0; i < string_count; ++i)
+    {
+        const uint32 len = reader.readUint32();
+        const uint8* const str = reader.read(len);
+
+        strings.push_back(String(reinterpret_cast<const encoded_char*>(str),
+                                 static_cast<String::size_type>(len)));
+    }
+
+    // build each distinct attribute list once, so element records replay
+    // without touching XMLAttributes at all.
+    const uint32 set_count = reader.readUint32();
+    if (set_count > reader.remaining() / 4)
+        CEGUI_THROW(GenericException("compiled XML data is truncated."));
+
+    std::vector<XMLAttributes> attribute_sets(set_count);
+
+    for (uint32 i = 0; i < set_count; ++i)
+    {
+        const uint32 count = reader.readUint32();
+        if (count > reader.remaining() / 8)
+            CEGUI_THROW(GenericException("compiled XML data is truncated."));
+
+        for (uint32 j = 0; j < count; ++j)
+        {
+            const String& name = readStringRef(reader, strings);
+            attribute_sets[i].add(name, readStringRef(reader, strings));
+        }
+    }
+
+    while (!reader.atEnd())
+    {
+        switch (reader.readByte())
+        {
+        case RT_ElementStart:
+        {
+            const String& element = readStringRef(reader, strings);
+            handler.elementStart(element,
+                                 readAttributeSetRef(reader, attribute_sets));
+            break;
+        }
+
+        case RT_ElementEnd:
+            handler.elementEnd(readStringRef(reader, strings));
+            break;
+
+        case RT_Text:
+            handler.text(readStringRef(reader, strings));
+            break;
+
+        default:
+            CEGUI_THROW(GenericException(
+                "compiled XML data contains an unknown record type."));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
@@ -27,6 +27,7 @@
 #include "CEGUI/XMLHandler.h"
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLCompiler.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -49,8 +50,11 @@ namespace CEGUI
 
     void XMLHandler::handleContainer(const RawDataContainer& source)
     {
-        System::getSingleton().getXMLParser()->parseXML(
-                    *this, source, getSchemaName());
+        if (XMLCompiler::isCompiled(source))
+            XMLCompiler::parseCompiled(*this, source);
+        else
+            System::getSingleton().getXMLParser()->parseXML(
+                        *this, source, getSchemaName());
     }
 
     void XMLHandler::handleFile(const String& fileName, const String& resourceGroup)
@@ -25,6 +25,8 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLCompiler.h"
+#include "CEGUI/AsyncSchemeLoader.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
@@ -55,14 +57,41 @@ namespace CEGUI
 
     void XMLParser::parseXMLFile(XMLHandler& handler, const String& filename, const String& schemaName, const String& resourceGroup, bool allowXmlValidation)
     {
+        // Use the compiled data prepared by an AsyncSchemeLoader if there is any
+        AsyncSchemeLoader* const loader = AsyncSchemeLoader::getSingletonPtr();
+        RawDataContainer preparedData;
+
+        if (loader && loader->takePreloadedXML(filename, resourceGroup, preparedData))
+        {
+            try
+            {
+                XMLCompiler::parseCompiled(handler, preparedData);
+            }
+            catch (const Exception&)
+            {
+                Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
+                                                filename + "' from resource group '" + resourceGroup + "'.", Errors);
+
+                preparedData.release();
+                CEGUI_RETHROW;
+            }
+
+            preparedData.release();
+            return;
+        }
+
         // Acquire resource using CEGUI ResourceProvider
         RawDataContainer rawXMLData;
         System::getSingleton().getResourceProvider()->loadRawDataContainer(filename, rawXMLData, resourceGroup);
 
         try
         {
-            // The actual parsing action (this is overridden and depends on the specific parser)
-            parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
+            // Compiled files are replayed directly, anything else is XML
+            if (XMLCompiler::isCompiled(rawXMLData))
+                XMLCompiler::parseCompiled(handler, rawXMLData);
+            else
+                // The actual parsing action (this is overridden and depends on the specific parser)
+                parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
         }
         catch (const Exception&)
         {
@@ -396,7 +396,7 @@ namespace CEGUI
         d_widgetlook = new WidgetLookFeel(attributes.getValueAsString(NameAttribute),
                                           attributes.getValueAsString(InheritsAttribute));
 
-        Logger::getSingleton().logEvent("---> Start of definition for widget look '" + d_widgetlook->getName() + "'.", Informative);
+        CEGUI_LOG("---> Start of definition for widget look '" + d_widgetlook->getName() + "'.", Informative);
     }
 
     /*************************************************************************
@@ -1267,7 +1267,7 @@ namespace CEGUI
     {
         if (d_widgetlook)
         {
-            Logger::getSingleton().logEvent("---< End of definition for widget look '" + d_widgetlook->getName() + "'.", Informative);
+            CEGUI_LOG("---< End of definition for widget look '" + d_widgetlook->getName() + "'.", Informative);
             d_manager->addWidgetLook(*d_widgetlook);
             delete d_widgetlook;
             d_widgetlook = 0;
@@ -95,7 +95,8 @@ const String SVGLineAttributeY2( "y2" );
 
 //----------------------------------------------------------------------------//
 SVGData::SVGData(const String& name) :
-    d_name(name)
+    d_name(name),
+    d_tesselationCacheSize(8)
 {
 }
 
@@ -103,7 +104,8 @@ SVGData::SVGData(const String& name) :
 SVGData::SVGData(const String& name,
                  const String& filename,
                  const String& resourceGroup) :
-    d_name(name)
+    d_name(name),
+    d_tesselationCacheSize(8)
 {
     loadFromFile(filename, resourceGroup);
 }
@@ -133,6 +135,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    clearTesselationCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -143,6 +146,67 @@ void SVGData::destroyShapes()
         delete d_svgBasicShapes[i];
 
     d_svgBasicShapes.clear();
+    clearTesselationCache();
+}
+
+//----------------------------------------------------------------------------//
+const SVGData::TesselatedGeometryList* SVGData::getCachedTesselation(
+    const glm::vec2& scale_factor,
+    bool anti_aliasing)
+{
+    TesselationCache::iterator iter = d_tesselationCache.begin();
+    for (; iter != d_tesselationCache.end(); ++iter)
+    {
+        if (iter->d_scaleFactor == scale_factor &&
+            iter->d_antiAliasing == anti_aliasing)
+        {
+            // move the entry to the front, so it is evicted last
+            d_tesselationCache.splice(d_tesselationCache.begin(),
+                                      d_tesselationCache, iter);
+            return &d_tesselationCache.front().d_geometry;
+        }
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::addCachedTesselation(const glm::vec2& scale_factor,
+                                   bool anti_aliasing,
+                                   TesselatedGeometryList& geometry)
+{
+    if (d_tesselationCacheSize == 0)
+        return;
+
+    while (d_tesselationCache.size() >= d_tesselationCacheSize)
+        d_tesselationCache.pop_back();
+
+    d_tesselationCache.push_front(TesselationCacheEntry());
+    TesselationCacheEntry& entry = d_tesselationCache.front();
+    entry.d_scaleFactor = scale_factor;
+    entry.d_antiAliasing = anti_aliasing;
+    entry.d_geometry.swap(geometry);
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::clearTesselationCache()
+{
+    d_tesselationCache.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::setTesselationCacheSize(size_t size)
+{
+    d_tesselationCacheSize = size;
+
+    while (d_tesselationCache.size() > d_tesselationCacheSize)
+        d_tesselationCache.pop_back();
+}
+
+//----------------------------------------------------------------------------//
+size_t SVGData::getTesselationCacheSize() const
+{
+    return d_tesselationCacheSize;
 }
 
 //----------------------------------------------------------------------------//
@@ -32,6 +32,8 @@
 #include "CEGUI/svg/SVGBasicShape.h"
 #include "CEGUI/svg/SVGDataManager.h"
 #include "CEGUI/XMLAttributes.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
 
 
 
@@ -132,10 +134,71 @@ void SVGImage::render(std::vector<GeometryBuffer*>& image_geometry_buffers,
                                                scale_factor,
                                                d_useGeometryAntialiasing);
 
+    // the tesselation only depends on the scale and anti-aliasing, so reuse
+    // the geometry of a previous render with the same settings if possible
+    const SVGData::TesselatedGeometryList* cached_geometry =
+        d_svgData->getCachedTesselation(scale_factor, d_useGeometryAntialiasing);
+
+    if (cached_geometry)
+    {
+        createCachedGeometryBuffers(image_geometry_buffers, *cached_geometry,
+                                    svg_render_settings);
+        return;
+    }
+
+    const size_t first_buffer = image_geometry_buffers.size();
+
     const std::vector<SVGBasicShape*>& shapes = d_svgData->getShapes();
     const unsigned int shape_count = shapes.size();
     for (unsigned int i = 0; i < shape_count; ++i)
         shapes[i]->render(image_geometry_buffers, svg_render_settings);
+
+    // store the created geometry for subsequent renders
+    SVGData::TesselatedGeometryList geometry;
+    for (size_t i = first_buffer; i < image_geometry_buffers.size(); ++i)
+    {
+        const GeometryBuffer& buffer = *image_geometry_buffers[i];
+
+        if (buffer.getVertexCount() == 0)
+            continue;
+
+        geometry.push_back(SVGData::TesselatedGeometry());
+        SVGData::TesselatedGeometry& buffer_geometry = geometry.back();
+        buffer_geometry.d_vertexData = buffer.getVertexData();
+        buffer_geometry.d_customTransform = buffer.getCustomTransform();
+        buffer_geometry.d_fillRule = buffer.getStencilRenderingFillRule();
+        buffer_geometry.d_postStencilVertexCount =
+            buffer.getStencilPostRenderingVertexCount();
+    }
+
+    d_svgData->addCachedTesselation(scale_factor, d_useGeometryAntialiasing,
+                                    geometry);
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::createCachedGeometryBuffers(
+    std::vector<GeometryBuffer*>& image_geometry_buffers,
+    const SVGData::TesselatedGeometryList& geometry,
+    const SVGImageRenderSettings& render_settings) const
+{
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    const size_t buffer_count = geometry.size();
+    for (size_t i = 0; i < buffer_count; ++i)
+    {
+        const SVGData::TesselatedGeometry& buffer_geometry = geometry[i];
+
+        GeometryBuffer& buffer = renderer.createGeometryBufferColoured();
+        SVGTesselator::setupGeometryBufferSettings(
+            &buffer, render_settings, buffer_geometry.d_customTransform);
+        buffer.setStencilRenderingActive(buffer_geometry.d_fillRule);
+        buffer.setStencilPostRenderingVertexCount(
+            buffer_geometry.d_postStencilVertexCount);
+        buffer.appendGeometry(&buffer_geometry.d_vertexData[0],
+                              buffer_geometry.d_vertexData.size());
+
+        image_geometry_buffers.push_back(&buffer);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -111,4 +111,10 @@ bool ItemModel::areIndicesEqual(const ModelIndex& index1, const ModelIndex& inde
 {
     return compareIndices(index1, index2) == 0;
 }
+
+//----------------------------------------------------------------------------//
+size_t ItemModel::getIndexHash(const ModelIndex& model_index) const
+{
+    return 0;
+}
 }
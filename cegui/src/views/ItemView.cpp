@@ -26,9 +26,11 @@
  *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
  *   OTHER DEALINGS IN THE SOFTWARE.
 ***************************************************************************/
+#include "CEGUI/Font.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/views/ItemView.h"
 #include "CEGUI/widgets/Tooltip.h"
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -111,6 +113,7 @@ PropertyHelper<ViewSortMode>::toString(pass_type val)
 //----------------------------------------------------------------------------//
 const Colour ItemView::DefaultTextColour = 0xFFFFFFFF;
 const Colour ItemView::DefaultSelectionColour = Colour(0xFF4444AA);
+const size_t ItemView::VirtualisationOverscan = 4;
 const String ItemView::HorzScrollbarName("__auto_hscrollbar__");
 const String ItemView::VertScrollbarName("__auto_vscrollbar__");
 const String ItemView::EventVertScrollbarDisplayModeChanged("VertScrollbarDisplayModeChanged");
@@ -128,6 +131,9 @@ ItemView::ItemView(const String& type, const String& name) :
     d_selectionColourRect(ColourRect(DefaultSelectionColour)),
     d_isDirty(true),
     d_needsFullRender(true),
+    d_needsItemsUpdate(true),
+    d_needsSelectionUpdate(true),
+    d_selectedIndexCount(0),
     d_lastSelectedIndex(0),
     d_selectionBrush(0),
     d_vertScrollbarDisplayMode(SDM_WhenNeeded),
@@ -137,6 +143,7 @@ ItemView::ItemView(const String& type, const String& name) :
     d_sortMode(VSM_None),
     d_isAutoResizeHeightEnabled(false),
     d_isAutoResizeWidthEnabled(false),
+    d_isVirtualisedRenderingEnabled(false),
     d_renderedMaxWidth(0),
     d_renderedTotalHeight(0),
     d_eventChildrenAddedConnection(0),
@@ -216,6 +223,15 @@ void ItemView::addItemViewProperties()
         &ItemView::setAutoResizeWidthEnabled,
         &ItemView::isAutoResizeWidthEnabled, false
         )
+
+    CEGUI_DEFINE_PROPERTY(ItemView, bool,
+        "VirtualisedRendering",
+        "Property to get/set whether the item view only measures and renders "
+        "the items that intersect its visible area. Value is either \"true\" "
+        "or \"false\".",
+        &ItemView::setVirtualisedRenderingEnabled,
+        &ItemView::isVirtualisedRenderingEnabled, false
+        )
 }
 
 //----------------------------------------------------------------------------//
@@ -245,6 +261,7 @@ void ItemView::setModel(ItemModel* item_model)
 
     connectToModelEvents(d_itemModel);
     d_indexSelectionStates.clear();
+    clearSelectedIndexLookup();
     d_needsFullRender = true;
 
     ItemViewEventArgs args(this);
@@ -288,25 +305,31 @@ bool ItemView::onChildrenWillBeAdded(const EventArgs& args)
 //----------------------------------------------------------------------------//
 bool ItemView::onChildrenAdded(const EventArgs& args)
 {
-    const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
+    updateSelectionForAddedChildren(static_cast<const ModelEventArgs&>(args));
+
+    invalidateView(false);
+    WindowEventArgs evt_args(this);
+    onViewContentsChanged(evt_args);
+    return true;
+}
 
+//----------------------------------------------------------------------------//
+void ItemView::updateSelectionForAddedChildren(const ModelEventArgs& args)
+{
     for (SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
         itor != d_indexSelectionStates.end(); ++itor)
     {
         ModelIndexSelectionState& state = *itor;
 
-        if (state.d_childId >= model_args.d_startId &&
-            d_itemModel->areIndicesEqual(state.d_parentIndex, model_args.d_parentIndex))
+        if (state.d_childId >= args.d_startId &&
+            d_itemModel->areIndicesEqual(state.d_parentIndex, args.d_parentIndex))
         {
-            state.d_childId += model_args.d_count;
+            state.d_childId += args.d_count;
             state.d_selectedIndex = d_itemModel->makeIndex(state.d_childId, state.d_parentIndex);
         }
     }
 
-    invalidateView(false);
-    WindowEventArgs evt_args(this);
-    onViewContentsChanged(evt_args);
-    return true;
+    rebuildSelectedIndexLookup();
 }
 
 //----------------------------------------------------------------------------//
@@ -317,8 +340,11 @@ bool ItemView::onChildrenWillBeRemoved(const EventArgs& args)
 
     const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
 
-    SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
-    while (itor != d_indexSelectionStates.end())
+    // compact the kept states in place, so that removing many selected
+    // indices stays linear.
+    SelectionStatesVector::iterator kept_end = d_indexSelectionStates.begin();
+    for (SelectionStatesVector::iterator itor = d_indexSelectionStates.begin();
+        itor != d_indexSelectionStates.end(); ++itor)
     {
         ModelIndexSelectionState& state = *itor;
 
@@ -327,15 +353,15 @@ bool ItemView::onChildrenWillBeRemoved(const EventArgs& args)
         {
             if (d_itemModel->areIndicesEqual(d_lastSelectedIndex, state.d_selectedIndex))
                 d_lastSelectedIndex = ModelIndex(0);
-
-            itor = d_indexSelectionStates.erase(itor);
         }
         else
         {
-            ++itor;
+            *kept_end++ = state;
         }
     }
 
+    d_indexSelectionStates.erase(kept_end, d_indexSelectionStates.end());
+    rebuildSelectedIndexLookup();
     return true;
 }
 
@@ -360,6 +386,8 @@ bool ItemView::onChildrenDataWillChange(const EventArgs& args)
 //----------------------------------------------------------------------------//
 bool ItemView::onChildrenDataChanged(const EventArgs& args)
 {
+    // the model may hash the changed items differently now.
+    rebuildSelectedIndexLookup();
     invalidateView(false);
     return true;
 }
@@ -367,14 +395,20 @@ bool ItemView::onChildrenDataChanged(const EventArgs& args)
 //----------------------------------------------------------------------------//
 void ItemView::onSelectionChanged(ItemViewEventArgs& args)
 {
-    invalidateView(false);
+    // the items themselves are unchanged, only their selection state differs.
+    d_isDirty = true;
+    d_needsSelectionUpdate = true;
+    invalidate(false);
     fireEvent(EventSelectionChanged, args);
 }
 
 //----------------------------------------------------------------------------//
 bool ItemView::onScrollPositionChanged(const EventArgs& args)
 {
-    invalidateView(false);
+    // nothing to refresh from the model, but virtualised views have to
+    // measure the items that were scrolled into view.
+    d_isDirty = true;
+    invalidate(false);
     return true;
 }
 
@@ -420,13 +454,34 @@ void ItemView::disconnectModelEvents()
 //----------------------------------------------------------------------------//
 void ItemView::invalidateView(bool recursive)
 {
-    //TODO: allow invalidation only of certain parts (e.g.: items/indices)
     updateScrollbars();
     resizeToContent();
     setIsDirty(true);
     invalidate(recursive);
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::invalidateRenderedItems(size_t first_position)
+{
+    d_isDirty = true;
+
+    const Rectf old_render_area(getViewRenderer()->getViewRenderArea());
+    updateScrollbars();
+    resizeToContent();
+    const Rectf render_area(getViewRenderer()->getViewRenderArea());
+
+    // the offsets of the items before first_position are unaffected by the
+    // patch, so this is where the changes start both before and after it.
+    const float changes_top = d_renderedItemOffsets.empty() ? 0.0f :
+        d_renderedItemOffsets.at(
+            ceguimin(first_position, d_renderedItemOffsets.size() - 1));
+    const float visible_bottom =
+        getVertScrollbar()->getScrollPosition() + render_area.getHeight();
+
+    if (changes_top < visible_bottom || render_area != old_render_area)
+        invalidate(false);
+}
+
 //----------------------------------------------------------------------------//
 ItemModel* ItemView::getModel() const
 {
@@ -485,13 +540,15 @@ bool ItemView::isDirty() const
 void ItemView::setIsDirty(bool value)
 {
     d_isDirty = value;
+    d_needsItemsUpdate = value;
+    d_needsSelectionUpdate = value;
 }
 
 //----------------------------------------------------------------------------//
 int ItemView::getSelectedIndexPosition(const ModelIndex& index) const
 {
-    if (d_itemModel == 0)
-        return false;
+    if (d_itemModel == 0 || !isInSelectedIndexLookup(index))
+        return -1;
 
     for (size_t i = 0; i < d_indexSelectionStates.size(); ++i)
     {
@@ -505,7 +562,117 @@ int ItemView::getSelectedIndexPosition(const ModelIndex& index) const
 //----------------------------------------------------------------------------//
 bool ItemView::isIndexSelected(const ModelIndex& index) const
 {
-    return getSelectedIndexPosition(index) != -1;
+    return d_itemModel != 0 && isInSelectedIndexLookup(index);
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemView::getSelectedIndexBucket(size_t hash) const
+{
+    // hashes of pointers have their low bits clear, so mix the high bits in.
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bU;
+    hash ^= hash >> 16;
+
+    return hash & (d_selectedIndexBuckets.size() - 1);
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::isInSelectedIndexLookup(const ModelIndex& index) const
+{
+    if (d_selectedIndexCount == 0)
+        return false;
+
+    const size_t hash = d_itemModel->getIndexHash(index);
+    const std::vector<HashedIndex>& bucket =
+        d_selectedIndexBuckets[getSelectedIndexBucket(hash)];
+
+    for (std::vector<HashedIndex>::const_iterator itor = bucket.begin();
+        itor != bucket.end(); ++itor)
+    {
+        if (itor->first == hash && d_itemModel->areIndicesEqual(index, itor->second))
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::addToSelectedIndexLookup(const ModelIndex& index)
+{
+    // keep at most one index per bucket on average.
+    if (d_selectedIndexCount >= d_selectedIndexBuckets.size())
+    {
+        SelectedIndexBuckets old_buckets(
+            std::max<size_t>(16, d_selectedIndexBuckets.size() * 2));
+        old_buckets.swap(d_selectedIndexBuckets);
+
+        for (SelectedIndexBuckets::const_iterator bucket = old_buckets.begin();
+            bucket != old_buckets.end(); ++bucket)
+        {
+            for (std::vector<HashedIndex>::const_iterator itor = bucket->begin();
+                itor != bucket->end(); ++itor)
+            {
+                d_selectedIndexBuckets[getSelectedIndexBucket(itor->first)]
+                    .push_back(*itor);
+            }
+        }
+    }
+
+    const size_t hash = d_itemModel->getIndexHash(index);
+    d_selectedIndexBuckets[getSelectedIndexBucket(hash)].push_back(
+        HashedIndex(hash, index));
+    ++d_selectedIndexCount;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::removeFromSelectedIndexLookup(const ModelIndex& index)
+{
+    if (d_selectedIndexCount == 0)
+        return;
+
+    const size_t hash = d_itemModel->getIndexHash(index);
+    std::vector<HashedIndex>& bucket =
+        d_selectedIndexBuckets[getSelectedIndexBucket(hash)];
+
+    for (std::vector<HashedIndex>::iterator itor = bucket.begin();
+        itor != bucket.end(); ++itor)
+    {
+        if (itor->first == hash && d_itemModel->areIndicesEqual(index, itor->second))
+        {
+            *itor = bucket.back();
+            bucket.pop_back();
+            --d_selectedIndexCount;
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::clearSelectedIndexLookup()
+{
+    // the buckets are kept for reuse.
+    for (SelectedIndexBuckets::iterator bucket = d_selectedIndexBuckets.begin();
+        bucket != d_selectedIndexBuckets.end(); ++bucket)
+    {
+        bucket->clear();
+    }
+
+    d_selectedIndexCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::rebuildSelectedIndexLookup()
+{
+    clearSelectedIndexLookup();
+
+    if (d_itemModel == 0)
+        return;
+
+    for (SelectionStatesVector::const_iterator itor = d_indexSelectionStates.begin();
+        itor != d_indexSelectionStates.end(); ++itor)
+    {
+        addToSelectedIndexLookup(itor->d_selectedIndex);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -743,6 +910,10 @@ void ItemView::onSemanticInputEvent(SemanticEventArgs& e)
         handleSelection(getGUIContext().getCursor().getPosition(),
             true, d_isMultiSelectEnabled, e.d_semanticValue == SV_SelectRange);
     }
+    else if (e.d_semanticValue == SV_SelectAll)
+    {
+        selectAll();
+    }
 
     handleSelectionNavigation(e);
 
@@ -779,6 +950,7 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
         if (!should_select)
         {
             d_indexSelectionStates.erase(d_indexSelectionStates.begin() + index_position);
+            removeFromSelectedIndexLookup(index);
 
             ItemViewEventArgs args(this, index);
             onSelectionChanged(args);
@@ -792,7 +964,7 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
     }
 
     if (!is_cumulative)
-        d_indexSelectionStates.clear();
+        clearSelections();
 
     ModelIndex parent_index = d_itemModel->getParentIndex(index);
     size_t end_child_id = d_itemModel->getChildId(index);
@@ -802,26 +974,55 @@ bool ItemView::handleSelection(const ModelIndex& index, bool should_select,
         start_child_id = d_itemModel->getChildId(d_lastSelectedIndex);
     }
 
+    selectRange(parent_index, start_child_id, end_child_id);
+
+    d_lastSelectedIndex = index;
+
+    ItemViewEventArgs args(this, index);
+    onSelectionChanged(args);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::selectRange(const ModelIndex& parent_index, size_t start_child_id,
+    size_t end_child_id)
+{
     for (size_t id = start_child_id; id <= end_child_id; ++id)
     {
         ModelIndexSelectionState selection_state;
         selection_state.d_selectedIndex = d_itemModel->makeIndex(id, parent_index);
 
         // ignore already selected indices
-        if (getSelectedIndexPosition(selection_state.d_selectedIndex) != -1)
+        if (isIndexSelected(selection_state.d_selectedIndex))
             continue;
 
         selection_state.d_childId = id;
         selection_state.d_parentIndex = parent_index;
 
         d_indexSelectionStates.push_back(selection_state);
+        addToSelectedIndexLookup(selection_state.d_selectedIndex);
     }
+}
 
-    d_lastSelectedIndex = index;
+//----------------------------------------------------------------------------//
+void ItemView::selectAll()
+{
+    if (d_itemModel == 0 || !d_isMultiSelectEnabled)
+        return;
 
-    ItemViewEventArgs args(this, index);
+    ModelIndex root_index = d_itemModel->getRootIndex();
+    size_t child_count = d_itemModel->getChildCount(root_index);
+    if (child_count == 0)
+        return;
+
+    clearSelections();
+    d_indexSelectionStates.reserve(child_count);
+    selectRange(root_index, 0, child_count - 1);
+
+    d_lastSelectedIndex = d_itemModel->makeIndex(child_count - 1, root_index);
+
+    ItemViewEventArgs args(this, d_lastSelectedIndex);
     onSelectionChanged(args);
-    return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -862,6 +1063,7 @@ void ItemView::onViewContentsChanged(WindowEventArgs& args)
 void ItemView::clearSelections()
 {
     d_indexSelectionStates.clear();
+    clearSelectedIndexLookup();
 }
 
 //----------------------------------------------------------------------------//
@@ -1008,6 +1210,69 @@ void ItemView::resizeToContent()
         d_isAutoResizeWidthEnabled, d_isAutoResizeHeightEnabled);
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::setVirtualisedRenderingEnabled(bool enabled)
+{
+    if (d_isVirtualisedRenderingEnabled == enabled)
+        return;
+
+    d_isVirtualisedRenderingEnabled = enabled;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::isVirtualisedRenderingEnabled() const
+{
+    return d_isVirtualisedRenderingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::getVisibleItemRange(size_t& first, size_t& end, size_t overscan)
+{
+    first = end = 0;
+    if (d_renderedItemOffsets.size() < 2)
+        return;
+
+    const size_t item_count = d_renderedItemOffsets.size() - 1;
+    const float top = getVertScrollbar()->getScrollPosition();
+    const float bottom = top + getViewRenderer()->getViewRenderArea().getHeight();
+
+    // first item whose bottom edge is below the top of the visible area
+    first = std::upper_bound(d_renderedItemOffsets.begin() + 1,
+        d_renderedItemOffsets.end(), top) - (d_renderedItemOffsets.begin() + 1);
+    // first item whose top edge is at or below the bottom of the visible area
+    end = std::lower_bound(d_renderedItemOffsets.begin(),
+        d_renderedItemOffsets.end() - 1, bottom) - d_renderedItemOffsets.begin();
+
+    first = first > overscan ? first - overscan : 0;
+    end = ceguimax(first, ceguimin(item_count, end + overscan));
+}
+
+//----------------------------------------------------------------------------//
+float ItemView::getRenderedItemOffset(size_t position) const
+{
+    return d_renderedItemOffsets.at(position);
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemView::getRenderedItemPositionAt(float offset) const
+{
+    if (d_renderedItemOffsets.size() < 2 || offset < 0)
+        return d_renderedItemOffsets.empty() ? 0 : d_renderedItemOffsets.size() - 1;
+
+    // first item whose bottom edge is at or below the offset
+    return std::lower_bound(d_renderedItemOffsets.begin() + 1,
+        d_renderedItemOffsets.end(), offset) - (d_renderedItemOffsets.begin() + 1);
+}
+
+//----------------------------------------------------------------------------//
+float ItemView::getEstimatedItemHeight() const
+{
+    const Font* font = getFont();
+    return font ? font->getLineSpacing() : 0.0f;
+}
+
 //----------------------------------------------------------------------------//
 ItemViewEventArgs::ItemViewEventArgs(ItemView* wnd, ModelIndex index) :
 WindowEventArgs(wnd),
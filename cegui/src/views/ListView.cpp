@@ -57,7 +57,8 @@ const String ListView::WidgetTypeName("CEGUI/ListView");
 //----------------------------------------------------------------------------//
 ListViewItemRenderingState::ListViewItemRenderingState(ListView* list_view) :
     d_isSelected(false),
-    d_attachedListView(list_view)
+    d_attachedListView(list_view),
+    d_needsUpdate(false)
 {
 }
 
@@ -90,6 +91,25 @@ void ListView::prepareForRender()
     if (d_itemModel == 0 || !isDirty())
         return;
 
+    if (d_needsFullRender || d_needsItemsUpdate)
+        updateAllItems();
+    else if (d_needsSelectionUpdate)
+        updateSelectionStates();
+
+    if (d_isVirtualisedRenderingEnabled)
+    {
+        updateScrollbars();
+        updateVisibleItems();
+    }
+
+    updateScrollbars();
+    setIsDirty(false);
+    d_needsFullRender = false;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateAllItems()
+{
     if (d_needsFullRender)
     {
         d_renderedMaxWidth = d_renderedTotalHeight = 0;
@@ -106,9 +126,21 @@ void ListView::prepareForRender()
         if (d_needsFullRender)
         {
             ListViewItemRenderingState state = ListViewItemRenderingState(this);
-            updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
+
+            if (d_isVirtualisedRenderingEnabled)
+                estimateItem(state, index);
+            else
+                updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
+
             d_items.push_back(state);
         }
+        else if (d_isVirtualisedRenderingEnabled)
+        {
+            // keep the cached size; the item is refreshed once it's visible.
+            ListViewItemRenderingState& item = d_items.at(child);
+            item.d_index = index;
+            item.d_needsUpdate = true;
+        }
         else
         {
             ListViewItemRenderingState& item = d_items.at(child);
@@ -118,10 +150,47 @@ void ListView::prepareForRender()
         }
     }
 
-    updateScrollbars();
-    setIsDirty(false);
     resortListView();
-    d_needsFullRender = false;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateSelectionStates()
+{
+    for (ViewItemsVector::iterator itor = d_items.begin();
+        itor != d_items.end(); ++itor)
+    {
+        (*itor).d_isSelected = isIndexSelected((*itor).d_index);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateVisibleItems()
+{
+    // measuring items changes their heights, which moves the visible range,
+    // so keep going until every item in that range is up to date.
+    bool items_updated = true;
+    while (items_updated)
+    {
+        items_updated = false;
+
+        size_t first, end;
+        getVisibleItemRange(first, end, VirtualisationOverscan);
+
+        for (size_t i = first; i < end; ++i)
+        {
+            ListViewItemRenderingState& item = *d_sortedItems.at(i);
+            if (!item.d_needsUpdate)
+                continue;
+
+            // the total height is recomputed from the offsets below.
+            float item_height = 0;
+            updateItem(item, item.d_index, d_renderedMaxWidth, item_height);
+            items_updated = true;
+        }
+
+        if (items_updated)
+            updateItemOffsets();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -139,24 +208,13 @@ ModelIndex ListView::indexAt(const glm::vec2& position)
     if (!render_area.isPointInRect(window_position))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.d_y - getVertScrollbar()->getScrollPosition();
-    //TODO: start only on the visible area
-    for (size_t index = 0; index < d_sortedItems.size(); ++index)
-    {
-        ListViewItemRenderingState* item = d_sortedItems.at(index);
-        Sizef size = item->d_size;
-        float next_height = cur_height + size.d_height;
-
-        if (window_position.y >= cur_height &&
-            window_position.y <= next_height)
-        {
-            return item->d_index;
-        }
+    const size_t item_position = getRenderedItemPositionAt(window_position.y -
+        render_area.d_min.d_y + getVertScrollbar()->getScrollPosition());
 
-        cur_height = next_height;
-    }
+    if (item_position >= d_sortedItems.size())
+        return ModelIndex();
 
-    return ModelIndex();
+    return d_sortedItems.at(item_position)->d_index;
 }
 
 //----------------------------------------------------------------------------//
@@ -176,11 +234,32 @@ void ListView::resortListView()
         d_sortedItems.push_back(&(*itor));
     }
 
-    if (d_sortMode == VSM_None)
-        return;
+    if (d_sortMode != VSM_None)
+    {
+        sort(d_sortedItems.begin(), d_sortedItems.end(),
+            d_sortMode == VSM_Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    }
+
+    d_sortedItemPositions.resize(d_items.size());
+    for (size_t i = 0; i < d_sortedItems.size(); ++i)
+        d_sortedItemPositions[d_sortedItems[i] - &d_items[0]] = i;
 
-    sort(d_sortedItems.begin(), d_sortedItems.end(),
-        d_sortMode == VSM_Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    updateItemOffsets();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateItemOffsets(size_t first_position)
+{
+    d_renderedItemOffsets.resize(d_sortedItems.size() + 1);
+    d_renderedItemOffsets[0] = 0;
+
+    for (size_t i = first_position; i < d_sortedItems.size(); ++i)
+    {
+        d_renderedItemOffsets[i + 1] =
+            d_renderedItemOffsets[i] + d_sortedItems[i]->d_size.d_height;
+    }
+
+    d_renderedTotalHeight = d_renderedItemOffsets.back();
 }
 
 //----------------------------------------------------------------------------//
@@ -212,61 +291,186 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index,
     total_height += item.d_size.d_height;
 
     item.d_isSelected = isIndexSelected(index);
+    item.d_needsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::estimateItem(ListViewItemRenderingState& item, ModelIndex index)
+{
+    item.d_index = index;
+    item.d_size = Sizef(0, getEstimatedItemHeight());
+    item.d_needsUpdate = true;
 }
 
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenAdded(const EventArgs& args)
 {
-    ItemView::onChildrenAdded(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
-    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
-        return true;
+    // the items will be created from scratch anyway.
+    if (d_needsFullRender)
+        return ItemView::onChildrenAdded(args);
+
+    updateSelectionForAddedChildren(margs);
+
+    if (d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        addItems(margs.d_startId, margs.d_count);
+
+    WindowEventArgs evt_args(this);
+    onViewContentsChanged(evt_args);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::addItems(size_t start_id, size_t count)
+{
+    ModelIndex root_index = d_itemModel->getRootIndex();
 
     ViewItemsVector items;
-    for (size_t i = 0; i < margs.d_count; ++i)
+    for (size_t i = 0; i < count; ++i)
     {
         ListViewItemRenderingState item(this);
+        ModelIndex index = d_itemModel->makeIndex(start_id + i, root_index);
 
-        updateItem(item,
-            d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
-            d_renderedMaxWidth, d_renderedTotalHeight);
+        if (d_isVirtualisedRenderingEnabled)
+            estimateItem(item, index);
+        else
+            updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
 
         items.push_back(item);
     }
 
-    d_items.insert(d_items.begin() + margs.d_startId, items.begin(), items.end());
+    // inserting before existing items moves them, so the sorted order has
+    // to be rebuilt; appending keeps it, and the new items are placed directly.
+    if (start_id < d_items.size() ||
+        d_renderedItemOffsets.size() != d_items.size() + 1)
+    {
+        d_items.insert(d_items.begin() + start_id, items.begin(), items.end());
+        updateItemIndices();
 
-    //TODO: insert in the right place directly!
-    resortListView();
-    invalidateView(false);
-    return true;
+        resortListView();
+        invalidateRenderedItems(getFirstChangedPosition(start_id));
+        return;
+    }
+
+    const bool items_moved = d_items.size() + count > d_items.capacity();
+    d_items.insert(d_items.end(), items.begin(), items.end());
+    updateItemIndices();
+
+    if (items_moved)
+    {
+        for (size_t i = 0; i < start_id; ++i)
+            d_sortedItems[d_sortedItemPositions[i]] = &d_items[i];
+    }
+
+    size_t first_position = d_sortedItems.size();
+    for (size_t i = start_id; i < d_items.size(); ++i)
+    {
+        ListViewItemRenderingState* item = &d_items[i];
+        std::vector<ListViewItemRenderingState*>::iterator position =
+            d_sortedItems.end();
+
+        if (d_sortMode == VSM_Ascending)
+            position = std::upper_bound(d_sortedItems.begin(),
+                d_sortedItems.end(), item, &listViewItemPointerLess);
+        else if (d_sortMode == VSM_Descending)
+            position = std::upper_bound(d_sortedItems.begin(),
+                d_sortedItems.end(), item, &listViewItemPointerGreater);
+
+        first_position = std::min<size_t>(first_position,
+            position - d_sortedItems.begin());
+        d_sortedItems.insert(position, item);
+    }
+
+    d_sortedItemPositions.resize(d_items.size());
+    for (size_t i = first_position; i < d_sortedItems.size(); ++i)
+        d_sortedItemPositions[d_sortedItems[i] - &d_items[0]] = i;
+
+    updateItemOffsets(first_position);
+    invalidateRenderedItems(first_position);
 }
 
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenRemoved(const EventArgs& args)
 {
-    ItemView::onChildrenRemoved(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
+    if (d_needsFullRender)
+    {
+        invalidateView(false);
+    }
+    else if (d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+    {
+        ViewItemsVector::iterator begin = d_items.begin() + margs.d_startId;
+        d_items.erase(begin, begin + margs.d_count);
+        updateItemIndices();
+
+        resortListView();
+        invalidateRenderedItems(getFirstChangedPosition(margs.d_startId));
+    }
+
+    return ItemView::onChildrenRemoved(args);
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenDataChanged(const EventArgs& args)
+{
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender)
+        return ItemView::onChildrenDataChanged(args);
+
+    rebuildSelectedIndexLookup();
+
     if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
-    ViewItemsVector::iterator begin = d_items.begin() + margs.d_startId;
-    ViewItemsVector::iterator end = begin + margs.d_count;
-
-    for (ViewItemsVector::iterator itor = begin; itor < end; ++itor)
+    for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
     {
-        d_renderedTotalHeight -= (*itor).d_size.d_height;
+        ListViewItemRenderingState& item = d_items.at(id);
+        ModelIndex index = d_itemModel->makeIndex(id, margs.d_parentIndex);
+
+        if (d_isVirtualisedRenderingEnabled)
+        {
+            // keep the cached size; the item is refreshed once it's visible.
+            item.d_index = index;
+            item.d_needsUpdate = true;
+        }
+        else
+        {
+            // the total height is recomputed from the offsets below.
+            float item_height = 0;
+            updateItem(item, index, d_renderedMaxWidth, item_height);
+        }
     }
 
-    d_items.erase(begin, end);
+    // the new data might change the order of the items as well.
+    if (d_sortMode == VSM_None)
+        updateItemOffsets();
+    else
+        resortListView();
 
-    resortListView();
-    invalidateView(false);
+    invalidateRenderedItems(getFirstChangedPosition(margs.d_startId));
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void ListView::updateItemIndices()
+{
+    // models are free to change the indices of the children that follow (or,
+    // e.g.: when stored in a vector, of all the children of) a changed range.
+    ModelIndex root_index = d_itemModel->getRootIndex();
+    for (size_t i = 0; i < d_items.size(); ++i)
+        d_items[i].d_index = d_itemModel->makeIndex(i, root_index);
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getFirstChangedPosition(size_t child_id) const
+{
+    // the changed items can end up anywhere in a sorted view.
+    return d_sortMode == VSM_None ? child_id : 0;
+}
+
 //----------------------------------------------------------------------------//
 Rectf ListView::getIndexRect(const ModelIndex& index)
 {
@@ -276,13 +480,9 @@ Rectf ListView::getIndexRect(const ModelIndex& index)
         return Rectf(0, 0, 0, 0);
     }
 
-    glm::vec2 pos(0, 0);
-
-    for (size_t i = 0; i < static_cast<size_t>(child_id); ++i)
-    {
-        pos.y += d_items.at(i).d_size.d_height;
-    }
+    const size_t item_id = static_cast<size_t>(child_id);
+    glm::vec2 pos(0, getRenderedItemOffset(d_sortedItemPositions.at(item_id)));
 
-    return Rectf(pos, d_items.at(static_cast<size_t>(child_id)).d_size);
+    return Rectf(pos, d_items.at(item_id).d_size);
 }
 }
@@ -29,6 +29,7 @@
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/views/TreeView.h"
+#include <algorithm>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -77,6 +78,7 @@ TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_v
     d_childId(0),
     d_subtreeIsExpanded(false),
     d_nestedLevel(0),
+    d_needsUpdate(false),
     d_attachedTreeView(attached_tree_view)
 {
 }
@@ -128,6 +130,7 @@ bool TreeViewItemRenderingState::operator>(const TreeViewItemRenderingState& oth
 TreeView::TreeView(const String& type, const String& name) :
     ItemView(type, name),
     d_rootItemState(this),
+    d_renderedItemsDirty(true),
     d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin)
 {
     addTreeViewProperties();
@@ -156,6 +159,12 @@ const TreeViewItemRenderingState& TreeView::getRootItemState() const
     return d_rootItemState;
 }
 
+//----------------------------------------------------------------------------//
+const std::vector<TreeViewItemRenderingState*>& TreeView::getRenderedItems() const
+{
+    return d_renderedItems;
+}
+
 //----------------------------------------------------------------------------//
 float TreeView::getSubtreeExpanderMargin() const
 {
@@ -173,11 +182,15 @@ void TreeView::prepareForRender()
 {
     ItemView::prepareForRender();
     //TODO: better way of ignoring the null item model? E.g.: warn? Throw an exception?
-    if (d_itemModel == 0 || !isDirty())
+    if (d_itemModel == 0 || (!isDirty() && !d_renderedItemsDirty))
         return;
 
-    if (d_needsFullRender)
+    // when only the expanded state of some subtrees changed, the items are
+    // still up to date and just have to be flattened again. The same goes
+    // for model changes, which patch the affected items directly.
+    if (isDirty() && d_needsFullRender)
     {
+        d_renderedItemsDirty = true;
         ModelIndex root_index = d_itemModel->getRootIndex();
         d_renderedMaxWidth = 0;
         d_renderedTotalHeight = 0;
@@ -190,17 +203,138 @@ void TreeView::prepareForRender()
         computeRenderedChildrenForItem(d_rootItemState, root_index,
             d_renderedMaxWidth, d_renderedTotalHeight);
     }
-    else
+    else if (isDirty() && d_needsItemsUpdate)
     {
+        d_renderedItemsDirty = true;
         updateRenderingStateForItem(d_rootItemState,
             d_renderedMaxWidth, d_renderedTotalHeight);
     }
 
+    else if (isDirty() && d_needsSelectionUpdate)
+    {
+        updateSelectionStates(d_rootItemState);
+    }
+
+    if (d_renderedItemsDirty)
+        updateRenderedItems();
+
+    if (d_isVirtualisedRenderingEnabled)
+    {
+        updateScrollbars();
+        updateVisibleItems();
+    }
+
     updateScrollbars();
     setIsDirty(false);
     d_needsFullRender = false;
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::updateRenderedItems()
+{
+    d_renderedItems.clear();
+    addRenderedItems(d_rootItemState);
+    updateItemOffsets();
+
+    d_renderedItemsDirty = false;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::addRenderedItems(const TreeViewItemRenderingState& item)
+{
+    for (size_t i = 0; i < item.d_renderedChildren.size(); ++i)
+    {
+        TreeViewItemRenderingState* child = item.d_renderedChildren[i];
+        d_renderedItems.push_back(child);
+
+        if (child->d_subtreeIsExpanded)
+            addRenderedItems(*child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateItemOffsets(size_t first_position)
+{
+    d_renderedItemOffsets.resize(d_renderedItems.size() + 1);
+    d_renderedItemOffsets[0] = 0;
+
+    for (size_t i = first_position; i < d_renderedItems.size(); ++i)
+    {
+        d_renderedItemOffsets[i + 1] =
+            d_renderedItemOffsets[i] + d_renderedItems[i]->d_size.d_height;
+    }
+
+    d_renderedTotalHeight = d_renderedItemOffsets.back();
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateSelectionStates(TreeViewItemRenderingState& item)
+{
+    for (ItemStateVector::iterator itor = item.d_children.begin();
+        itor != item.d_children.end(); ++itor)
+    {
+        TreeViewItemRenderingState& child = *itor;
+        child.d_isSelected = isIndexSelected(
+            d_itemModel->makeIndex(child.d_childId, child.d_parentIndex));
+
+        updateSelectionStates(child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t TreeView::getRenderedItemPosition(const TreeViewItemRenderingState* item) const
+{
+    // the root item isn't rendered, but its children start at the top.
+    if (item == &d_rootItemState)
+        return 0;
+
+    return std::find(d_renderedItems.begin(), d_renderedItems.end(), item) -
+        d_renderedItems.begin();
+}
+
+//----------------------------------------------------------------------------//
+size_t TreeView::getFirstChangedPosition(const TreeViewItemRenderingState& item,
+    size_t child_id) const
+{
+    // the changed children can end up anywhere in a sorted subtree.
+    if (d_sortMode != VSM_None || child_id >= item.d_children.size())
+        return getRenderedItemPosition(&item);
+
+    return getRenderedItemPosition(&item.d_children[child_id]);
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::updateVisibleItems()
+{
+    // measuring items changes their heights, which moves the visible range,
+    // so keep going until every item in that range is up to date.
+    bool items_updated = true;
+    while (items_updated)
+    {
+        items_updated = false;
+
+        size_t first, end;
+        getVisibleItemRange(first, end, VirtualisationOverscan);
+
+        for (size_t i = first; i < end; ++i)
+        {
+            TreeViewItemRenderingState& item = *d_renderedItems.at(i);
+            if (!item.d_needsUpdate)
+                continue;
+
+            // the total height is recomputed from the offsets below.
+            float item_height = 0;
+            fillRenderingState(item,
+                d_itemModel->makeIndex(item.d_childId, item.d_parentIndex),
+                d_renderedMaxWidth, item_height);
+            items_updated = true;
+        }
+
+        if (items_updated)
+            updateItemOffsets();
+    }
+}
+
 //----------------------------------------------------------------------------//
 bool TreeView::handleSelection(const glm::vec2& position, bool should_select,
     bool is_cumulative, bool is_range)
@@ -228,7 +362,10 @@ TreeViewItemRenderingState TreeView::computeRenderingStateForIndex(
     state.d_parentIndex = parent_index;
     state.d_childId = child_id;
 
-    fillRenderingState(state, index, rendered_max_width, rendered_total_height);
+    if (d_isVirtualisedRenderingEnabled)
+        estimateRenderingState(state);
+    else
+        fillRenderingState(state, index, rendered_max_width, rendered_total_height);
 
     computeRenderedChildrenForItem(state, index, rendered_max_width,
         rendered_total_height);
@@ -260,12 +397,20 @@ void TreeView::computeRenderedChildrenForItem(TreeViewItemRenderingState &item,
 void TreeView::updateRenderingStateForItem(TreeViewItemRenderingState& item,
     float& rendered_max_width, float& rendered_total_height)
 {
-    // subtract the previous height
-    rendered_total_height -= item.d_size.d_height;
+    if (d_isVirtualisedRenderingEnabled)
+    {
+        // keep the cached size; the item is refreshed once it's visible.
+        item.d_needsUpdate = true;
+    }
+    else
+    {
+        // subtract the previous height
+        rendered_total_height -= item.d_size.d_height;
 
-    fillRenderingState(item,
-        d_itemModel->makeIndex(item.d_childId, item.d_parentIndex),
-        rendered_max_width, rendered_total_height);
+        fillRenderingState(item,
+            d_itemModel->makeIndex(item.d_childId, item.d_parentIndex),
+            rendered_max_width, rendered_total_height);
+    }
 
     for (ItemStateVector::iterator itor = item.d_children.begin();
         itor != item.d_children.end(); ++itor)
@@ -296,6 +441,14 @@ void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
     rendered_total_height += item.d_size.d_height;
 
     item.d_isSelected = isIndexSelected(index);
+    item.d_needsUpdate = false;
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::estimateRenderingState(TreeViewItemRenderingState& item)
+{
+    item.d_size = Sizef(0, getEstimatedItemHeight());
+    item.d_needsUpdate = true;
 }
 
 //----------------------------------------------------------------------------//
@@ -319,49 +472,26 @@ ModelIndex TreeView::indexAtWithAction(const glm::vec2& position,
     if (!render_area.isPointInRect(window_position))
         return ModelIndex();
 
-    float cur_height = render_area.d_min.d_y - getVertScrollbar()->getScrollPosition();
-    bool handled = false;
-    return indexAtRecursive(d_rootItemState, cur_height, window_position,
-        handled, action);
-}
-
-//----------------------------------------------------------------------------//
-ModelIndex TreeView::indexAtRecursive(TreeViewItemRenderingState& item,
-    float& cur_height, const glm::vec2& window_position, bool& handled,
-    TreeViewItemAction action)
-{
-    float next_height = cur_height + item.d_size.d_height;
-
-    if (window_position.y >= cur_height &&
-        window_position.y <= next_height)
-    {
-        handled = true;
+    const size_t item_position = getRenderedItemPositionAt(window_position.y -
+        render_area.d_min.d_y + getVertScrollbar()->getScrollPosition());
 
-        float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
-        float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel);
-        base_x -= getHorzScrollbar()->getScrollPosition();
-        if (window_position.x >= base_x &&
-            window_position.x <= base_x + expander_width)
-        {
-            (this->*action)(item, true);
-            return ModelIndex();
-        }
-
-        (this->*action)(item, false);
-        return ModelIndex(d_itemModel->makeIndex(item.d_childId, item.d_parentIndex));
-    }
+    if (item_position >= d_renderedItems.size())
+        return ModelIndex();
 
-    cur_height = next_height;
+    TreeViewItemRenderingState& item = *d_renderedItems.at(item_position);
 
-    for (size_t i = 0; i < item.d_renderedChildren.size(); ++i)
+    float expander_width = getViewRenderer()->getSubtreeExpanderSize().d_width;
+    float base_x = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel);
+    base_x -= getHorzScrollbar()->getScrollPosition();
+    if (window_position.x >= base_x &&
+        window_position.x <= base_x + expander_width)
     {
-        ModelIndex index = indexAtRecursive(*item.d_renderedChildren.at(i),
-            cur_height, window_position, handled, action);
-        if (handled)
-            return index;
+        (this->*action)(item, true);
+        return ModelIndex();
     }
 
-    return ModelIndex();
+    (this->*action)(item, false);
+    return ModelIndex(d_itemModel->makeIndex(item.d_childId, item.d_parentIndex));
 }
 
 //----------------------------------------------------------------------------//
@@ -394,6 +524,8 @@ void TreeView::toggleSubtree(TreeViewItemRenderingState& item)
         onSubtreeCollapsed(args);
     }
 
+    d_renderedItemsDirty = true;
+
     updateScrollbars();
     // we need just a simple invalidation. No need to redo the render state
     // as we modified it ourself directly.
@@ -431,75 +563,221 @@ void TreeView::handleSelectionAction(TreeViewItemRenderingState& item, bool togg
 //----------------------------------------------------------------------------//
 bool TreeView::onChildrenRemoved(const EventArgs& args)
 {
-    ItemView::onChildrenRemoved(args);
-
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
-    TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
 
-    if (item == 0)
-        return true;
+    if (d_needsFullRender)
+    {
+        invalidateView(false);
+        return ItemView::onChildrenRemoved(args);
+    }
+
+    TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
+    if (item == 0 || margs.d_count == 0)
+        return ItemView::onChildrenRemoved(args);
 
     item->d_totalChildCount -= margs.d_count;
 
+    // the positions are computed before the removal, since the removed
+    // children have no position afterwards.
+    if (d_renderedItemsDirty)
+        updateRenderedItems();
+
     if (!item->d_subtreeIsExpanded)
-        return true;
+    {
+        // only the expander of the item might have changed.
+        invalidateRenderedItems(getRenderedItemPosition(item));
+        return ItemView::onChildrenRemoved(args);
+    }
+
+    const size_t first_position = getFirstChangedPosition(*item, margs.d_startId);
 
     ViewItemsVector::iterator begin = item->d_children.begin() + margs.d_startId;
     ViewItemsVector::iterator end = begin + margs.d_count;
 
     // update existing child ids
-    for (ItemStateVector::iterator itor = begin; itor != item->d_children.end(); ++itor)
-    {
+    for (ItemStateVector::iterator itor = end; itor != item->d_children.end(); ++itor)
         (*itor).d_childId -= margs.d_count;
 
-        if (itor < end)
-            d_renderedTotalHeight -= (*itor).d_size.d_height;
-    }
-
     item->d_children.erase(begin, end);
 
     item->sortChildren();
-    invalidateView(false);
-    return true;
+    updateRenderedItems();
+    invalidateRenderedItems(first_position);
+    return ItemView::onChildrenRemoved(args);
 }
 
 //----------------------------------------------------------------------------//
 bool TreeView::onChildrenAdded(const EventArgs& args)
 {
-    ItemView::onChildrenAdded(args);
-
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    // the items will be created from scratch anyway.
+    if (d_needsFullRender)
+        return ItemView::onChildrenAdded(args);
+
+    updateSelectionForAddedChildren(margs);
+
     TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
+    if (item != 0)
+        addChildItems(*item, margs.d_parentIndex, margs.d_startId, margs.d_count);
 
-    if (item == 0)
-        return true;
+    WindowEventArgs evt_args(this);
+    onViewContentsChanged(evt_args);
+    return true;
+}
 
-    item->d_totalChildCount += margs.d_count;
+//----------------------------------------------------------------------------//
+void TreeView::addChildItems(TreeViewItemRenderingState& item,
+    const ModelIndex& parent_index, size_t start_id, size_t count)
+{
+    item.d_totalChildCount += count;
 
-    if (!item->d_subtreeIsExpanded)
-        return true;
+    if (!item.d_subtreeIsExpanded)
+    {
+        // only the expander of the item might have changed.
+        if (d_renderedItemsDirty)
+            updateRenderedItems();
+
+        invalidateRenderedItems(getRenderedItemPosition(&item));
+        return;
+    }
 
     ViewItemsVector states;
-    for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
+    for (size_t id = start_id; id < start_id + count; ++id)
     {
-        states.push_back(computeRenderingStateForIndex(margs.d_parentIndex, id,
-            item->d_nestedLevel + 1, d_renderedMaxWidth, d_renderedTotalHeight));
+        states.push_back(computeRenderingStateForIndex(parent_index, id,
+            item.d_nestedLevel + 1, d_renderedMaxWidth, d_renderedTotalHeight));
+    }
+
+    // appending without moving the existing children keeps every pointer to
+    // them (and to their own children) valid, so the new children can be
+    // placed directly instead of resorting and flattening the whole tree.
+    if (start_id == item.d_children.size() &&
+        item.d_children.size() + count <= item.d_children.capacity())
+    {
+        item.d_children.insert(item.d_children.end(), states.begin(), states.end());
+        addRenderedChildren(item, start_id);
+        return;
     }
 
     // update existing child ids
     for (ItemStateVector::iterator
-        itor = item->d_children.begin() + margs.d_startId;
-        itor != item->d_children.end(); ++itor)
+        itor = item.d_children.begin() + start_id;
+        itor != item.d_children.end(); ++itor)
     {
-        (*itor).d_childId += margs.d_count;
+        (*itor).d_childId += count;
     }
 
-    item->d_children.insert(
-        item->d_children.begin() + margs.d_startId,
+    item.d_children.insert(
+        item.d_children.begin() + start_id,
         states.begin(), states.end());
 
-    item->sortChildren();
-    invalidateView(false);
+    item.sortChildren();
+    updateRenderedItems();
+    invalidateRenderedItems(getFirstChangedPosition(item, start_id));
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::addRenderedChildren(TreeViewItemRenderingState& item,
+    size_t start_id)
+{
+    if (d_renderedItemsDirty)
+        updateRenderedItems();
+
+    const bool is_rendered = &item == &d_rootItemState ||
+        getRenderedItemPosition(&item) < d_renderedItems.size();
+    size_t first_position = d_renderedItems.size();
+
+    for (size_t id = start_id; id < item.d_children.size(); ++id)
+    {
+        TreeViewItemRenderingState* child = &item.d_children[id];
+        std::vector<TreeViewItemRenderingState*>::iterator sibling =
+            item.d_renderedChildren.end();
+
+        if (d_sortMode == VSM_Ascending)
+            sibling = std::upper_bound(item.d_renderedChildren.begin(),
+                item.d_renderedChildren.end(), child, &treeViewItemPointerLess);
+        else if (d_sortMode == VSM_Descending)
+            sibling = std::upper_bound(item.d_renderedChildren.begin(),
+                item.d_renderedChildren.end(), child, &treeViewItemPointerGreater);
+
+        if (is_rendered)
+        {
+            // the child goes right before its next sibling, or after the
+            // last rendered descendant of the item.
+            const size_t position = sibling != item.d_renderedChildren.end()
+                ? getRenderedItemPosition(*sibling)
+                : getSubtreeEndPosition(item);
+
+            d_renderedItems.insert(d_renderedItems.begin() + position, child);
+            first_position = std::min(first_position, position);
+        }
+
+        item.d_renderedChildren.insert(sibling, child);
+    }
+
+    if (!is_rendered)
+        return;
+
+    updateItemOffsets(first_position);
+    invalidateRenderedItems(first_position);
+}
+
+//----------------------------------------------------------------------------//
+size_t TreeView::getSubtreeEndPosition(const TreeViewItemRenderingState& item) const
+{
+    if (&item == &d_rootItemState)
+        return d_renderedItems.size();
+
+    size_t position = getRenderedItemPosition(&item) + 1;
+    while (position < d_renderedItems.size() &&
+        d_renderedItems[position]->d_nestedLevel > item.d_nestedLevel)
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+//----------------------------------------------------------------------------//
+bool TreeView::onChildrenDataChanged(const EventArgs& args)
+{
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender)
+        return ItemView::onChildrenDataChanged(args);
+
+    rebuildSelectedIndexLookup();
+
+    TreeViewItemRenderingState* item = getTreeViewItemForIndex(margs.d_parentIndex);
+    if (item == 0 || !item->d_subtreeIsExpanded)
+        return true;
+
+    for (size_t id = margs.d_startId; id < margs.d_startId + margs.d_count; ++id)
+    {
+        TreeViewItemRenderingState& child = item->d_children.at(id);
+
+        if (d_isVirtualisedRenderingEnabled)
+        {
+            // keep the cached size; the item is refreshed once it's visible.
+            child.d_needsUpdate = true;
+        }
+        else
+        {
+            // the total height is recomputed from the offsets below.
+            float item_height = 0;
+            fillRenderingState(child,
+                d_itemModel->makeIndex(child.d_childId, child.d_parentIndex),
+                d_renderedMaxWidth, item_height);
+        }
+    }
+
+    // the new data might change the order of the children as well.
+    if (d_sortMode != VSM_None)
+        item->sortChildren();
+
+    updateRenderedItems();
+    invalidateRenderedItems(getFirstChangedPosition(*item, margs.d_startId));
     return true;
 }
 
@@ -583,8 +861,24 @@ void TreeView::expandSubtreeRecursive(TreeViewItemRenderingState& item)
 //----------------------------------------------------------------------------//
 Rectf TreeView::getIndexRect(const ModelIndex& index)
 {
-    //TODO: implement for tree view. What do we do for indices in closed subtrees?
-    CEGUI_THROW(InvalidRequestException("Not implemented for tree view yet."));
+    prepareForRender();
+
+    TreeViewItemRenderingState* item = getTreeViewItemForIndex(index);
+    if (item == 0)
+        return Rectf(0, 0, 0, 0);
+
+    // items of collapsed subtrees are not rendered, so they have no area.
+    std::vector<TreeViewItemRenderingState*>::const_iterator itor =
+        std::find(d_renderedItems.begin(), d_renderedItems.end(), item);
+    if (itor == d_renderedItems.end())
+        return Rectf(0, 0, 0, 0);
+
+    glm::vec2 pos(
+        getViewRenderer()->getSubtreeExpanderXIndent(item->d_nestedLevel) +
+            getViewRenderer()->getSubtreeExpanderSize().d_width,
+        getRenderedItemOffset(itor - d_renderedItems.begin()));
+
+    return Rectf(pos, item->d_size);
 }
 
 #if defined(_MSC_VER)
@@ -87,6 +87,10 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(0),
     d_columnCount(0),
+    d_rowOffsetsValid(false),
+    d_itemRowsValid(false),
+    d_gridSortColumn(0),
+    d_gridSortDirection(ListHeaderSegment::None),
     d_autoSizeColumnUsesHeader(false)
 {
 	// add properties
@@ -238,13 +242,13 @@ ListHeaderSegment& MultiColumnList::getHeaderSegmentForColumn(uint col_idx) cons
 *************************************************************************/
 uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		if (isListboxItemInRow(item, i))
-		{
-			return i;
-		}
+	updateItemRowIndex();
+
+	ItemRowIndex::const_iterator pos = d_itemRows.find(item);
 
+	if (pos != d_itemRows.end())
+	{
+		return pos->second;
 	}
 
 	// item is not attached to the list box, throw...
@@ -258,9 +262,12 @@ uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 *************************************************************************/
 uint MultiColumnList::getItemColumnIndex(const ListboxItem* item) const
 {
+	// the row lookup is indexed, so only that row needs to be searched.
+	const ListRow& row = d_grid[getItemRowIndex(item)];
+
 	for (uint i = 0; i < getColumnCount(); ++i)
 	{
-		if (isListboxItemInColumn(item, i))
+		if (row[i] == item)
 		{
 			return i;
 		}
@@ -370,20 +377,9 @@ bool MultiColumnList::isListboxItemInRow(const ListboxItem* item, uint row_idx)
 *************************************************************************/
 bool MultiColumnList::isListboxItemInList(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		for (uint j = 0; j < getColumnCount(); ++j)
-		{
-			if (d_grid[i][j] == item)
-			{
-				return true;
-			}
+	updateItemRowIndex();
 
-		}
-
-	}
-
-	return false;
+	return d_itemRows.find(item) != d_itemRows.end();
 }
 
 
@@ -756,6 +752,11 @@ void MultiColumnList::insertColumn(const String& text, uint col_id, const UDim&
             static_cast<ListboxItem*>(0));
 	}
 
+	// column indices have shifted, so the sort order is no longer known.
+	// blank cells change neither row heights nor item rows, so the row
+	// caches stay valid.
+	d_gridSortDirection = ListHeaderSegment::None;
+
 	// update stored nominated selection column if that has changed.
 	if ((d_nominatedSelectCol >= position) && (getColumnCount() > 1))
 	{
@@ -808,6 +809,9 @@ void MultiColumnList::removeColumn(uint col_idx)
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
 
+		d_gridSortDirection = ListHeaderSegment::None;
+		updateRowHeights();
+
 		// signal a change to the list contents
 		WindowEventArgs args(this);
 		onListContentsChanged(args);
@@ -876,6 +880,8 @@ uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
 		row[col_idx] = item;
 	}
 
+	row.d_height = calculateRowHeight(row);
+
 	uint pos;
 
 	// if sorting is enabled, insert at an appropriate position
@@ -896,8 +902,11 @@ uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
 	{
 		pos = getRowCount();
 		d_grid.push_back(row);
+		d_gridSortDirection = ListHeaderSegment::None;
 	}
 
+	updateRowCachesForInsert(pos);
+
 	// signal a change to the list contents
 	WindowEventArgs args(this);
 	onListContentsChanged(args);
@@ -932,6 +941,7 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 		row.d_sortColumn = getSortColumn();
 		row.d_items.resize(getColumnCount(), 0);
 		row.d_rowID = row_id;
+		row.d_height = 0.0f;
 
 		// if row index is too big, just insert at end.
 		if (row_idx > getRowCount())
@@ -940,6 +950,8 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 		}
 
 		d_grid.insert(d_grid.begin() + row_idx, row);
+		d_gridSortDirection = ListHeaderSegment::None;
+		updateRowCachesForInsert(row_idx);
 
 		// set the initial item in the new row
 		setItem(item, col_id, row_idx);
@@ -967,6 +979,8 @@ void MultiColumnList::removeRow(uint row_idx)
 	}
 	else
 	{
+		updateRowCachesForRemove(row_idx);
+
 		// delete items we are supposed to
 		for (uint i = 0; i < getColumnCount(); ++i)
 		{
@@ -1027,7 +1041,11 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 		item->setOwnerWindow(this);
 
 	d_grid[position.row][position.column] = item;
+	updateRowForReplacedItem(position, oldItem);
 
+	// the row may no longer be in sorted order.
+	if (position.column == d_gridSortColumn)
+		d_gridSortDirection = ListHeaderSegment::None;
 
 	// signal a change to the list contents
 	WindowEventArgs args(this);
@@ -1329,6 +1347,9 @@ void MultiColumnList::setItemSelectState(const MCLGridRef& grid_ref, bool state)
 *************************************************************************/
 void MultiColumnList::handleUpdatedItemData(void)
 {
+    // item sizes and sort keys may have changed, so recompute everything.
+    updateRowHeights();
+    d_gridSortDirection = ListHeaderSegment::None;
     resortList();
 	configureScrollbars();
 	invalidate();
@@ -1466,14 +1487,9 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
+	updateRowOffsets();
 
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		height += getHighestRowItemHeight(i);
-	}
-
-	return height;
+	return d_rowOffsets.back();
 }
 
 
@@ -1531,33 +1547,79 @@ float MultiColumnList::getHighestRowItemHeight(uint row_idx) const
 	}
 	else
 	{
-		float height = 0.0f;
+		return calculateRowHeight(d_grid[row_idx]);
+	}
 
-		// check each item in the column
-		for (uint i = 0; i < getColumnCount(); ++i)
-		{
-			ListboxItem* item = d_grid[row_idx][i];
+}
 
-			// if the slot has an item in it
-			if (item)
-			{
-				Sizef sz(item->getPixelSize());
 
-				// see if this item is higher than the previous highest
-				if (sz.d_height > height)
-				{
-					// update current highest
-					height = sz.d_height;
-				}
+/*************************************************************************
+	Return the offset of the top of the given row from the top of the
+	list content.
+*************************************************************************/
+float MultiColumnList::getRowOffset(uint row_idx) const
+{
+	if (row_idx > getRowCount())
+	{
+		CEGUI_THROW(InvalidRequestException(
+            "specified row is out of range."));
+	}
+
+	updateRowOffsets();
+
+	return d_rowOffsets[row_idx];
+}
+
+
+/*************************************************************************
+	Return the index of the row at the given offset from the top of the
+	list content.
+*************************************************************************/
+uint MultiColumnList::getRowAtOffset(float offset) const
+{
+	updateRowOffsets();
+
+	// d_rowOffsets is mutable, so take a const view to get matching iterators.
+	const std::vector<float>& offsets = d_rowOffsets;
+
+	// the first row whose bottom edge lies below the offset.
+	std::vector<float>::const_iterator pos =
+		std::upper_bound(offsets.begin() + 1, offsets.end(), offset);
+
+	return (uint)std::distance(offsets.begin() + 1, pos);
+}
+
+
+/*************************************************************************
+	Return the height of the highest item in the given row.
+*************************************************************************/
+float MultiColumnList::calculateRowHeight(const ListRow& row) const
+{
+	float height = 0.0f;
+
+	// check each item in the row
+	for (uint i = 0; i < getColumnCount(); ++i)
+	{
+		ListboxItem* item = row[i];
 
+		// if the slot has an item in it
+		if (item)
+		{
+			Sizef sz(item->getPixelSize());
+
+			// see if this item is higher than the previous highest
+			if (sz.d_height > height)
+			{
+				// update current highest
+				height = sz.d_height;
 			}
 
 		}
 
-		// return the hightest item.
-		return height;
 	}
 
+	// return the hightest item.
+	return height;
 }
 
 
@@ -1600,28 +1662,25 @@ ListboxItem* MultiColumnList::getItemAtPoint(const glm::vec2& pt) const
     const ListHeader* header = getListHeader();
     const Rectf listArea(getListRenderArea());
 
-    float y = listArea.d_min.d_y - getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.d_x - getHorzScrollbar()->getScrollPosition();
 
-    for (uint i = 0; i < getRowCount(); ++i)
-    {
-        y += getHighestRowItemHeight(i);
+    // locate the row via the cached row offsets.
+    const uint row = getRowAtOffset(
+        pt.y - listArea.d_min.d_y + getVertScrollbar()->getScrollPosition());
 
-        // have we located the row?
-        if (pt.y < y)
+    if (row < getRowCount())
+    {
+        // scan across to find column that was clicked
+        for (uint j = 0; j < getColumnCount(); ++j)
         {
-            // scan across to find column that was clicked
-            for (uint j = 0; j < getColumnCount(); ++j)
+            const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+            x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
+
+            // was this the column?
+            if (pt.x < x)
             {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (pt.x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
+                // return contents of grid element that was clicked.
+                return d_grid[row][j];
             }
         }
     }
@@ -1776,6 +1835,8 @@ void MultiColumnList::moveColumn_impl(uint col_idx, uint position)
 			d_grid[i].d_items.insert(d_grid[i].d_items.begin() + position, item);
 		}
 
+		d_gridSortDirection = ListHeaderSegment::None;
+
 	}
 
 }
@@ -1901,6 +1962,10 @@ void MultiColumnList::onFontChanged(WindowEventArgs& e)
 
     // Call base class handler
     Window::onFontChanged(e);
+
+    // items using the list font may have changed size.
+    updateRowHeights();
+    configureScrollbars();
 }
 
 /*************************************************************************
@@ -2332,6 +2397,7 @@ bool MultiColumnList::resetList_impl(void)
 
 		// clear all items from the grid.
 		d_grid.clear();
+		invalidateRowCaches();
 
 		// reset other affected fields
 		d_nominatedSelectRow = 0;
@@ -2540,17 +2606,11 @@ void MultiColumnList::ensureRowIsVisible(uint row_idx)
     }
     else
     {
-        float bottom;
-        float top = 0.0f;
         float listHeight = getListRenderArea().getHeight();
 
-        // get distance to top of item
-        uint row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
-
-        // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        // get distances to top and bottom of item
+        float top = getRowOffset(row_idx);
+        float bottom = getRowOffset(row_idx + 1);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2696,17 +2756,201 @@ bool MultiColumnList::ListRow::operator>(const ListRow& rhs) const
 void MultiColumnList::resortList()
 {
     // re-sort list according to direction
-    ListHeaderSegment::SortDirection dir = getSortDirection();
+    const ListHeaderSegment::SortDirection dir = getSortDirection();
+
+    if (dir == ListHeaderSegment::None)
+    {
+        // no (or invalid) direction, so do not sort.
+        d_gridSortDirection = ListHeaderSegment::None;
+        return;
+    }
+
+    const uint col = getSortColumn();
 
-    if (dir == ListHeaderSegment::Descending)
+    // already in the requested order, nothing to do.
+    if (col == d_gridSortColumn && dir == d_gridSortDirection)
+        return;
+
+    // only the direction changed, so the existing order can be reversed.
+    if (col == d_gridSortColumn && d_gridSortDirection != ListHeaderSegment::None)
+    {
+        std::reverse(d_grid.begin(), d_grid.end());
+    }
+    else if (dir == ListHeaderSegment::Descending)
     {
-        std::sort(d_grid.begin(), d_grid.end(), pred_descend);
+        std::stable_sort(d_grid.begin(), d_grid.end(), pred_descend);
     }
-    else if (dir == ListHeaderSegment::Ascending)
+    else
     {
-        std::sort(d_grid.begin(), d_grid.end());
+        std::stable_sort(d_grid.begin(), d_grid.end());
     }
-    // else no (or invalid) direction, so do not sort.
+
+    d_gridSortColumn = col;
+    d_gridSortDirection = dir;
+    invalidateRowCaches();
+}
+
+/*************************************************************************
+    Invalidate the cached row offsets and item to row index
+*************************************************************************/
+void MultiColumnList::invalidateRowCaches()
+{
+    d_rowOffsetsValid = false;
+    d_itemRowsValid = false;
+}
+
+/*************************************************************************
+    Update the row caches for a row inserted at 'row_idx'
+*************************************************************************/
+void MultiColumnList::updateRowCachesForInsert(uint row_idx)
+{
+    const ListRow& row = d_grid[row_idx];
+    const bool appended = row_idx + 1 == getRowCount();
+
+    if (d_rowOffsetsValid)
+    {
+        // insert the bottom edge of the new row and push the rows below down.
+        const float height = row.d_height;
+        d_rowOffsets.insert(d_rowOffsets.begin() + row_idx + 1,
+                            d_rowOffsets[row_idx] + height);
+
+        for (size_t i = row_idx + 2; i < d_rowOffsets.size(); ++i)
+            d_rowOffsets[i] += height;
+    }
+
+    if (d_itemRowsValid)
+    {
+        if (!appended)
+        {
+            for (ItemRowIndex::iterator i = d_itemRows.begin();
+                 i != d_itemRows.end(); ++i)
+            {
+                if (i->second >= row_idx)
+                    ++i->second;
+            }
+        }
+
+        for (uint j = 0; j < getColumnCount(); ++j)
+        {
+            if (row[j])
+                d_itemRows[row[j]] = row_idx;
+        }
+    }
+}
+
+/*************************************************************************
+    Update the row caches for the row at 'row_idx' that is to be removed
+*************************************************************************/
+void MultiColumnList::updateRowCachesForRemove(uint row_idx)
+{
+    const ListRow& row = d_grid[row_idx];
+
+    if (d_rowOffsetsValid)
+    {
+        const float height = row.d_height;
+        d_rowOffsets.erase(d_rowOffsets.begin() + row_idx + 1);
+
+        for (size_t i = row_idx + 1; i < d_rowOffsets.size(); ++i)
+            d_rowOffsets[i] -= height;
+    }
+
+    if (d_itemRowsValid)
+    {
+        for (uint j = 0; j < getColumnCount(); ++j)
+        {
+            if (row[j])
+                d_itemRows.erase(row[j]);
+        }
+
+        if (row_idx + 1 != getRowCount())
+        {
+            for (ItemRowIndex::iterator i = d_itemRows.begin();
+                 i != d_itemRows.end(); ++i)
+            {
+                if (i->second > row_idx)
+                    --i->second;
+            }
+        }
+    }
+}
+
+/*************************************************************************
+    Update the row height and row caches after the item at 'position' was
+    replaced
+*************************************************************************/
+void MultiColumnList::updateRowForReplacedItem(const MCLGridRef& position,
+                                     const ListboxItem* old_item)
+{
+    ListRow& row = d_grid[position.row];
+    const float old_height = row.d_height;
+    row.d_height = calculateRowHeight(row);
+
+    if (d_rowOffsetsValid && row.d_height != old_height)
+    {
+        const float delta = row.d_height - old_height;
+
+        for (size_t i = position.row + 1; i < d_rowOffsets.size(); ++i)
+            d_rowOffsets[i] += delta;
+    }
+
+    if (d_itemRowsValid)
+    {
+        if (old_item)
+            d_itemRows.erase(old_item);
+
+        if (row[position.column])
+            d_itemRows[row[position.column]] = position.row;
+    }
+}
+
+/*************************************************************************
+    Recompute the cached height of every row
+*************************************************************************/
+void MultiColumnList::updateRowHeights()
+{
+    for (uint i = 0; i < getRowCount(); ++i)
+        d_grid[i].d_height = calculateRowHeight(d_grid[i]);
+
+    invalidateRowCaches();
+}
+
+/*************************************************************************
+    Rebuild the cached row offsets if required
+*************************************************************************/
+void MultiColumnList::updateRowOffsets() const
+{
+    if (d_rowOffsetsValid)
+        return;
+
+    d_rowOffsets.resize(d_grid.size() + 1);
+    d_rowOffsets[0] = 0.0f;
+
+    for (size_t i = 0; i < d_grid.size(); ++i)
+        d_rowOffsets[i + 1] = d_rowOffsets[i] + d_grid[i].d_height;
+
+    d_rowOffsetsValid = true;
+}
+
+/*************************************************************************
+    Rebuild the item to row index if required
+*************************************************************************/
+void MultiColumnList::updateItemRowIndex() const
+{
+    if (d_itemRowsValid)
+        return;
+
+    d_itemRows.clear();
+
+    for (uint i = 0; i < getRowCount(); ++i)
+    {
+        for (uint j = 0; j < getColumnCount(); ++j)
+        {
+            if (d_grid[i][j])
+                d_itemRows.insert(std::make_pair(d_grid[i][j], i));
+        }
+    }
+
+    d_itemRowsValid = true;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -101,6 +101,11 @@ MultiLineEditbox::MultiLineEditbox(const String& type, const String& name) :
 	d_dragAnchorIdx(0),
 	d_wordWrap(true),
 	d_widestExtent(0.0f),
+	d_linesValid(false),
+	d_textChangePending(false),
+	d_changeStartIdx(0),
+	d_changeOldEnd(0),
+	d_changeNewEnd(0),
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_selectionBrush(0),
@@ -327,7 +332,7 @@ void MultiLineEditbox::ensureCaretIsVisible(void)
 		size_t caretLineIdx = d_caretPos - d_lines[caretLine].d_startIdx;
 
 		float ypos = caretLine * fnt->getLineSpacing();
-        float xpos = fnt->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+        float xpos = fnt->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, caretLineIdx);
 
 		// adjust position for scroll bars
 		xpos -= horzScrollbar->getScrollPosition();
@@ -368,6 +373,7 @@ void MultiLineEditbox::setWordWrapping(bool setting)
 	if (setting != d_wordWrap)
 	{
 		d_wordWrap = setting;
+		d_linesValid = false;
 		formatText(true);
 
 		WindowEventArgs args(this);
@@ -433,133 +439,95 @@ void MultiLineEditbox::configureScrollbars(void)
 }
 
 //----------------------------------------------------------------------------//
-void MultiLineEditbox::formatText(const bool update_scrollbars)
+// Orders lines by their start index, for searching the formatted lines.
+struct LineStartIndexLess
 {
-	d_widestExtent = 0.0f;
+    bool operator()(size_t index, const MultiLineEditbox::LineInfo& line) const
+    {
+        return index < line.d_startIdx;
+    }
 
-	String paraText;
+    bool operator()(const MultiLineEditbox::LineInfo& line, size_t index) const
+    {
+        return line.d_startIdx < index;
+    }
+};
 
-	const Font* fnt = getFont();
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::formatText(const bool update_scrollbars)
+{
+    const Font* fnt = getFont();
 
-	if (fnt)
-	{
-		float areaWidth = getTextRenderArea().getWidth();
-        String::size_type   currPos = 0;
-        String::size_type   paraLen;
-        LineInfo    line;
+    if (fnt)
+    {
+        const float areaWidth = getTextRenderArea().getWidth();
 
-        // now we will check if our width changed, if not we'll just update text from last cursor
-        if (areaWidth != d_lastRenderWidth || !d_undoHandler->canUndo())
+        if (!d_linesValid)
         {
             d_lines.clear();
+
+            const String& text = getText();
+            String::size_type currPos = 0;
+
+            while (currPos < text.length())
+            {
+                String::size_type paraLen = text.find_first_of(d_lineBreakChars, currPos);
+
+                if (paraLen == String::npos)
+                    paraLen = text.length() - currPos;
+                else
+                    ++paraLen -= currPos;
+
+                formatParagraph(currPos, paraLen, areaWidth, d_lines);
+
+                // skip to next 'paragraph' in text
+                currPos += paraLen;
+            }
         }
-        else
+        // the text is unchanged, so only the wrapping depends on the width
+        else if (d_wordWrap && (areaWidth != d_lastRenderWidth))
         {
-            // ok there's no need to update whole text
-            size_t lastuUndoPos = d_undoHandler->getLastAction().d_startIdx;
-            // ok now delete all formatting data before lastuUndoPos
-            int countToRemove = getLineNumberFromIndex(lastuUndoPos) - 1;
-            if (countToRemove >= 0)
+            LineList lines;
+            lines.reserve(d_lines.size());
+
+            size_t lineIdx = 0;
+            while (lineIdx < d_lines.size())
             {
-                d_lines.erase(d_lines.begin() + countToRemove, d_lines.end());
-                if (d_lines.size() > 0)
-                    currPos = d_lines.back().d_startIdx + d_lines.back().d_length;
+                size_t paraEndLine = lineIdx + 1;
+                while (paraEndLine < d_lines.size() && !isParagraphStart(paraEndLine))
+                    ++paraEndLine;
+
+                const LineInfo& firstLine = d_lines[lineIdx];
+                const LineInfo& lastLine = d_lines[paraEndLine - 1];
+
+                // a paragraph that was not wrapped and still fits can be kept
+                if ((paraEndLine == lineIdx + 1) && (areaWidth > 0.0f) &&
+                    (firstLine.d_extent <= areaWidth))
+                {
+                    lines.push_back(firstLine);
+                }
+                else
+                {
+                    formatParagraph(firstLine.d_startIdx,
+                        lastLine.d_startIdx + lastLine.d_length - firstLine.d_startIdx,
+                        areaWidth, lines);
+                }
+
+                lineIdx = paraEndLine;
             }
-            else
-                d_lines.clear();
-        }
 
-        while (currPos < getText().length())
-		{
-           if ((paraLen = getText().find_first_of(d_lineBreakChars, currPos)) == String::npos)
-			{
-               paraLen = getText().length() - currPos;
-			}
-			else
-			{
-				++paraLen -= currPos;
-			}
-
-            paraText = getText().substr(currPos, paraLen);
-
-			if (!d_wordWrap || (areaWidth <= 0.0f))
-			{
-				// no word wrapping, so we are just one long line.
-				line.d_startIdx = currPos;
-				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
-				d_lines.push_back(line);
-
-				// update widest, if needed.
-				if (line.d_extent > d_widestExtent)
-				{
-					d_widestExtent = line.d_extent;
-				}
-
-			}
-			// must word-wrap the paragraph text
-			else
-			{
-				String::size_type lineIndex = 0;
-
-				// while there is text in the string
-				while (lineIndex < paraLen)
-				{
-					String::size_type  lineLen = 0;
-					float lineExtent = 0.0f;
-
-					// loop while we have not reached the end of the paragraph string
-					while (lineLen < (paraLen - lineIndex))
-					{
-						// get cp / char count of next token
-						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
-
-						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
-
-						// would adding this token would overflow the available width
-						if ((lineExtent + tokenExtent) > areaWidth)
-						{
-							// Was this the first token?
-							if (lineLen == 0)
-							{
-								// get point at which to break the token
-								lineLen = fnt->getCharAtPixel(paraText.substr(lineIndex, nextTokenSize), areaWidth);
-							}
-
-							// text wraps, exit loop early with line info up until wrap point
-							break;
-						}
-
-						// add this token to current line
-						lineLen    += nextTokenSize;
-						lineExtent += tokenExtent;
-					}
-
-					// set up line info and add to collection
-					line.d_startIdx = currPos + lineIndex;
-					line.d_length	= lineLen;
-					line.d_extent	= lineExtent;
-					d_lines.push_back(line);
-
-					// update widest, if needed.
-					if (lineExtent > d_widestExtent)
-					{
-						d_widestExtent = lineExtent;
-					}
-
-					// update position in string
-					lineIndex += lineLen;
-				}
-
-			}
-
-			// skip to next 'paragraph' in text
-			currPos += paraLen;
-		}
+            d_lines.swap(lines);
+        }
 
-		d_lastRenderWidth = areaWidth;
-	}
+        d_linesValid = true;
+        d_lastRenderWidth = areaWidth;
+        updateWidestExtent();
+    }
+    else
+    {
+        d_linesValid = false;
+        d_widestExtent = 0.0f;
+    }
 
     if (update_scrollbars)
         configureScrollbars();
@@ -567,6 +535,205 @@ void MultiLineEditbox::formatText(const bool update_scrollbars)
 	invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::formatParagraph(size_t start_idx, size_t length,
+                                       float area_width, LineList& lines) const
+{
+    const Font* fnt = getFont();
+    const String& text = getText();
+    LineInfo line;
+
+    if (!d_wordWrap || (area_width <= 0.0f))
+    {
+        // no word wrapping, so we are just one long line.
+        line.d_startIdx = start_idx;
+        line.d_length   = length;
+        line.d_extent   = fnt->getTextExtent(text, start_idx, length);
+        lines.push_back(line);
+        return;
+    }
+
+    const size_t paraEnd = start_idx + length;
+    size_t lineStart = start_idx;
+
+    // while there is text in the paragraph
+    while (lineStart < paraEnd)
+    {
+        size_t lineLen = 0;
+        float lineExtent = 0.0f;
+
+        // loop while we have not reached the end of the paragraph
+        while (lineStart + lineLen < paraEnd)
+        {
+            const size_t tokenStart = lineStart + lineLen;
+
+            // get cp / char count of next token
+            const size_t nextTokenSize =
+                ceguimin(getNextTokenLength(text, tokenStart), paraEnd - tokenStart);
+
+            // get pixel width of the token
+            const float tokenExtent = fnt->getTextExtent(text, tokenStart, nextTokenSize);
+
+            // would adding this token would overflow the available width
+            if ((lineExtent + tokenExtent) > area_width)
+            {
+                // Was this the first token?
+                if (lineLen == 0)
+                {
+                    // get point at which to break the token, taking at least
+                    // one code point so that formatting always progresses
+                    lineLen = ceguimax<size_t>(1, ceguimin(nextTokenSize,
+                        fnt->getCharAtPixel(text, lineStart, area_width) - lineStart));
+                    lineExtent = fnt->getTextExtent(text, lineStart, lineLen);
+                }
+
+                // text wraps, exit loop early with line info up until wrap point
+                break;
+            }
+
+            // add this token to current line
+            lineLen    += nextTokenSize;
+            lineExtent += tokenExtent;
+        }
+
+        // set up line info and add to collection
+        line.d_startIdx = lineStart;
+        line.d_length   = lineLen;
+        line.d_extent   = lineExtent;
+        lines.push_back(line);
+
+        // update position in paragraph
+        lineStart += lineLen;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::formatChangedText()
+{
+    if (!d_textChangePending)
+        return;
+
+    d_textChangePending = false;
+
+    if (!d_linesValid || d_lines.empty() || !getFont())
+    {
+        d_linesValid = false;
+        return;
+    }
+
+    const String& text = getText();
+
+    // text before the change is unchanged, so the paragraph that the change
+    // starts in can be found from the existing lines
+    size_t firstLine = std::upper_bound(d_lines.begin(), d_lines.end(),
+        d_changeStartIdx, LineStartIndexLess()) - d_lines.begin();
+
+    if (firstLine > 0)
+        --firstLine;
+
+    while (firstLine > 0 && !isParagraphStart(firstLine))
+        --firstLine;
+
+    const size_t reformatStart = d_lines[firstLine].d_startIdx;
+
+    // reformat up to the end of the paragraph the change ends in
+    size_t reformatEnd = text.find_first_of(d_lineBreakChars, d_changeNewEnd);
+    reformatEnd = (reformatEnd == String::npos) ? text.length() : reformatEnd + 1;
+
+    // text after the change is unchanged as well, only its position moved
+    const size_t oldReformatEnd = reformatEnd - d_changeNewEnd + d_changeOldEnd;
+
+    const size_t lastLine = std::lower_bound(d_lines.begin() + firstLine,
+        d_lines.end(), oldReformatEnd, LineStartIndexLess()) - d_lines.begin();
+
+    LineList lines;
+    String::size_type currPos = reformatStart;
+
+    while (currPos < reformatEnd)
+    {
+        String::size_type paraLen = text.find_first_of(d_lineBreakChars, currPos);
+
+        if (paraLen == String::npos || paraLen >= reformatEnd)
+            paraLen = reformatEnd - currPos;
+        else
+            ++paraLen -= currPos;
+
+        formatParagraph(currPos, paraLen, d_lastRenderWidth, lines);
+        currPos += paraLen;
+    }
+
+    for (size_t i = lastLine; i < d_lines.size(); ++i)
+        d_lines[i].d_startIdx = d_lines[i].d_startIdx - oldReformatEnd + reformatEnd;
+
+    // typing usually leaves the number of lines unchanged, so overwrite the
+    // existing entries where possible
+    const size_t replaced = ceguimin(lines.size(), lastLine - firstLine);
+    std::copy(lines.begin(), lines.begin() + replaced, d_lines.begin() + firstLine);
+
+    if (replaced < lastLine - firstLine)
+        d_lines.erase(d_lines.begin() + firstLine + replaced,
+                      d_lines.begin() + lastLine);
+    else
+        d_lines.insert(d_lines.begin() + lastLine,
+                       lines.begin() + replaced, lines.end());
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::replaceTextRange(size_t start_idx, size_t length,
+                                        const String& text)
+{
+    length = ceguimin(length, d_textLogical.length() - start_idx);
+
+    d_textLogical.replace(start_idx, length, text);
+    d_renderedStringValid = false;
+    d_bidiDataValid = false;
+
+    recordTextChange(start_idx, length, text.length());
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::recordTextChange(size_t start_idx, size_t removed,
+                                        size_t inserted)
+{
+    if (!d_textChangePending)
+    {
+        d_textChangePending = true;
+        d_changeStartIdx = start_idx;
+        d_changeOldEnd = start_idx + removed;
+        d_changeNewEnd = start_idx + inserted;
+        return;
+    }
+
+    // grow the pending change to cover both changes; anything after its end
+    // is unchanged text, which maps directly back to the formatted text
+    const size_t changedEnd = ceguimax(d_changeNewEnd, start_idx + removed);
+    d_changeOldEnd += changedEnd - d_changeNewEnd;
+    d_changeNewEnd = changedEnd - removed + inserted;
+    d_changeStartIdx = ceguimin(d_changeStartIdx, start_idx);
+}
+
+//----------------------------------------------------------------------------//
+bool MultiLineEditbox::isParagraphStart(size_t line_idx) const
+{
+    if (line_idx == 0)
+        return true;
+
+    const size_t startIdx = d_lines[line_idx].d_startIdx;
+    return d_lineBreakChars.find(getText()[startIdx - 1]) != String::npos;
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::updateWidestExtent()
+{
+    d_widestExtent = 0.0f;
+
+    for (LineList::const_iterator line = d_lines.begin(); line != d_lines.end(); ++line)
+    {
+        if (line->d_extent > d_widestExtent)
+            d_widestExtent = line->d_extent;
+    }
+}
+
 
 /*************************************************************************
 	Return the length of the next token in String 'text' starting at
@@ -621,16 +788,16 @@ size_t MultiLineEditbox::getTextIndexFromPosition(const glm::vec2& pt) const
 		lineNumber = d_lines.size() - 1;
 	}
 
-    const String lineText(getText().substr(d_lines[lineNumber].d_startIdx, d_lines[lineNumber].d_length));
+    const LineInfo& line = d_lines[lineNumber];
 
-    size_t lineIdx = getFont()->getCharAtPixel(lineText, wndPt.x);
+    size_t lineIdx = getFont()->getCharAtPixel(getText(), line.d_startIdx, wndPt.x) - line.d_startIdx;
 
-	if (lineIdx >= lineText.length() - 1)
+	if (lineIdx >= line.d_length - 1)
 	{
-		lineIdx = lineText.length() - 1;
+		lineIdx = line.d_length - 1;
 	}
 
-	return d_lines[lineNumber].d_startIdx + lineIdx;
+	return line.d_startIdx + lineIdx;
 }
 
 
@@ -652,18 +819,13 @@ size_t MultiLineEditbox::getLineNumberFromIndex(size_t index) const
 	}
 	else
 	{
-		size_t indexCount = 0;
-		size_t caretLine = 0;
+		// lines are contiguous and ordered by their start index
+		const size_t caretLine = std::upper_bound(d_lines.begin(), d_lines.end(),
+			index, LineStartIndexLess()) - d_lines.begin();
 
-		for (; caretLine < lineCount; ++caretLine)
+		if (caretLine > 0)
 		{
-			indexCount += d_lines[caretLine].d_length;
-
-			if (index < indexCount)
-			{
-				return caretLine;
-			}
-
+			return caretLine - 1;
 		}
 
 	}
@@ -701,14 +863,12 @@ void MultiLineEditbox::eraseSelectedText(bool modify_text)
 		// erase the selected characters (if required)
 		if (modify_text)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = getSelectionStartIndex();
-            undo.d_text = newText.substr(getSelectionStartIndex(), getSelectionLength());
+            undo.d_text = getText().substr(getSelectionStartIndex(), getSelectionLength());
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(getSelectionStartIndex(), getSelectionLength());
-            setText(newText);
+            replaceTextRange(getSelectionStartIndex(), getSelectionLength(), String());
 
 			// trigger notification that text has changed.
 			WindowEventArgs args(this);
@@ -757,24 +917,18 @@ bool MultiLineEditbox::performPaste(Clipboard& clipboard)
     if (clipboardText.empty())
         return false;
 
-    // backup current text
-    String tmp(getText());
-    tmp.erase(getSelectionStartIndex(), getSelectionLength());
-
     // erase selected text
     eraseSelectedText();
 
     // if there is room
     if (getText().length() - clipboardText.length() < d_maxTextLen)
     {
-        String newText = getText();
         UndoHandler::UndoAction undo;
         undo.d_type = UndoHandler::UAT_INSERT;
         undo.d_startIdx = getCaretIndex();
         undo.d_text = clipboardText;
         d_undoHandler->addUndoHistory(undo);
-        newText.insert(getCaretIndex(), clipboardText);
-        setText(newText);
+        replaceTextRange(getCaretIndex(), 0, clipboardText);
 
         d_caretPos += clipboardText.length();
 
@@ -806,15 +960,13 @@ void MultiLineEditbox::handleBackspace(void)
 		}
 		else if (d_caretPos > 0)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = d_caretPos - 1;
-            undo.d_text = newText.substr(d_caretPos - 1, 1);
+            undo.d_text = getText().substr(d_caretPos - 1, 1);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(d_caretPos - 1, 1);
+            replaceTextRange(d_caretPos - 1, 1, String());
             setCaretIndex(d_caretPos - 1);
-            setText(newText);
 
 			WindowEventArgs args(this);
 			onTextChanged(args);
@@ -837,14 +989,12 @@ void MultiLineEditbox::handleDelete(void)
 		}
         else if (getCaretIndex() < getText().length() - 1)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = d_caretPos;
-            undo.d_text = newText.substr(d_caretPos, 1);
+            undo.d_text = getText().substr(d_caretPos, 1);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(d_caretPos, 1);
-            setText(newText);
+            replaceTextRange(d_caretPos, 1, String());
 
 			ensureCaretIsVisible();
 
@@ -1049,11 +1199,12 @@ void MultiLineEditbox::handleLineUp(bool select)
 
 	if (caretLine > 0)
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx);
 
 		--caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = ceguimin(d_lines[caretLine].d_length,
+            getFont()->getCharAtPixel(getText(), d_lines[caretLine].d_startIdx, caretPixelOffset) - d_lines[caretLine].d_startIdx);
 
 		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
 	}
@@ -1078,11 +1229,12 @@ void MultiLineEditbox::handleLineDown(bool select)
 
 	if ((d_lines.size() > 1) && (caretLine < (d_lines.size() - 1)))
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx);
 
 		++caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = ceguimin(d_lines[caretLine].d_length,
+            getFont()->getCharAtPixel(getText(), d_lines[caretLine].d_startIdx, caretPixelOffset) - d_lines[caretLine].d_startIdx);
 
 		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
 	}
@@ -1111,14 +1263,12 @@ void MultiLineEditbox::handleNewLine()
 		// if there is room
        if (getText().length() - 1 < d_maxTextLen)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_INSERT;
             undo.d_startIdx = getCaretIndex();
             undo.d_text = "\x0a";
             d_undoHandler->addUndoHistory(undo);
-            newText.insert(getCaretIndex(), 1, 0x0a);
-            setText(newText);
+            replaceTextRange(getCaretIndex(), 0, undo.d_text);
 
 			d_caretPos++;
 
@@ -1277,14 +1427,12 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
 		// if there is room
        if (getText().length() - 1 < d_maxTextLen)
         {
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_INSERT;
             undo.d_startIdx = getCaretIndex();
             undo.d_text = e.character;
             d_undoHandler->addUndoHistory(undo);
-            newText.insert(getCaretIndex(), 1, e.character);
-            setText(newText);
+            replaceTextRange(getCaretIndex(), 0, undo.d_text);
 
 			d_caretPos++;
 
@@ -1309,13 +1457,17 @@ void MultiLineEditbox::onCharacter(TextEventArgs& e)
 *************************************************************************/
 void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
 {
+    // text set other than via replaceTextRange has to be formatted again
+    if (!d_textChangePending)
+        d_linesValid = false;
+
     // ensure last character is a new line
     if ((getText().length() == 0) || (getText()[getText().length() - 1] != '\n'))
-    {
-        String newText = getText();
-        newText.append(1, '\n');
-        setText(newText);
-    }
+        replaceTextRange(getText().length(), 0, String(1, '\n'));
+
+    // update the lines of the changed paragraphs before any handler of the
+    // event below can change the text again
+    formatChangedText();
 
 
     // base class processing
@@ -1378,6 +1530,7 @@ void MultiLineEditbox::onScroll(CursorInputEventArgs& e)
 void MultiLineEditbox::onFontChanged(WindowEventArgs& e)
 {
     Window::onFontChanged(e);
+    d_linesValid = false;
     formatText(true);
 }
 
@@ -1619,9 +1772,22 @@ bool MultiLineEditbox::performUndo()
     {
         clearSelection();
 
+        if (d_undoHandler->canUndo())
+        {
+            const UndoHandler::UndoAction action(d_undoHandler->getUndoAction());
+            if (action.d_type == UndoHandler::UAT_INSERT)
+                recordTextChange(action.d_startIdx, action.d_text.length(), 0);
+            else
+                recordTextChange(action.d_startIdx, 0, action.d_text.length());
+        }
+
+        // the text change is notified via setText, and the caret is updated
+        // afterwards, so just make sure the caret is still visible.
         result = d_undoHandler->undo(d_caretPos);
-        WindowEventArgs args(this);
-        onTextChanged(args);
+        d_textChangePending = false;
+
+        if (result)
+            ensureCaretIsVisible();
     }
 
     return result;
@@ -1634,9 +1800,22 @@ bool MultiLineEditbox::performRedo()
     if (!isReadOnly())
     {
         clearSelection();
+
+        if (d_undoHandler->canRedo())
+        {
+            const UndoHandler::UndoAction action(d_undoHandler->getRedoAction());
+            if (action.d_type == UndoHandler::UAT_INSERT)
+                recordTextChange(action.d_startIdx, 0, action.d_text.length());
+            else
+                recordTextChange(action.d_startIdx, action.d_text.length(), 0);
+        }
+
+        // see performUndo
         result = d_undoHandler->redo(d_caretPos);
-        WindowEventArgs args(this);
-        onTextChanged(args);
+        d_textChangePending = false;
+
+        if (result)
+            ensureCaretIsVisible();
     }
     return result;
 }
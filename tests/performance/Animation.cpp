@@ -0,0 +1,110 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Animation.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Window.h"
+
+/*!
+\brief
+    Steps a number of animation instances with many keyframes each via
+    AnimationManager::autoStepInstances.
+*/
+class AnimationPerformanceTest : public PerformanceTest
+{
+public:
+    AnimationPerformanceTest(CEGUI::String test_name, unsigned int keyframe_count,
+                             unsigned int instance_count, float step_delta) :
+        PerformanceTest(test_name),
+        d_stepDelta(step_delta)
+    {
+        CEGUI::AnimationManager& mgr = CEGUI::AnimationManager::getSingleton();
+
+        d_animation = mgr.createAnimation();
+        d_animation->setDuration(static_cast<float>(keyframe_count));
+        d_animation->setReplayMode(CEGUI::Animation::RM_Loop);
+
+        CEGUI::Affector* affector = d_animation->createAffector("Alpha", "float");
+        for (unsigned int i = 0; i <= keyframe_count; ++i)
+        {
+            affector->createKeyFrame(static_cast<float>(i),
+                CEGUI::PropertyHelper<float>::toString((i % 2) ? 1.0f : 0.0f));
+        }
+
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        for (unsigned int i = 0; i < instance_count; ++i)
+        {
+            CEGUI::AnimationInstance* instance = mgr.instantiateAnimation(d_animation);
+            instance->setTargetWindow(d_root->createChild("DefaultWindow"));
+            instance->start(false);
+        }
+    }
+
+    ~AnimationPerformanceTest()
+    {
+        // destroys all instances too
+        CEGUI::AnimationManager::getSingleton().destroyAnimation(d_animation);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    virtual void doTest()
+    {
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            CEGUI::AnimationManager::getSingleton().autoStepInstances(d_stepDelta);
+        }
+    }
+
+    CEGUI::Animation* d_animation;
+    CEGUI::Window* d_root;
+    float d_stepDelta;
+};
+
+BOOST_AUTO_TEST_SUITE(AnimationPerformance)
+
+BOOST_AUTO_TEST_CASE(ManyKeyFramesSmallSteps)
+{
+    AnimationPerformanceTest test(
+        "1000x autoStepInstances (200 instances, 500 keyframes, small steps)",
+        500, 200, 0.1f);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(ManyKeyFramesLargeSteps)
+{
+    AnimationPerformanceTest test(
+        "1000x autoStepInstances (200 instances, 500 keyframes, large steps)",
+        500, 200, 7.3f);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
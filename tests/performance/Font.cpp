@@ -0,0 +1,106 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Font.h"
+#include "CEGUI/FontManager.h"
+
+/*!
+\brief
+    Measures text extents of a string with the given characters many times,
+    reporting the throughput in characters per second as well.
+*/
+class FontPerformanceTest : public PerformanceTest
+{
+public:
+    FontPerformanceTest(CEGUI::String test_name, const CEGUI::String& characters) :
+        PerformanceTest(test_name),
+        d_font(CEGUI::FontManager::getSingleton().createFreeTypeFont(
+            "FontPerformanceTest", 12, true, "DejaVuSans.ttf")),
+        d_extent(0)
+    {
+        while (d_text.length() < 1000)
+            d_text += characters;
+
+        // rasterise everything up front; this measures the lookups only.
+        d_font.getTextExtent(d_text);
+    }
+
+    ~FontPerformanceTest()
+    {
+        CEGUI::FontManager::getSingleton().destroy(d_font);
+    }
+
+    virtual void doTest()
+    {
+        const unsigned int iterations = 10000;
+
+        boost::timer::cpu_timer timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+            d_extent += d_font.getTextExtent(d_text);
+
+        const double seconds = timer.elapsed().wall * 1e-9;
+        std::cout << "  " << (iterations * d_text.length() / seconds)
+                  << " characters per second" << std::endl;
+    }
+
+    CEGUI::Font& d_font;
+    CEGUI::String d_text;
+    float d_extent;
+};
+
+BOOST_AUTO_TEST_SUITE(FontPerformance)
+
+BOOST_AUTO_TEST_CASE(TextExtentLatin)
+{
+    FontPerformanceTest test("10000x Font::getTextExtent (1000 Latin characters)",
+        "The quick brown fox jumps over the lazy dog. 0123456789 ");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(TextExtentMixed)
+{
+    CEGUI::String characters("Latin, ");
+    // Greek and Cyrillic letters
+    for (CEGUI::utf32 cp = 0x3b1; cp < 0x3c9; ++cp)
+        characters += cp;
+    for (CEGUI::utf32 cp = 0x430; cp < 0x44f; ++cp)
+        characters += cp;
+
+    FontPerformanceTest test("10000x Font::getTextExtent (1000 mixed script characters)",
+        characters);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -28,9 +28,11 @@
 
 #include "PerformanceTest.h"
 
+#include "CEGUI/System.h"
 #include "CEGUI/views/StandardItemModel.h"
 #include "CEGUI/views/ListView.h"
 #include "CEGUI/Window.h"
+#include "CEGUI/widgets/Scrollbar.h"
 
 #include <iostream>
 
@@ -95,6 +97,90 @@ public:
     StandardItemModel d_model;
 };
 
+/*!
+\brief
+    Binds a list with a large number of items, then scrolls through it and
+    changes the data of some items, rendering after each step.
+*/
+class ListViewLargeModelPerformanceTest : public WindowPerformanceTest<ListView>
+{
+public:
+    ListViewLargeModelPerformanceTest(String windowType, String renderer,
+        bool virtualised)
+        : WindowPerformanceTest<ListView>(windowType, renderer)
+    {
+        d_testName += virtualised ? " (large model, virtualised)" : " (large model)";
+        d_window->setVirtualisedRenderingEnabled(virtualised);
+        d_window->setSize(USize(cegui_absdim(300), cegui_absdim(400)));
+    }
+
+    virtual void doTest()
+    {
+        for (size_t i = 0; i < ItemCount; ++i)
+        {
+            d_model.getRoot().addItem(
+                new StandardItem(PropertyHelper<uint>::toString(i)));
+        }
+
+        d_window->setModel(&d_model);
+        render();
+
+        Scrollbar* scrollbar = d_window->getVertScrollbar();
+        for (size_t step = 0; step < 50; ++step)
+        {
+            scrollbar->setScrollPosition(
+                scrollbar->getScrollPosition() + scrollbar->getPageSize());
+            render();
+        }
+
+        ModelIndex root_index = d_model.getRootIndex();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            d_model.updateItemText(static_cast<StandardItem*>(
+                d_model.makeIndex(i * 100, root_index).d_modelData), "changed");
+            render();
+        }
+    }
+
+    static const size_t ItemCount = 20000;
+    StandardItemModel d_model;
+};
+
+/*!
+\brief
+    Streams a large number of items into a live list, the way a log or chat
+    window is fed: every 60 Hz frame appends the items that arrived since the
+    previous frame, then renders.
+*/
+class ListViewStreamingPerformanceTest : public WindowPerformanceTest<ListView>
+{
+public:
+    ListViewStreamingPerformanceTest(String windowType, String renderer)
+        : WindowPerformanceTest<ListView>(windowType, renderer)
+    {
+        d_testName += " (streaming appends at 60 Hz)";
+        d_window->setSize(USize(cegui_absdim(300), cegui_absdim(400)));
+        d_window->setModel(&d_model);
+    }
+
+    virtual void doTest()
+    {
+        for (size_t i = 0; i < ItemCount; i += ItemsPerFrame)
+        {
+            for (size_t j = i; j < i + ItemsPerFrame; ++j)
+                d_model.addItem(PropertyHelper<uint>::toString(j));
+
+            System::getSingleton().injectTimePulse(1.0f / 60.0f);
+            render();
+        }
+    }
+
+    static const size_t ItemCount = 10000;
+    //! 600 items per second, delivered at 60 Hz.
+    static const size_t ItemsPerFrame = 10;
+    StandardItemModel d_model;
+};
+
 BOOST_AUTO_TEST_SUITE(ListViewPerformance)
 
 BOOST_AUTO_TEST_CASE(Test)
@@ -103,4 +189,25 @@ BOOST_AUTO_TEST_CASE(Test)
     listview_test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(LargeModel)
+{
+    ListViewLargeModelPerformanceTest listview_test(
+        "TaharezLook/ListView", "Core/ListView", false);
+    listview_test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(LargeModelVirtualised)
+{
+    ListViewLargeModelPerformanceTest listview_test(
+        "TaharezLook/ListView", "Core/ListView", true);
+    listview_test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(StreamingAppends)
+{
+    ListViewStreamingPerformanceTest listview_test(
+        "TaharezLook/ListView", "Core/ListView");
+    listview_test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
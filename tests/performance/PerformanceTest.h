@@ -29,6 +29,7 @@
 
 #include <boost/timer/timer.hpp>
 #include <fstream>
+#include <iostream>
 
 #include "CEGUI/WindowManager.h"
 
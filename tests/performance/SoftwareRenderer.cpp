@@ -0,0 +1,166 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderTarget.h"
+#include "CEGUI/Vertex.h"
+
+#include <vector>
+
+/*!
+\brief
+    Rasterises a frame resembling a typical GUI: a few translucent panels
+    covering most of the display, with a large number of small textured,
+    alpha blended quads (glyphs) on top of them.
+*/
+class SoftwareRendererPerformanceTest : public PerformanceTest
+{
+public:
+    SoftwareRendererPerformanceTest(CEGUI::String test_name,
+                                    const CEGUI::Sizef& display_size,
+                                    unsigned int glyph_count) :
+        PerformanceTest(test_name),
+        d_renderer(CEGUI::SoftwareRenderer::create(display_size))
+    {
+        // an 'atlas' with a soft alpha ramp, like anti-aliased glyphs.
+        std::vector<CEGUI::uint8> texels(64 * 64 * 4);
+        for (size_t i = 0; i < texels.size(); i += 4)
+        {
+            texels[i] = texels[i + 1] = texels[i + 2] = 255;
+            texels[i + 3] = static_cast<CEGUI::uint8>((i / 4) % 256);
+        }
+        d_texture = &d_renderer.createTexture("SoftwareRendererPerfTest");
+        d_texture->loadFromMemory(&texels[0], CEGUI::Sizef(64, 64),
+                                  CEGUI::Texture::PF_RGBA);
+
+        d_panels = &d_renderer.createGeometryBufferColoured(
+            d_renderer.createRenderMaterial(CEGUI::DS_SOLID));
+        d_panels->setClippingActive(false);
+        for (int i = 0; i < 4; ++i)
+        {
+            const float inset = i * 40.0f;
+            addPanel(CEGUI::Rectf(inset, inset,
+                                  display_size.d_width - inset,
+                                  display_size.d_height - inset),
+                     glm::vec4(0.2f, 0.3f, 0.4f, 0.75f));
+        }
+
+        d_glyphs = &d_renderer.createGeometryBufferTextured(
+            d_renderer.createRenderMaterial(CEGUI::DS_TEXTURED));
+        d_glyphs->setTexture("texture0", d_texture);
+        d_glyphs->setClippingRegion(CEGUI::Rectf(glm::vec2(0, 0), display_size));
+        d_glyphs->setClippingActive(true);
+
+        const unsigned int columns =
+            static_cast<unsigned int>(display_size.d_width / 9.0f);
+        for (unsigned int i = 0; i < glyph_count; ++i)
+        {
+            const float x = (i % columns) * 9.0f + 0.25f;
+            const float y = ((i / columns) * 15.0f) +
+                ((i / columns) % 2 ? 0.5f : 0.0f);
+            addGlyph(CEGUI::Rectf(x, y, x + 8.0f, y + 14.0f),
+                     CEGUI::Rectf((i % 8) * 0.125f, 0.0f,
+                                  (i % 8) * 0.125f + 0.125f, 0.25f));
+        }
+    }
+
+    ~SoftwareRendererPerformanceTest()
+    {
+        // also destroys the geometry buffers and textures
+        CEGUI::SoftwareRenderer::destroy(d_renderer);
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::RenderTarget& target = d_renderer.getDefaultRenderTarget();
+
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            d_renderer.getFrameBuffer().clear(0xFF000000);
+
+            target.activate();
+            target.draw(*d_panels);
+            target.draw(*d_glyphs);
+            target.deactivate();
+        }
+    }
+
+protected:
+    void addPanel(const CEGUI::Rectf& r, const glm::vec4& colour)
+    {
+        const CEGUI::ColouredVertex vbuffer[6] = {
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.bottom(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour)
+        };
+        d_panels->appendGeometry(vbuffer, 6);
+    }
+
+    void addGlyph(const CEGUI::Rectf& r, const CEGUI::Rectf& uv)
+    {
+        const glm::vec4 colour(1, 1, 1, 1);
+        const CEGUI::TexturedColouredVertex vbuffer[6] = {
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.top(), 0), colour, glm::vec2(uv.left(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.bottom(), 0), colour, glm::vec2(uv.left(), uv.bottom())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour, glm::vec2(uv.right(), uv.bottom())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.top(), 0), colour, glm::vec2(uv.right(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.top(), 0), colour, glm::vec2(uv.left(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour, glm::vec2(uv.right(), uv.bottom()))
+        };
+        d_glyphs->appendGeometry(vbuffer, 6);
+    }
+
+    CEGUI::SoftwareRenderer& d_renderer;
+    CEGUI::Texture* d_texture;
+    CEGUI::GeometryBuffer* d_panels;
+    CEGUI::GeometryBuffer* d_glyphs;
+};
+
+BOOST_AUTO_TEST_SUITE(SoftwareRendererPerformance)
+
+BOOST_AUTO_TEST_CASE(PanelsAndText720p)
+{
+    SoftwareRendererPerformanceTest test(
+        "100x SoftwareRenderer frame (1280x720, 4 panels, 5000 glyphs)",
+        CEGUI::Sizef(1280, 720), 5000);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
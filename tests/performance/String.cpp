@@ -0,0 +1,190 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/String.h"
+#include <map>
+#include <sstream>
+#include <vector>
+
+/*
+    These tests exercise the String operations the library relies on most, so
+    that the configurable string classes (see CEGUI_STRING_CLASS) can be
+    compared by building the performance tests once per configuration.
+*/
+
+static const char* const SHORT_TEXT = "AutoWindowName";
+static const char* const LONG_TEXT =
+    "The quick brown fox jumps over the lazy dog. "
+    "The quick brown fox jumps over the lazy dog.";
+
+class StringConstructionPerformanceTest : public PerformanceTest
+{
+public:
+    StringConstructionPerformanceTest(CEGUI::String test_name, const char* text)
+        : PerformanceTest(test_name), d_text(text)
+    {
+    }
+
+    virtual void doTest()
+    {
+        size_t total = 0;
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            const CEGUI::String str(d_text);
+            const CEGUI::String copy(str);
+            total += copy.length();
+        }
+
+        BOOST_CHECK(total != 0);
+    }
+
+    const char* d_text;
+};
+
+class StringConcatenationPerformanceTest : public PerformanceTest
+{
+public:
+    StringConcatenationPerformanceTest()
+        : PerformanceTest("1000000x String concatenation (window name paths)")
+    {
+    }
+
+    virtual void doTest()
+    {
+        const CEGUI::String parent("RootWindow");
+        const CEGUI::String child("FrameWindow");
+        const CEGUI::String leaf("__auto_titlebar__");
+
+        size_t total = 0;
+        for (unsigned int i = 0; i < 1000000; ++i)
+        {
+            const CEGUI::String path = parent + '/' + child + '/' + leaf;
+            total += path.length();
+        }
+
+        BOOST_CHECK(total != 0);
+    }
+};
+
+class StringMapLookupPerformanceTest : public PerformanceTest
+{
+public:
+    StringMapLookupPerformanceTest()
+        : PerformanceTest("1000000x String keyed map lookup (100 keys)")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            std::stringstream s;
+            s << "Property" << i;
+            d_map[s.str()] = i;
+            d_keys.push_back(s.str());
+        }
+    }
+
+    virtual void doTest()
+    {
+        unsigned int total = 0;
+        for (unsigned int i = 0; i < 1000000; ++i)
+            total += d_map.find(d_keys[i % d_keys.size()])->second;
+
+        BOOST_CHECK(total != 0);
+    }
+
+    typedef std::map<CEGUI::String, unsigned int,
+                     CEGUI::StringFastLessCompare> Map;
+    Map d_map;
+    std::vector<CEGUI::String> d_keys;
+};
+
+class StringIndexingPerformanceTest : public PerformanceTest
+{
+public:
+    StringIndexingPerformanceTest(CEGUI::String test_name, const CEGUI::String& text)
+        : PerformanceTest(test_name), d_text(text)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::utf32 total = 0;
+        for (unsigned int i = 0; i < 100000; ++i)
+            for (size_t c = 0; c < d_text.length(); ++c)
+                total += d_text[c];
+
+        BOOST_CHECK(total != 0);
+    }
+
+    const CEGUI::String d_text;
+};
+
+BOOST_AUTO_TEST_SUITE(StringPerformance)
+
+BOOST_AUTO_TEST_CASE(Footprint)
+{
+    std::cout << "sizeof(CEGUI::String): " << sizeof(CEGUI::String) << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(ShortConstruction)
+{
+    StringConstructionPerformanceTest test("1000000x String construction and copy (short)", SHORT_TEXT);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(LongConstruction)
+{
+    StringConstructionPerformanceTest test("1000000x String construction and copy (long)", LONG_TEXT);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(Concatenation)
+{
+    StringConcatenationPerformanceTest test;
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(MapLookup)
+{
+    StringMapLookupPerformanceTest test;
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(AsciiIndexing)
+{
+    StringIndexingPerformanceTest test("100000x sequential String indexing (ASCII)", LONG_TEXT);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(UnicodeIndexing)
+{
+    // "\xC3\xA9" and "\xE2\x82\xAC" make the text non-ASCII
+    StringIndexingPerformanceTest test("100000x sequential String indexing (non-ASCII)",
+        CEGUI::String(LONG_TEXT) + "\xC3\xA9\xE2\x82\xAC");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
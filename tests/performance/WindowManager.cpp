@@ -0,0 +1,92 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Window.h"
+
+static const unsigned int WindowCount = 50000;
+
+/*!
+\brief
+    Creates WindowCount windows in a tree below one root and destroys them
+    again by destroying the root.
+*/
+class WindowManagerPerformanceTest : public PerformanceTest
+{
+public:
+    WindowManagerPerformanceTest(CEGUI::String test_name, unsigned int children_per_window) :
+        PerformanceTest(test_name),
+        d_childrenPerWindow(children_per_window)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+
+        // windows are added breadth first, each receiving up to
+        // d_childrenPerWindow children.
+        std::vector<CEGUI::Window*> windows;
+        windows.reserve(WindowCount + 1);
+        windows.push_back(root);
+
+        for (unsigned int i = 0; i < WindowCount; ++i)
+        {
+            CEGUI::Window* parent = windows[i / d_childrenPerWindow];
+            windows.push_back(parent->createChild("DefaultWindow"));
+        }
+
+        for (size_t i = 0; i < windows.size(); ++i)
+            BOOST_REQUIRE(wmgr.isAlive(windows[i]));
+
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+    }
+
+    unsigned int d_childrenPerWindow;
+};
+
+BOOST_AUTO_TEST_SUITE(WindowManagerPerformance)
+
+BOOST_AUTO_TEST_CASE(CreateDestroyWideTree)
+{
+    WindowManagerPerformanceTest test(
+        "50000 windows in a tree of 100 children per window created and destroyed", 100);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(CreateDestroyTree)
+{
+    WindowManagerPerformanceTest test(
+        "50000 windows in a tree of 8 children per window created and destroyed", 8);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,173 @@
+/***********************************************************************
+ *    created:    Sat Oct 17 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/XMLCompiler.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+#include <cstring>
+#include <sstream>
+
+/*
+    These tests compare replaying compiled XML against parsing the same
+    document with the XMLParser module.  The handler does no work of its own,
+    so the times show only what the two sources cost to feed a handler.
+*/
+
+class CountingXMLHandler : public CEGUI::XMLHandler
+{
+public:
+    CountingXMLHandler() : d_count(0) {}
+
+    const CEGUI::String& getDefaultResourceGroup() const
+    {
+        static const CEGUI::String group;
+        return group;
+    }
+
+    void elementStart(const CEGUI::String&, const CEGUI::XMLAttributes& attributes)
+    {
+        d_count += 1 + attributes.getCount();
+    }
+
+    size_t d_count;
+};
+
+//! Returns a looknfeel-like document, with many repeated attribute lists.
+static std::string createSampleXML()
+{
+    std::ostringstream xml;
+    xml << "<?xml version=\"1.0\" ?><Falagard version=\"7\">";
+
+    for (int i = 0; i < 200; ++i)
+    {
+        xml << "<WidgetLook name=\"Sample/Widget" << i << "\">"
+               "<PropertyDefinition name=\"Colour\" initialValue=\"FFFFFFFF\" "
+               "redrawOnWrite=\"true\" type=\"ColourRect\" />";
+
+        for (int j = 0; j < 10; ++j)
+            xml << "<ImagerySection name=\"section" << j << "\"><FrameComponent>"
+                   "<Area><Dim type=\"LeftEdge\"><AbsoluteDim value=\"0\" /></Dim>"
+                   "<Dim type=\"TopEdge\"><AbsoluteDim value=\"0\" /></Dim>"
+                   "<Dim type=\"Width\"><UnifiedDim scale=\"1\" type=\"Width\" /></Dim>"
+                   "<Dim type=\"Height\"><UnifiedDim scale=\"1\" type=\"Height\" /></Dim>"
+                   "</Area><Image component=\"Background\" name=\"Sample/Background\" />"
+                   "</FrameComponent></ImagerySection>";
+
+        xml << "</WidgetLook>";
+    }
+
+    xml << "</Falagard>";
+    return xml.str();
+}
+
+static void setContainerData(CEGUI::RawDataContainer& container,
+                             const std::string& data)
+{
+    CEGUI::uint8* const buffer = new CEGUI::uint8[data.size()];
+    std::memcpy(buffer, data.data(), data.size());
+    container.setData(buffer);
+    container.setSize(data.size());
+}
+
+class XMLSourcePerformanceTest : public PerformanceTest
+{
+public:
+    XMLSourcePerformanceTest(CEGUI::String test_name, const std::string& data)
+        : PerformanceTest(test_name)
+    {
+        setContainerData(d_data, data);
+    }
+
+    virtual void doTest()
+    {
+        CountingXMLHandler handler;
+        for (unsigned int i = 0; i < 100; ++i)
+            parse(handler);
+
+        BOOST_CHECK(handler.d_count != 0);
+    }
+
+protected:
+    virtual void parse(CountingXMLHandler& handler) = 0;
+
+    CEGUI::RawDataContainer d_data;
+};
+
+class ParsedXMLPerformanceTest : public XMLSourcePerformanceTest
+{
+public:
+    ParsedXMLPerformanceTest(const std::string& xml)
+        : XMLSourcePerformanceTest("100x XML document parse", xml)
+    {
+    }
+
+protected:
+    void parse(CountingXMLHandler& handler)
+    {
+        CEGUI::System::getSingleton().getXMLParser()->parseXML(
+            handler, d_data, "", false);
+    }
+};
+
+class CompiledXMLPerformanceTest : public XMLSourcePerformanceTest
+{
+public:
+    CompiledXMLPerformanceTest(const std::string& compiled)
+        : XMLSourcePerformanceTest("100x compiled XML document replay", compiled)
+    {
+    }
+
+protected:
+    void parse(CountingXMLHandler& handler)
+    {
+        CEGUI::XMLCompiler::parseCompiled(handler, d_data);
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(XMLCompilerPerformance)
+
+BOOST_AUTO_TEST_CASE(ParseXML)
+{
+    ParsedXMLPerformanceTest test(createSampleXML());
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(ParseCompiledXML)
+{
+    std::ostringstream compiled(std::ios::out | std::ios::binary);
+    CEGUI::XMLCompiler::compileString(createSampleXML(), compiled);
+
+    CompiledXMLPerformanceTest test(compiled.str());
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,9 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/TypedProperty.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -60,6 +63,34 @@ struct SampleAnimationSetupFixture
     CEGUI::Animation* d_zeroDuration;
 };
 
+//! float property that keeps its value itself, so instances can be replaced
+class StoredFloatProperty : public CEGUI::TypedProperty<float>
+{
+public:
+    StoredFloatProperty() :
+        CEGUI::TypedProperty<float>("StoredFloat", "", "Test"),
+        d_value(0.0f)
+    {}
+
+    CEGUI::Property* clone() const
+    {
+        return new StoredFloatProperty(*this);
+    }
+
+    float d_value;
+
+protected:
+    void setNative_impl(CEGUI::PropertyReceiver*, Helper::pass_type value)
+    {
+        d_value = value;
+    }
+
+    Helper::safe_method_return_type getNative_impl(const CEGUI::PropertyReceiver*) const
+    {
+        return d_value;
+    }
+};
+
 BOOST_FIXTURE_TEST_SUITE(AnimationSystem, SampleAnimationSetupFixture)
 
 BOOST_AUTO_TEST_CASE(SkipFirstStep)
@@ -179,4 +210,136 @@ BOOST_AUTO_TEST_CASE(ZeroDurationReplayModes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(ApplyToTargetProperties)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    window->setPosition(CEGUI::UVector2(CEGUI::UDim(0.0f, 10.0f), CEGUI::UDim(0.0f, 20.0f)));
+
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("ApplyToTargetProperties");
+    animation->setDuration(1.0f);
+    animation->setReplayMode(CEGUI::Animation::RM_Once);
+    {
+        CEGUI::Affector* affector = animation->createAffector("Alpha", "float");
+        affector->createKeyFrame(0.0f, "0");
+        affector->createKeyFrame(1.0f, "1");
+    }
+    {
+        CEGUI::Affector* affector = animation->createAffector("Position", "UVector2");
+        affector->setApplicationMethod(CEGUI::Affector::AM_Relative);
+        affector->createKeyFrame(0.0f, "{{0,0},{0,0}}");
+        affector->createKeyFrame(1.0f, "{{0,100},{0,50}}");
+    }
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getPosition().d_x.d_offset, 60.0f, 0.0001f);
+    BOOST_CHECK_CLOSE(window->getPosition().d_y.d_offset, 45.0f, 0.0001f);
+
+    // changing the interpolator of a running animation has to be picked up,
+    // int can't be set natively on a float property, the String path is used
+    animation->getAffectorAtIdx(0)->setInterpolator("int");
+    instance->step(0.25f);
+    BOOST_CHECK_SMALL(window->getAlpha(), 0.0001f);
+    BOOST_CHECK_CLOSE(window->getPosition().d_x.d_offset, 85.0f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(ReplacedTargetPropertyIsPickedUp)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    StoredFloatProperty first;
+    StoredFloatProperty second;
+    window->addProperty(&first);
+
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("ReplacedTargetProperty");
+    animation->setDuration(1.0f);
+    animation->setReplayMode(CEGUI::Animation::RM_Once);
+    CEGUI::Affector* affector = animation->createAffector("StoredFloat", "float");
+    affector->createKeyFrame(0.0f, "0");
+    affector->createKeyFrame(1.0f, "1");
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(first.d_value, 0.5f, 0.0001f);
+
+    // e.g.: what a LookNFeel change does to the properties it defines
+    window->removeProperty("StoredFloat");
+    window->addProperty(&second);
+
+    instance->step(0.25f);
+    BOOST_CHECK_CLOSE(first.d_value, 0.5f, 0.0001f);
+    BOOST_CHECK_CLOSE(second.d_value, 0.75f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(KeyFrameLookup)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+
+    CEGUI::Animation* animation = CEGUI::AnimationManager::getSingleton().createAnimation("KeyFrameLookup");
+    animation->setDuration(10.0f);
+    animation->setReplayMode(CEGUI::Animation::RM_Once);
+
+    CEGUI::Affector* affector = animation->createAffector("Alpha", "float");
+    // created out of order on purpose
+    for (int i = 10; i >= 0; i -= 2)
+        affector->createKeyFrame(static_cast<float>(i), (i % 4) ? "1" : "0");
+    for (int i = 1; i < 10; i += 2)
+        affector->createKeyFrame(static_cast<float>(i), "0.5");
+
+    BOOST_REQUIRE_EQUAL(affector->getNumKeyFrames(), 11u);
+    for (size_t i = 0; i < affector->getNumKeyFrames(); ++i)
+        BOOST_CHECK_EQUAL(affector->getKeyFrameAtIdx(i)->getPosition(), static_cast<float>(i));
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(animation);
+    instance->setTargetWindow(window);
+    instance->start(false);
+
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+    instance->step(1.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.75f, 0.0001f);
+    instance->step(1.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.75f, 0.0001f);
+    // exactly on a keyframe
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    // seeking back and forth
+    instance->setPosition(8.5f);
+    instance->apply();
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+    instance->setPosition(0.0f);
+    instance->apply();
+    BOOST_CHECK_SMALL(window->getAlpha(), 0.0001f);
+    instance->setPosition(10.0f);
+    instance->apply();
+    BOOST_CHECK_CLOSE(window->getAlpha(), 1.0f, 0.0001f);
+
+    // moving a keyframe keeps the keyframes sorted
+    affector->moveKeyFrameToPosition(10.0f, 0.5f);
+    BOOST_CHECK_EQUAL(affector->getKeyFrameAtIdx(1)->getPosition(), 0.5f);
+    BOOST_CHECK_EQUAL(affector->getKeyFrameAtIdx(10)->getPosition(), 9.0f);
+    instance->setPosition(0.5f);
+    instance->apply();
+    BOOST_CHECK_CLOSE(window->getAlpha(), 1.0f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(animation);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/AsyncSchemeLoader.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/SchemeManager.h"
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(AsyncSchemeLoaderTestSuite)
+
+//----------------------------------------------------------------------------//
+static void runUntilIdle(AsyncSchemeLoader& loader)
+{
+    while (!loader.update())
+        ;
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LoadScheme_CreatesScheme)
+{
+    AsyncSchemeLoader loader(2);
+    BOOST_REQUIRE_EQUAL(2u, loader.getWorkerCount());
+
+    const AsyncSchemeLoader::Request& request =
+        loader.loadScheme("WindowsLook.scheme");
+    runUntilIdle(loader);
+
+    BOOST_REQUIRE(loader.isIdle());
+    BOOST_REQUIRE(request.isComplete());
+    BOOST_REQUIRE(!request.hasFailed());
+    BOOST_REQUIRE(request.getScheme() != 0);
+    BOOST_REQUIRE_EQUAL(1.0f, request.getProgress());
+    BOOST_REQUIRE(SchemeManager::getSingleton().isDefined(
+        request.getScheme()->getName()));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LoadScheme_MissingFile_Fails)
+{
+    AsyncSchemeLoader loader(1);
+
+    const AsyncSchemeLoader::Request& request =
+        loader.loadScheme("NoSuchFile.scheme");
+    runUntilIdle(loader);
+
+    BOOST_REQUIRE(request.isComplete());
+    BOOST_REQUIRE(request.hasFailed());
+    BOOST_REQUIRE(!request.getErrorMessage().empty());
+    BOOST_REQUIRE(request.getScheme() == 0);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TakePreloaded_NothingPrepared_ReturnsFalse)
+{
+    AsyncSchemeLoader loader(1);
+    RawDataContainer data;
+
+    BOOST_REQUIRE(!loader.takePreloadedXML("NoSuchFile.xml", "", data));
+    BOOST_REQUIRE(!loader.takePreloadedFile("NoSuchFile.ttf", "", data));
+    BOOST_REQUIRE(loader.createPreloadedTexture(
+        "NoSuchTexture", "NoSuchFile.png", "") == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+/***********************************************************************
+ *    created:    16/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct BitmapImageFixture
+{
+    BitmapImageFixture() :
+        d_renderer(*CEGUI::System::getSingleton().getRenderer()),
+        d_texture1(d_renderer.createTexture("BitmapImageTest1", CEGUI::Sizef(64, 64))),
+        d_texture2(d_renderer.createTexture("BitmapImageTest2", CEGUI::Sizef(64, 64))),
+        d_bitmapImage1("BitmapImageTest1", &d_texture1, CEGUI::Rectf(0, 0, 16, 16),
+                       glm::vec2(0, 0), CEGUI::ASM_Disabled, CEGUI::Sizef(640, 480)),
+        d_bitmapImage2("BitmapImageTest2", &d_texture2, CEGUI::Rectf(0, 0, 16, 16),
+                       glm::vec2(0, 0), CEGUI::ASM_Disabled, CEGUI::Sizef(640, 480)),
+        d_image1(d_bitmapImage1),
+        d_image2(d_bitmapImage2)
+    {
+    }
+
+    ~BitmapImageFixture()
+    {
+        for (size_t i = 0; i < d_buffers.size(); ++i)
+            d_renderer.destroyGeometryBuffer(*d_buffers[i]);
+
+        d_renderer.destroyTexture(d_texture1);
+        d_renderer.destroyTexture(d_texture2);
+    }
+
+    CEGUI::Renderer& d_renderer;
+    CEGUI::Texture& d_texture1;
+    CEGUI::Texture& d_texture2;
+    CEGUI::BitmapImage d_bitmapImage1;
+    CEGUI::BitmapImage d_bitmapImage2;
+    // the convenience render overloads are only visible through Image
+    const CEGUI::Image& d_image1;
+    const CEGUI::Image& d_image2;
+    std::vector<CEGUI::GeometryBuffer*> d_buffers;
+};
+
+BOOST_FIXTURE_TEST_SUITE(BitmapImage, BitmapImageFixture)
+
+BOOST_AUTO_TEST_CASE(QuadsWithSameStateShareBuffer)
+{
+    const CEGUI::Rectf clip(0, 0, 200, 200);
+
+    for (int i = 0; i < 10; ++i)
+        d_image1.render(d_buffers, glm::vec2(i * 16.0f, 0), &clip, true);
+
+    BOOST_REQUIRE_EQUAL(d_buffers.size(), 1u);
+    BOOST_CHECK_EQUAL(d_buffers[0]->getVertexCount(), 60u);
+}
+
+BOOST_AUTO_TEST_CASE(StateChangeStartsNewBuffer)
+{
+    const CEGUI::Rectf clip1(0, 0, 200, 200);
+    const CEGUI::Rectf clip2(0, 0, 100, 100);
+
+    d_image1.render(d_buffers, glm::vec2(0, 0), &clip1, true);
+    // different texture
+    d_image2.render(d_buffers, glm::vec2(16, 0), &clip1, true);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 2u);
+
+    // different clipping region
+    d_image2.render(d_buffers, glm::vec2(32, 0), &clip2, true);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 3u);
+
+    // clipping disabled
+    d_image2.render(d_buffers, glm::vec2(48, 0), &clip2, false);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 4u);
+
+    // different alpha
+    d_image2.render(d_buffers, CEGUI::Rectf(64, 0, 80, 16), &clip2, false,
+                    CEGUI::ColourRect(0xFFFFFFFF), 0.5f);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 5u);
+
+    // same state as the previous quad again
+    d_image2.render(d_buffers, CEGUI::Rectf(80, 0, 96, 16), &clip2, false,
+                    CEGUI::ColourRect(0xFFFFFFFF), 0.5f);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 5u);
+
+    // returning to an earlier state must not reorder geometry
+    d_image1.render(d_buffers, glm::vec2(0, 16), &clip1, true);
+    BOOST_CHECK_EQUAL(d_buffers.size(), 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -117,7 +117,7 @@ BOOST_AUTO_TEST_CASE(NativeClipboardProvider)
     BOOST_CHECK_EQUAL(g_ClipboardSize, 15); // it only contains characters from ASCII 7bit
     BOOST_CHECK(memcmp(g_ClipboardBuffer, CEGUI::String(asciiTest).c_str(), g_ClipboardSize) == 0);
 
-#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UNICODE
+#if CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_STD
     // Unicode string set, get
     const CEGUI::utf8* utf8Test = (const CEGUI::utf8*)"(・。・;)";
     cb.setText(utf8Test);
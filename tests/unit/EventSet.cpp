@@ -133,4 +133,47 @@ BOOST_AUTO_TEST_CASE(Subscribing)
         connection->disconnect();
     }
 }
+BOOST_AUTO_TEST_CASE(GlobalEvents)
+{
+    CEGUI::EventSet set;
+    CEGUI::GlobalEventSet& globalSet = CEGUI::GlobalEventSet::getSingleton();
+
+    const CEGUI::String eventName("GlobalTestEvent");
+    const CEGUI::String eventNamespace("GlobalTestNamespace");
+
+    g_GlobalEventValue = 0;
+    TestEventArgs args;
+    args.d_targetValue = 1;
+    set.fireEvent(eventName, args, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 0);
+
+    {
+        CEGUI::Event::ScopedConnection conn = globalSet.subscribeEvent(eventNamespace + "/" + eventName, &freeFunctionSubscriber);
+
+        set.fireEvent(eventName, args, eventNamespace);
+        BOOST_CHECK_EQUAL(g_GlobalEventValue, 1);
+
+        // same name in a different namespace must not be delivered
+        TestEventArgs args2;
+        args2.d_targetValue = 2;
+        set.fireEvent(eventName, args2, "OtherNamespace");
+        BOOST_CHECK_EQUAL(g_GlobalEventValue, 1);
+    }
+
+    globalSet.removeEvent(eventNamespace + "/" + eventName);
+    TestEventArgs args3;
+    args3.d_targetValue = 3;
+    set.fireEvent(eventName, args3, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 1);
+
+    // muted sets don't call their own subscribers
+    CEGUI::Event::ScopedConnection conn = set.subscribeEvent(eventName, &freeFunctionSubscriber);
+    set.setMutedState(true);
+    set.fireEvent(eventName, args3, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 1);
+    set.setMutedState(false);
+    set.fireEvent(eventName, args3, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,152 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Config.h"
+
+#ifdef CEGUI_HAS_FREETYPE
+
+#include "CEGUI/FreeTypeFont.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/FontGlyph.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct FreeTypeFontFixture
+{
+    FreeTypeFontFixture() :
+        d_font(static_cast<CEGUI::FreeTypeFont&>(
+            CEGUI::FontManager::getSingleton().createFreeTypeFont(
+                "FreeTypeFontTest", 48, true, "DejaVuSans.ttf")))
+    {
+    }
+
+    ~FreeTypeFontFixture()
+    {
+        CEGUI::FontManager::getSingleton().destroy(d_font);
+    }
+
+    const CEGUI::Image* glyphImage(CEGUI::utf32 codepoint) const
+    {
+        const CEGUI::FontGlyph* glyph = d_font.getGlyphData(codepoint);
+        BOOST_REQUIRE(glyph);
+        return glyph->getImage();
+    }
+
+    //! rasterise the next glyph the font has, starting at \a codepoint.
+    CEGUI::utf32 rasteriseNextGlyph(CEGUI::utf32 codepoint) const
+    {
+        while (!d_font.getGlyphData(codepoint))
+            ++codepoint;
+
+        return codepoint;
+    }
+
+    CEGUI::FreeTypeFont& d_font;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FreeTypeFont, FreeTypeFontFixture)
+
+BOOST_AUTO_TEST_CASE(GlyphsArePackedWithoutOverlap)
+{
+    BOOST_CHECK_EQUAL(d_font.getGlyphPageCount(), 0u);
+
+    const CEGUI::String text("The quick brown fox jumps over the lazy dog");
+    d_font.prewarmGlyphs(text);
+    BOOST_CHECK_EQUAL(d_font.getGlyphPageCount(), 1u);
+
+    const float page_size = static_cast<float>(d_font.getGlyphPageSize());
+    for (size_t i = 0; i < text.length(); ++i)
+    {
+        const CEGUI::Rectf a(glyphImage(text[i])->getImageArea());
+        BOOST_CHECK(a.left() >= 0 && a.top() >= 0 &&
+                    a.right() <= page_size && a.bottom() <= page_size);
+
+        for (size_t j = 0; j < text.length(); ++j)
+        {
+            if (text[i] == text[j])
+                continue;
+
+            const CEGUI::Rectf b(glyphImage(text[j])->getImageArea());
+            if (a.getWidth() && b.getWidth())
+                BOOST_CHECK(a.getIntersection(b).getWidth() == 0 ||
+                            a.getIntersection(b).getHeight() == 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OnlyUsedGlyphsAreRasterised)
+{
+    // looking up one glyph does not rasterise the rest of its 256 glyph block
+    glyphImage('A');
+    const CEGUI::Rectf area(glyphImage('A')->getImageArea());
+    d_font.prewarmGlyphs('B', 'B');
+
+    BOOST_CHECK(glyphImage('B')->getImageArea() != area);
+    BOOST_CHECK_EQUAL(d_font.getGlyphPageCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(LeastRecentlyUsedPageIsEvicted)
+{
+    d_font.setMaxGlyphPageCount(2);
+
+    // rasterise glyphs until a second page is required
+    CEGUI::utf32 codepoint = rasteriseNextGlyph('A');
+    while (d_font.getGlyphPageCount() < 2)
+        codepoint = rasteriseNextGlyph(codepoint + 1);
+
+    const CEGUI::Texture* first_page =
+        static_cast<const CEGUI::BitmapImage*>(glyphImage('A'))->getTexture();
+    const CEGUI::Texture* second_page =
+        static_cast<const CEGUI::BitmapImage*>(glyphImage(codepoint))->getTexture();
+    BOOST_REQUIRE(first_page != second_page);
+
+    // keep using the first page while filling the second one and beyond;
+    // pages are never evicted during a frame, so the font goes over the limit.
+    for (int i = 0; i < 1000; ++i)
+    {
+        glyphImage('A');
+        codepoint = rasteriseNextGlyph(codepoint + 1);
+    }
+
+    BOOST_REQUIRE(d_font.getGlyphPageCount() > 2u);
+
+    // all pages were used during the frame that just ended, so none go yet.
+    const CEGUI::uint filled_page_count = d_font.getGlyphPageCount();
+    d_font.notifyFrameStarted();
+    BOOST_CHECK_EQUAL(d_font.getGlyphPageCount(), filled_page_count);
+
+    // the next frame only uses 'A', so the other pages are released.
+    glyphImage('A');
+    d_font.notifyFrameStarted();
+
+    BOOST_CHECK_EQUAL(d_font.getGlyphPageCount(), 2u);
+    BOOST_CHECK_EQUAL(
+        static_cast<const CEGUI::BitmapImage*>(glyphImage('A'))->getTexture(),
+        first_page);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
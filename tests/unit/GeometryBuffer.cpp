@@ -0,0 +1,153 @@
+/***********************************************************************
+ *    created:    16/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+struct GeometryBufferFixture
+{
+    GeometryBufferFixture() :
+        d_renderer(*CEGUI::System::getSingleton().getRenderer())
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            d_quad[i].d_colour = glm::vec4(1.0f, 0.5f, 0.0f, 1.0f);
+            d_quad[i].d_texCoords = glm::vec2(i < 2 ? 0.0f : 1.0f, 0.5f);
+        }
+    }
+
+    ~GeometryBufferFixture()
+    {
+        d_renderer.setCompactGeometryEnabled(false);
+        d_renderer.setPackedTexCoordsEnabled(false);
+
+        for (size_t i = 0; i < d_buffers.size(); ++i)
+            d_renderer.destroyGeometryBuffer(*d_buffers[i]);
+    }
+
+    CEGUI::GeometryBuffer& createBuffer(bool textured)
+    {
+        d_buffers.push_back(textured ?
+            &d_renderer.createGeometryBufferTextured() :
+            &d_renderer.createGeometryBufferColoured());
+
+        return *d_buffers.back();
+    }
+
+    CEGUI::Renderer& d_renderer;
+    CEGUI::TexturedColouredVertex d_quad[4];
+    std::vector<CEGUI::GeometryBuffer*> d_buffers;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GeometryBuffer, GeometryBufferFixture)
+
+BOOST_AUTO_TEST_CASE(AppendQuads_DefaultFormat)
+{
+    CEGUI::GeometryBuffer& buffer = createBuffer(true);
+
+    buffer.appendQuads(d_quad, 1);
+
+    BOOST_CHECK(!buffer.isIndexedGeometryActive());
+    BOOST_CHECK_EQUAL(buffer.getVertexAttributeElementCount(), 9);
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 6u);
+    BOOST_CHECK_EQUAL(buffer.getDrawCount(), 6u);
+    BOOST_CHECK_EQUAL(buffer.getVertexData().size(), 54u);
+    BOOST_CHECK(buffer.getIndexData().empty());
+
+    // the fifth vertex repeats the top-left corner
+    BOOST_CHECK_EQUAL(buffer.getVertexData()[4 * 9 + 7], 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(AppendQuads_CompactFormat)
+{
+    d_renderer.setCompactGeometryEnabled(true);
+    CEGUI::GeometryBuffer& buffer = createBuffer(true);
+
+    buffer.appendQuads(d_quad, 2);
+    buffer.appendVertex(d_quad[0]);
+
+    BOOST_REQUIRE(buffer.isIndexedGeometryActive());
+    BOOST_CHECK_EQUAL(buffer.getVertexAttributeElementCount(), 6);
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 9u);
+    BOOST_CHECK_EQUAL(buffer.getDrawCount(), 13u);
+
+    static const CEGUI::uint32 expected[13] =
+        { 0, 1, 2, 3, 0, 2, 4, 5, 6, 7, 4, 6, 8 };
+    const std::vector<CEGUI::uint32>& indices = buffer.getIndexData();
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices.begin(), indices.end(),
+                                  expected, expected + 13);
+
+    // colour is stored as RGBA bytes after the position
+    CEGUI::uint8 colour[4];
+    std::memcpy(colour, &buffer.getVertexData()[3], sizeof(colour));
+    BOOST_CHECK_EQUAL(colour[0], 255);
+    BOOST_CHECK_EQUAL(colour[1], 128);
+    BOOST_CHECK_EQUAL(colour[2], 0);
+    BOOST_CHECK_EQUAL(colour[3], 255);
+
+    buffer.reset();
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 0u);
+    BOOST_CHECK(buffer.getIndexData().empty());
+}
+
+BOOST_AUTO_TEST_CASE(AppendQuads_PackedTexCoords)
+{
+    d_renderer.setCompactGeometryEnabled(true);
+    d_renderer.setPackedTexCoordsEnabled(true);
+    CEGUI::GeometryBuffer& buffer = createBuffer(true);
+
+    buffer.appendQuads(d_quad, 1);
+
+    BOOST_CHECK_EQUAL(buffer.getVertexAttributeElementCount(), 5);
+    BOOST_CHECK_EQUAL(buffer.getVertexData().size(), 20u);
+
+    // texture coordinates of the bottom-right corner
+    CEGUI::uint16 tex_coords[2];
+    std::memcpy(tex_coords, &buffer.getVertexData()[2 * 5 + 4], sizeof(tex_coords));
+    BOOST_CHECK_EQUAL(tex_coords[0], 65535);
+    BOOST_CHECK_EQUAL(tex_coords[1], 32768);
+}
+
+BOOST_AUTO_TEST_CASE(BeginAppendGeometry_WritesInPlace)
+{
+    CEGUI::GeometryBuffer& buffer = createBuffer(false);
+
+    float* dest = buffer.beginAppendGeometry(3);
+    for (int i = 0; i < 3 * 7; ++i)
+        dest[i] = static_cast<float>(i);
+    buffer.endAppendGeometry();
+
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 3u);
+    BOOST_CHECK_EQUAL(buffer.getVertexData()[20], 20.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
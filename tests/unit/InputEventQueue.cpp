@@ -0,0 +1,171 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/InputEventQueue.h"
+#include "CEGUI/Threading.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace CEGUI;
+
+// Receiver recording the input passed to it as a readable string per call.
+class RecordingInputReceiver : public InjectedInputReceiver
+{
+public:
+    std::vector<std::string> d_calls;
+
+    bool injectMouseMove(float delta_x, float delta_y)
+    { return record("move", delta_x, delta_y); }
+    bool injectMouseLeaves() { return record("leaves"); }
+    bool injectMouseButtonDown(MouseButton button)
+    { return record("down", static_cast<float>(button)); }
+    bool injectMouseButtonUp(MouseButton button)
+    { return record("up", static_cast<float>(button)); }
+    bool injectKeyDown(Key::Scan scan_code)
+    { return record("keydown", static_cast<float>(scan_code)); }
+    bool injectKeyUp(Key::Scan scan_code)
+    { return record("keyup", static_cast<float>(scan_code)); }
+    bool injectChar(String::value_type code_point)
+    { return record("char", static_cast<float>(code_point)); }
+    bool injectMouseWheelChange(float delta) { return record("wheel", delta); }
+    bool injectMousePosition(float x_pos, float y_pos)
+    { return record("position", x_pos, y_pos); }
+    bool injectMouseButtonClick(const MouseButton button)
+    { return record("click", static_cast<float>(button)); }
+    bool injectMouseButtonDoubleClick(const MouseButton button)
+    { return record("doubleclick", static_cast<float>(button)); }
+    bool injectMouseButtonTripleClick(const MouseButton button)
+    { return record("tripleclick", static_cast<float>(button)); }
+    bool injectCopyRequest() { return record("copy"); }
+    bool injectCutRequest() { return record("cut"); }
+    bool injectPasteRequest() { return record("paste"); }
+
+private:
+    bool record(const char* name, float a = 0.0f, float b = 0.0f)
+    {
+        char buff[64];
+        sprintf(buff, "%s %g %g", name, a, b);
+        d_calls.push_back(buff);
+        return true;
+    }
+};
+
+struct InputEventQueueFixture
+{
+    InputEventQueueFixture() :
+        queue(&receiver)
+    {}
+
+    RecordingInputReceiver receiver;
+    InputEventQueue queue;
+};
+
+static void injectMoves(void* queue)
+{
+    for (int i = 0; i < 1000; ++i)
+        static_cast<InputEventQueue*>(queue)->injectMouseMove(1.0f, 2.0f);
+}
+
+BOOST_FIXTURE_TEST_SUITE(InputEventQueueTestSuite, InputEventQueueFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Dispatch_PassesInputInOrder)
+{
+    queue.injectKeyDown(Key::A);
+    queue.injectChar('a');
+    queue.injectKeyUp(Key::A);
+    queue.injectMouseButtonDown(LeftButton);
+    queue.injectMouseButtonUp(LeftButton);
+
+    BOOST_CHECK(receiver.d_calls.empty());
+    BOOST_CHECK_EQUAL(queue.getQueuedInputCount(), 5u);
+
+    BOOST_CHECK(queue.dispatch());
+    BOOST_REQUIRE_EQUAL(receiver.d_calls.size(), 5u);
+    BOOST_CHECK_EQUAL(receiver.d_calls[0], "keydown 30 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[1], "char 97 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[2], "keyup 30 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[3], "down 0 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[4], "up 0 0");
+
+    BOOST_CHECK_EQUAL(queue.getQueuedInputCount(), 0u);
+    BOOST_CHECK(!queue.dispatch());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Dispatch_CoalescesConsecutiveMouseInput)
+{
+    queue.injectMouseMove(1.0f, 2.0f);
+    queue.injectMouseMove(3.0f, 4.0f);
+    queue.injectMouseWheelChange(1.0f);
+    queue.injectMouseWheelChange(2.0f);
+    queue.injectMousePosition(10.0f, 20.0f);
+    queue.injectMousePosition(30.0f, 40.0f);
+    queue.injectMouseButtonDown(LeftButton);
+    queue.injectMouseMove(5.0f, 6.0f);
+    queue.injectMousePosition(50.0f, 60.0f);
+
+    queue.dispatch();
+    BOOST_REQUIRE_EQUAL(receiver.d_calls.size(), 5u);
+    BOOST_CHECK_EQUAL(receiver.d_calls[0], "move 4 6");
+    BOOST_CHECK_EQUAL(receiver.d_calls[1], "wheel 3 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[2], "position 30 40");
+    BOOST_CHECK_EQUAL(receiver.d_calls[3], "down 0 0");
+    BOOST_CHECK_EQUAL(receiver.d_calls[4], "position 50 60");
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Dispatch_WithoutCoalescingKeepsEveryInput)
+{
+    queue.setCoalescingEnabled(false);
+    queue.injectMousePosition(10.0f, 20.0f);
+    queue.injectMousePosition(30.0f, 40.0f);
+
+    queue.dispatch();
+    BOOST_REQUIRE_EQUAL(receiver.d_calls.size(), 2u);
+    BOOST_CHECK_EQUAL(receiver.d_calls[0], "position 10 20");
+    BOOST_CHECK_EQUAL(receiver.d_calls[1], "position 30 40");
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Inject_FromSeveralThreads)
+{
+    {
+        Thread first(&injectMoves, &queue);
+        Thread second(&injectMoves, &queue);
+    }
+
+    queue.dispatch();
+    BOOST_REQUIRE_EQUAL(receiver.d_calls.size(), 1u);
+    BOOST_CHECK_EQUAL(receiver.d_calls[0], "move 2000 4000");
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "CEGUI/views/ListView.h"
+#include "CEGUI/views/StandardItemModel.h"
 #include "CEGUI/WindowManager.h"
 #include "ItemModelStub.h"
 
@@ -174,6 +175,89 @@ BOOST_AUTO_TEST_CASE(SetItemSelectionState_MultiSelectToggled_ModifiesSelectionA
             view->getIndexSelectionStates().at(0).d_selectedIndex.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelectAll_MultiSelectEnabled_SelectsEveryChild)
+{
+    for (int i = 0; i < 100; ++i)
+        model.d_items.push_back("item");
+    view->setModel(&model);
+    view->setMultiSelectEnabled(true);
+
+    view->setIndexSelectionState(model.makeIndex(3, model.getRootIndex()), true);
+    view->selectAll();
+
+    BOOST_REQUIRE_EQUAL(100, view->getIndexSelectionStates().size());
+    for (size_t i = 0; i < model.d_items.size(); ++i)
+        BOOST_CHECK(view->isIndexSelected(model.makeIndex(i, model.getRootIndex())));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelectAll_MultiSelectDisabled_KeepsSelection)
+{
+    model.d_items.push_back("item1");
+    model.d_items.push_back("item2");
+    view->setModel(&model);
+
+    view->setSelectedIndex(model.makeIndex(1, model.getRootIndex()));
+    view->selectAll();
+
+    BOOST_REQUIRE_EQUAL(1, view->getIndexSelectionStates().size());
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(0, model.getRootIndex())));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SetIndexSelectionState_Deselect_UpdatesIsIndexSelected)
+{
+    model.d_items.push_back("item1");
+    model.d_items.push_back("item2");
+    view->setModel(&model);
+    view->setMultiSelectEnabled(true);
+    view->selectAll();
+
+    view->setIndexSelectionState(model.makeIndex(0, model.getRootIndex()), false);
+
+    BOOST_REQUIRE_EQUAL(1, view->getIndexSelectionStates().size());
+    BOOST_CHECK(!view->isIndexSelected(model.makeIndex(0, model.getRootIndex())));
+    BOOST_CHECK(view->isIndexSelected(model.makeIndex(1, model.getRootIndex())));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChildrenDataChanged_RenamedSelectedItem_StaysSelected)
+{
+    StandardItemModel items;
+    items.addItem("item1");
+    items.addItem("item2");
+    view->setModel(&items);
+    ModelIndex index = items.makeIndex(0, items.getRootIndex());
+    view->setSelectedIndex(index);
+
+    items.getItemForIndex(index)->setText("renamed");
+    items.notifyChildrenDataChanged(items.getRootIndex(), 0, 1);
+
+    BOOST_CHECK(view->isIndexSelected(index));
+    view->setIndexSelectionState(index, false);
+    BOOST_CHECK(!view->isIndexSelected(index));
+    BOOST_CHECK_EQUAL(0, view->getIndexSelectionStates().size());
+
+    view->setModel(&model);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SetSelectedIndex_ItemsWithEqualText_SelectsOnlyOne)
+{
+    StandardItemModel items;
+    items.addItem("item");
+    items.addItem("item");
+    view->setModel(&items);
+
+    view->setSelectedIndex(items.makeIndex(1, items.getRootIndex()));
+
+    BOOST_CHECK(!view->isIndexSelected(items.makeIndex(0, items.getRootIndex())));
+    BOOST_CHECK(view->isIndexSelected(items.makeIndex(1, items.getRootIndex())));
+
+    view->setModel(&model);
+}
+
 //----------------------------------------------------------------------------//
 BOOST_AUTO_TEST_CASE(EnsureItemIsVisible_ScrollsHorizontallyAndVertically)
 {
@@ -239,6 +239,42 @@ BOOST_AUTO_TEST_CASE(ItemNameChanged_UpdatesRenderedString)
     BOOST_REQUIRE_EQUAL(6, view->getItems().at(0)->d_string.getLineCount());
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemNameChanged_OnlyUpdatesChangedRange)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM2);
+    view->prepareForRender();
+
+    model.d_items.at(0) = ITEM_WITH_6LINES;
+    model.notifyChildrenDataWillChange(model.getRootIndex(), 1, 1);
+    model.d_items.at(1) = ITEM_WITH_6LINES;
+    model.notifyChildrenDataChanged(model.getRootIndex(), 1, 1);
+
+    view->prepareForRender();
+    BOOST_CHECK_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(1)->d_string.getLineCount());
+    BOOST_REQUIRE_CLOSE(view->getItems().at(0)->d_size.d_height +
+        view->getItems().at(1)->d_size.d_height,
+        view->getRenderedTotalHeight(), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemAdded_ExistingItemsAreNotUpdated)
+{
+    model.d_items.push_back(ITEM1);
+    view->prepareForRender();
+
+    model.d_items.at(0) = ITEM2;
+    model.d_items.push_back(ITEM3);
+    model.notifyChildrenAdded(model.getRootIndex(), 1, 1);
+
+    view->prepareForRender();
+    BOOST_REQUIRE_EQUAL(2, view->getItems().size());
+    BOOST_CHECK_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_CHECK_EQUAL(ITEM3, view->getItems().at(1)->d_text);
+}
+
 //----------------------------------------------------------------------------//
 void triggerSelectRangeEvent(glm::vec2 position, ItemView* view)
 {
@@ -278,4 +314,66 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_ListIsSorted)
     BOOST_REQUIRE_EQUAL(ITEM3, *(static_cast<String*>(index.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemAppended_IsInsertedInSortedPosition)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(VSM_Ascending);
+    view->prepareForRender();
+
+    model.d_items.push_back(ITEM2);
+    model.notifyChildrenAdded(model.getRootIndex(), 2, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(3, view->getItems().size());
+    BOOST_CHECK_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_CHECK_EQUAL(ITEM2, view->getItems().at(1)->d_text);
+    BOOST_CHECK_EQUAL(ITEM3, view->getItems().at(2)->d_text);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, font_height + font_height / 2.0f));
+    BOOST_REQUIRE_EQUAL(ITEM2, *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(VirtualisedRendering_OnlyVisibleItemsAreUpdated)
+{
+    for (int i = 0; i < 1000; ++i)
+        model.d_items.push_back(" item .." + PropertyHelper<int>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualisedRenderingEnabled(true);
+    view->prepareForRender();
+
+    size_t updated_count = 0;
+    for (size_t i = 0; i < view->getItems().size(); ++i)
+    {
+        if (!view->getItems().at(i)->d_needsUpdate)
+            ++updated_count;
+    }
+
+    BOOST_REQUIRE_EQUAL(1000, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(1, view->getItems().front()->d_string.getLineCount());
+    BOOST_REQUIRE(view->getItems().back()->d_needsUpdate);
+    BOOST_REQUIRE(updated_count <= 10 + 2 * ItemView::VirtualisationOverscan + 1);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(VirtualisedRendering_PositionInsideObjectListWithScrollbar_ReturnsCorrectIndex)
+{
+    for (int i = 0; i < 1000; ++i)
+        model.d_items.push_back(" item .." + PropertyHelper<int>::toString(i));
+    model.d_items.push_back(ITEM1);
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualisedRenderingEnabled(true);
+    view->prepareForRender();
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+
+    ModelIndex index = view->indexAt(glm::vec2(1, 9 * font_height + font_height / 2.0f));
+
+    BOOST_REQUIRE(index.d_modelData != 0);
+    BOOST_REQUIRE_EQUAL(ITEM1, *(static_cast<String*>(index.d_modelData)));
+    BOOST_REQUIRE(!view->getItems().back()->d_needsUpdate);
+    BOOST_REQUIRE(view->getItems().front()->d_needsUpdate);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/MappedFileResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
+
+#include <cstring>
+
+using namespace CEGUI;
+
+struct MappedFileResourceProviderFixture
+{
+    MappedFileResourceProviderFixture() :
+        defaultProvider(*static_cast<DefaultResourceProvider*>(
+            System::getSingleton().getResourceProvider()))
+    {
+        provider.setResourceGroupDirectory(
+            "schemes", defaultProvider.getResourceGroupDirectory("schemes"));
+    }
+
+    DefaultResourceProvider& defaultProvider;
+    MappedFileResourceProvider provider;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MappedFileResourceProviderTestSuite,
+                         MappedFileResourceProviderFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LoadRawDataContainer_MatchesDefaultProvider)
+{
+    RawDataContainer copied;
+    defaultProvider.loadRawDataContainer("TaharezLook.scheme", copied, "schemes");
+
+    RawDataContainer mapped;
+    provider.loadRawDataContainer("TaharezLook.scheme", mapped, "schemes");
+
+    BOOST_REQUIRE(!mapped.ownsData());
+    BOOST_REQUIRE_EQUAL(copied.getSize(), mapped.getSize());
+    BOOST_REQUIRE(std::memcmp(copied.getDataPtr(), mapped.getDataPtr(),
+                              copied.getSize()) == 0);
+
+    provider.unloadRawDataContainer(mapped);
+    defaultProvider.unloadRawDataContainer(copied);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LoadRawDataContainer_SameFile_SharesMapping)
+{
+    RawDataContainer first;
+    RawDataContainer second;
+    provider.loadRawDataContainer("TaharezLook.scheme", first, "schemes");
+    provider.loadRawDataContainer("TaharezLook.scheme", second, "schemes");
+
+    BOOST_REQUIRE_EQUAL(first.getDataPtr(), second.getDataPtr());
+    BOOST_REQUIRE_EQUAL(1u, provider.getMappedFileCount());
+
+    provider.unloadRawDataContainer(first);
+    BOOST_REQUIRE_EQUAL(1u, provider.getMappedFileCount());
+
+    provider.unloadRawDataContainer(second);
+    BOOST_REQUIRE_EQUAL(0u, provider.getMappedFileCount());
+    BOOST_REQUIRE(second.getDataPtr() == 0);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LoadRawDataContainer_MissingFile_Throws)
+{
+    RawDataContainer data;
+
+    BOOST_REQUIRE_THROW(
+        provider.loadRawDataContainer("NoSuchFile.scheme", data, "schemes"),
+        FileIOException);
+    BOOST_REQUIRE_EQUAL(0u, provider.getMappedFileCount());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/WindowManager.h"
+
+using namespace CEGUI;
+
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture()
+    {
+        list = static_cast<MultiColumnList*>(
+            WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList", "mcl"));
+        list->addColumn("Name", 0, cegui_reldim(0.5f));
+        list->addColumn("Value", 1, cegui_reldim(0.5f));
+    }
+
+    ~MultiColumnListFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(list);
+    }
+
+    ListboxTextItem* addRow(const String& name)
+    {
+        ListboxTextItem* item = new ListboxTextItem(name);
+        list->addRow(item, 0);
+        return item;
+    }
+
+    MultiColumnList* list;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnListTestSuite, MultiColumnListFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetItemRowIndex_AfterSort_ReturnsSortedRow)
+{
+    ListboxTextItem* c = addRow("c");
+    ListboxTextItem* a = addRow("a");
+    ListboxTextItem* b = addRow("b");
+
+    list->setSortColumn(0);
+    list->setSortDirection(ListHeaderSegment::Ascending);
+
+    BOOST_REQUIRE_EQUAL(0, list->getItemRowIndex(a));
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(b));
+    BOOST_REQUIRE_EQUAL(2, list->getItemRowIndex(c));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SetSortDirection_Descending_ReversesRows)
+{
+    ListboxTextItem* a = addRow("a");
+    ListboxTextItem* b = addRow("b");
+    ListboxTextItem* c = addRow("c");
+    list->setSortColumn(0);
+    list->setSortDirection(ListHeaderSegment::Ascending);
+
+    list->setSortDirection(ListHeaderSegment::Descending);
+
+    BOOST_REQUIRE_EQUAL(c, list->getItemAtGridReference(MCLGridRef(0, 0)));
+    BOOST_REQUIRE_EQUAL(b, list->getItemAtGridReference(MCLGridRef(1, 0)));
+    BOOST_REQUIRE_EQUAL(a, list->getItemAtGridReference(MCLGridRef(2, 0)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(AddRow_Sorted_InsertsAtSortedPosition)
+{
+    addRow("a");
+    addRow("c");
+    list->setSortColumn(0);
+    list->setSortDirection(ListHeaderSegment::Ascending);
+
+    ListboxTextItem* b = addRow("b");
+
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(b));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RemoveRow_ItemIsNoLongerInList)
+{
+    addRow("a");
+    ListboxTextItem* b = new ListboxTextItem("b", 0, 0, false, false);
+    list->addRow(b, 0);
+
+    list->removeRow(1);
+
+    BOOST_REQUIRE(!list->isListboxItemInList(b));
+    delete b;
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetRowAtOffset_ReturnsRowContainingOffset)
+{
+    addRow("a");
+    addRow("b");
+    addRow("c");
+    const float height = list->getHighestRowItemHeight(0);
+
+    BOOST_REQUIRE_EQUAL(2 * height, list->getRowOffset(2));
+    BOOST_REQUIRE_EQUAL(3 * height, list->getTotalRowsHeight());
+    BOOST_REQUIRE_EQUAL(0, list->getRowAtOffset(-1.0f));
+    BOOST_REQUIRE_EQUAL(1, list->getRowAtOffset(height * 1.5f));
+    BOOST_REQUIRE_EQUAL(3, list->getRowAtOffset(height * 3.0f));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(InsertRemoveAndSetItem_KeepRowCachesCurrent)
+{
+    ListboxTextItem* a = addRow("a");
+    ListboxTextItem* c = addRow("c");
+    const float height = list->getHighestRowItemHeight(0);
+    // build the caches so the changes below update them in place.
+    BOOST_REQUIRE_EQUAL(2 * height, list->getTotalRowsHeight());
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(c));
+
+    ListboxTextItem* b = new ListboxTextItem("b");
+    list->insertRow(b, 0, 1);
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(b));
+    BOOST_REQUIRE_EQUAL(2, list->getItemRowIndex(c));
+    BOOST_REQUIRE_EQUAL(2 * height, list->getRowOffset(2));
+    BOOST_REQUIRE_EQUAL(3 * height, list->getTotalRowsHeight());
+
+    ListboxTextItem* value = new ListboxTextItem("value");
+    list->setItem(value, 1, 2);
+    BOOST_REQUIRE_EQUAL(2, list->getItemRowIndex(value));
+
+    list->removeRow(0);
+    BOOST_REQUIRE(!list->isListboxItemInList(a));
+    BOOST_REQUIRE_EQUAL(0, list->getItemRowIndex(b));
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(c));
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(value));
+    BOOST_REQUIRE_EQUAL(height, list->getRowOffset(1));
+    BOOST_REQUIRE_EQUAL(2 * height, list->getTotalRowsHeight());
+
+    list->setItem(0, 0, 1);
+    BOOST_REQUIRE(!list->isListboxItemInList(c));
+    BOOST_REQUIRE_EQUAL(1, list->getItemRowIndex(value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2014 Paul D Turner & The CEGUI Development Team
+ *
+ *    Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/MultiLineEditbox.h"
+#include "CEGUI/Clipboard.h"
+#include "CEGUI/WindowManager.h"
+
+using namespace CEGUI;
+
+static const String PARAGRAPH_TEXT(
+    "The quick brown fox jumps over the lazy dog, again and again.\n"
+    "Short line.\n"
+    "\n"
+    "Another paragraph that is long enough to be wrapped over several lines.\n");
+
+struct MultiLineEditboxFixture
+{
+    MultiLineEditboxFixture()
+    {
+        editbox = createEditbox("mle");
+    }
+
+    ~MultiLineEditboxFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(editbox);
+    }
+
+    MultiLineEditbox* createEditbox(const String& name)
+    {
+        MultiLineEditbox* mle = static_cast<MultiLineEditbox*>(
+            WindowManager::getSingleton().createWindow("TaharezLook/MultiLineEditbox", name));
+        mle->setSize(USize(cegui_absdim(200.0f), cegui_absdim(400.0f)));
+        mle->setText(PARAGRAPH_TEXT);
+        return mle;
+    }
+
+    //! Checks that the lines of \a editbox match those of a freshly formatted editbox.
+    void checkMatchesFullFormat()
+    {
+        MultiLineEditbox* reference = createEditbox("reference");
+        reference->setSize(editbox->getSize());
+        reference->setText(editbox->getText());
+
+        const MultiLineEditbox::LineList& lines = editbox->getFormattedLines();
+        const MultiLineEditbox::LineList& expected = reference->getFormattedLines();
+
+        BOOST_REQUIRE_EQUAL(lines.size(), expected.size());
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(lines[i].d_startIdx, expected[i].d_startIdx);
+            BOOST_CHECK_EQUAL(lines[i].d_length, expected[i].d_length);
+            BOOST_CHECK_CLOSE(lines[i].d_extent, expected[i].d_extent, 0.001f);
+        }
+
+        WindowManager::getSingleton().destroyWindow(reference);
+    }
+
+    void paste(size_t index, const String& text)
+    {
+        Clipboard clipboard;
+        clipboard.setText(text);
+        editbox->setCaretIndex(index);
+        editbox->performPaste(clipboard);
+    }
+
+    MultiLineEditbox* editbox;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiLineEditboxTestSuite, MultiLineEditboxFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Paste_WithinParagraph_MatchesFullFormat)
+{
+    paste(10, "very very very ");
+
+    checkMatchesFullFormat();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Paste_LineBreaks_MatchesFullFormat)
+{
+    paste(20, "\nnew paragraph\nand another one, long enough to wrap around\n");
+
+    checkMatchesFullFormat();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(EraseSelection_AcrossParagraphs_MatchesFullFormat)
+{
+    Clipboard clipboard;
+    editbox->setSelection(30, 80);
+    editbox->performCut(clipboard);
+
+    checkMatchesFullFormat();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Undo_Paste_RestoresText)
+{
+    paste(5, "inserted\n");
+    BOOST_REQUIRE(editbox->performUndo());
+
+    BOOST_CHECK_EQUAL(editbox->getText(), PARAGRAPH_TEXT);
+    checkMatchesFullFormat();
+
+    BOOST_REQUIRE(editbox->performRedo());
+    checkMatchesFullFormat();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Resize_MatchesFullFormat)
+{
+    editbox->setSize(USize(cegui_absdim(120.0f), cegui_absdim(400.0f)));
+    checkMatchesFullFormat();
+
+    editbox->setSize(USize(cegui_absdim(600.0f), cegui_absdim(400.0f)));
+    checkMatchesFullFormat();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetLineNumberFromIndex_ReturnsContainingLine)
+{
+    const MultiLineEditbox::LineList& lines = editbox->getFormattedLines();
+
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(editbox->getLineNumberFromIndex(lines[i].d_startIdx), i);
+        BOOST_CHECK_EQUAL(
+            editbox->getLineNumberFromIndex(lines[i].d_startIdx + lines[i].d_length - 1), i);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
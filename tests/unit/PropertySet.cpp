@@ -57,6 +57,13 @@ public:
         CEGUI_DEFINE_PROPERTY(TestPropertySet, int, "MemberValue", "", &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
     }
 
+    void defineOtherProperty()
+    {
+        const CEGUI::String propertyOrigin = "TestPropertySet";
+
+        CEGUI_DEFINE_PROPERTY(TestPropertySet, int, "OtherValue", "", &TestPropertySet::setMemberValue, &TestPropertySet::getMemberValue, 0);
+    }
+
 private:
     int d_memberValue;
 };
@@ -93,4 +100,39 @@ BOOST_AUTO_TEST_CASE(SettingGetting)
     BOOST_CHECK_EQUAL(set.getProperty<int>("MemberValue"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(AddingRemoving)
+{
+    TestPropertySet set1;
+    TestPropertySet set2;
+
+    // properties added to one set must not show up in others
+    set1.defineOtherProperty();
+    BOOST_CHECK(set1.isPropertyPresent("OtherValue"));
+    BOOST_CHECK(!set2.isPropertyPresent("OtherValue"));
+
+    set2.defineOtherProperty();
+    set2.removeProperty("MemberValue");
+    BOOST_CHECK(set1.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(!set2.isPropertyPresent("MemberValue"));
+    BOOST_CHECK(set2.isPropertyPresent("OtherValue"));
+
+    // removing a property that isn't there does nothing
+    set2.removeProperty("MemberValue");
+    BOOST_CHECK(set2.isPropertyPresent("OtherValue"));
+
+    size_t count = 0;
+    for (CEGUI::PropertySet::PropertyIterator it = set1.getPropertyIterator(); !it.isAtEnd(); ++it)
+        ++count;
+    BOOST_CHECK_EQUAL(count, 2u);
+
+    set1.clearProperties();
+    BOOST_CHECK(set1.getPropertyIterator().isAtEnd());
+    BOOST_CHECK(set2.isPropertyPresent("OtherValue"));
+
+    // copies share the properties of the original
+    TestPropertySet set3(set2);
+    BOOST_CHECK(set3.isPropertyPresent("OtherValue"));
+    BOOST_CHECK(!set3.isPropertyPresent("MemberValue"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
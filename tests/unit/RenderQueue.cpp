@@ -0,0 +1,205 @@
+/***********************************************************************
+ *    created:    16/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderQueue.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/ShaderParameterBindings.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! GeometryBuffer wrapper that counts how it is drawn.
+class CountingGeometryBuffer : public CEGUI::GeometryBuffer
+{
+public:
+    CountingGeometryBuffer(const CEGUI::GeometryBuffer& buffer) :
+        CEGUI::GeometryBuffer(buffer.getRenderMaterial()),
+        d_drawCount(0),
+        d_drawWithCount(0),
+        d_clipRect(buffer.getClippingRegion())
+    {
+        addVertexAttribute(CEGUI::VAT_POSITION0);
+        addVertexAttribute(CEGUI::VAT_COLOUR0);
+        addVertexAttribute(CEGUI::VAT_TEXCOORD0);
+    }
+
+    void draw() const { ++d_drawCount; }
+
+    void drawWith(const CEGUI::GeometryBuffer* const* others,
+                  std::size_t count) const
+    {
+        ++d_drawWithCount;
+        CEGUI::GeometryBuffer::drawWith(others, count);
+    }
+
+    void setClippingRegion(const CEGUI::Rectf& region) { d_clipRect = region; }
+    const CEGUI::Rectf& getClippingRegion() const { return d_clipRect; }
+
+    mutable int d_drawCount;
+    mutable int d_drawWithCount;
+
+private:
+    CEGUI::Rectf d_clipRect;
+};
+
+struct RenderQueueFixture
+{
+    RenderQueueFixture() :
+        d_renderer(*CEGUI::System::getSingleton().getRenderer()),
+        d_texture1(d_renderer.createTexture("RenderQueueTest1", CEGUI::Sizef(64, 64))),
+        d_texture2(d_renderer.createTexture("RenderQueueTest2", CEGUI::Sizef(64, 64)))
+    {
+    }
+
+    ~RenderQueueFixture()
+    {
+        for (size_t i = 0; i < d_buffers.size(); ++i)
+            d_renderer.destroyGeometryBuffer(*d_buffers[i]);
+
+        d_renderer.destroyTexture(d_texture1);
+        d_renderer.destroyTexture(d_texture2);
+
+        CEGUI::RenderQueue::setDrawMergingEnabled(false);
+    }
+
+    CEGUI::GeometryBuffer& createTextured(const CEGUI::Texture& texture)
+    {
+        CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBufferTextured();
+        buffer.setTexture("texture0", &texture);
+        buffer.setClippingRegion(CEGUI::Rectf(0, 0, 100, 100));
+        d_buffers.push_back(&buffer);
+
+        return buffer;
+    }
+
+    CEGUI::Renderer& d_renderer;
+    CEGUI::Texture& d_texture1;
+    CEGUI::Texture& d_texture2;
+    std::vector<CEGUI::GeometryBuffer*> d_buffers;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderQueue, RenderQueueFixture)
+
+BOOST_AUTO_TEST_CASE(IsDrawCompatible_SameState)
+{
+    CEGUI::GeometryBuffer& a = createTextured(d_texture1);
+    CEGUI::GeometryBuffer& b = createTextured(d_texture1);
+
+    BOOST_CHECK(a.isDrawCompatible(b));
+
+    // transformations are applied per buffer when merging
+    b.setTranslation(glm::vec3(10, 20, 0));
+    BOOST_CHECK(a.isDrawCompatible(b));
+
+    // the clipping region is irrelevant while clipping is off
+    a.setClippingActive(false);
+    b.setClippingActive(false);
+    b.setClippingRegion(CEGUI::Rectf(0, 0, 50, 50));
+    BOOST_CHECK(a.isDrawCompatible(b));
+}
+
+BOOST_AUTO_TEST_CASE(IsDrawCompatible_StateDiffers)
+{
+    CEGUI::GeometryBuffer& a = createTextured(d_texture1);
+
+    BOOST_CHECK(!a.isDrawCompatible(createTextured(d_texture2)));
+
+    CEGUI::GeometryBuffer& clipped = createTextured(d_texture1);
+    clipped.setClippingRegion(CEGUI::Rectf(0, 0, 50, 50));
+    BOOST_CHECK(!a.isDrawCompatible(clipped));
+
+    CEGUI::GeometryBuffer& faded = createTextured(d_texture1);
+    faded.setAlpha(0.5f);
+    BOOST_CHECK(!a.isDrawCompatible(faded));
+
+    CEGUI::GeometryBuffer& blended = createTextured(d_texture1);
+    blended.setBlendMode(CEGUI::BM_RTT_PREMULTIPLIED);
+    BOOST_CHECK(!a.isDrawCompatible(blended));
+
+    CEGUI::GeometryBuffer& coloured = d_renderer.createGeometryBufferColoured();
+    d_buffers.push_back(&coloured);
+    BOOST_CHECK(!a.isDrawCompatible(coloured));
+}
+
+BOOST_AUTO_TEST_CASE(IsDrawCompatible_ComparesCustomShaderParameters)
+{
+    CEGUI::GeometryBuffer& a = createTextured(d_texture1);
+    CEGUI::GeometryBuffer& b = createTextured(d_texture1);
+    CEGUI::ShaderParameterBindings& a_params =
+        *a.getRenderMaterial()->getShaderParamBindings();
+    CEGUI::ShaderParameterBindings& b_params =
+        *b.getRenderMaterial()->getShaderParamBindings();
+
+    a_params.setParameter("customValue", 0.25f);
+    BOOST_CHECK(!a.isDrawCompatible(b));
+    BOOST_CHECK(!b.isDrawCompatible(a));
+
+    b_params.setParameter("customValue", 0.5f);
+    BOOST_CHECK(!a.isDrawCompatible(b));
+
+    b_params.setParameter("customValue", 0.25f);
+    BOOST_CHECK(a.isDrawCompatible(b));
+
+    // parameters the renderer sets from the buffer when drawing are ignored
+    a_params.setParameter("modelViewProjMatrix", glm::mat4(2.0f));
+    BOOST_CHECK(a.isDrawCompatible(b));
+}
+
+BOOST_AUTO_TEST_CASE(Draw_MergesAdjacentCompatibleBuffers)
+{
+    CountingGeometryBuffer a(createTextured(d_texture1));
+    CountingGeometryBuffer b(a);
+    CountingGeometryBuffer c(a);
+    CountingGeometryBuffer d(a);
+    c.setAlpha(0.5f);
+
+    CEGUI::RenderQueue queue;
+    queue.addGeometryBuffer(a);
+    queue.addGeometryBuffer(b);
+    queue.addGeometryBuffer(c);
+    queue.addGeometryBuffer(d);
+
+    queue.draw();
+    BOOST_CHECK_EQUAL(a.d_drawWithCount, 0);
+
+    CEGUI::RenderQueue::setDrawMergingEnabled(true);
+    queue.draw();
+
+    // a and b form one run; c breaks it, so d is drawn on its own
+    BOOST_CHECK_EQUAL(a.d_drawWithCount, 1);
+    BOOST_CHECK_EQUAL(c.d_drawWithCount, 0);
+    BOOST_CHECK_EQUAL(d.d_drawWithCount, 0);
+
+    // every buffer is still drawn exactly once per queue draw
+    BOOST_CHECK_EQUAL(a.d_drawCount, 2);
+    BOOST_CHECK_EQUAL(b.d_drawCount, 2);
+    BOOST_CHECK_EQUAL(c.d_drawCount, 2);
+    BOOST_CHECK_EQUAL(d.d_drawCount, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+/***********************************************************************
+    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+/*
+ * The cached geometry is told apart by d_postStencilVertexCount, which is
+ * set to an id for each tesselation added to the cache.
+ */
+static void addTesselation(SVGData& data, float scale, bool anti_aliasing,
+                           unsigned int id)
+{
+    SVGData::TesselatedGeometryList geometry(1);
+    geometry[0].d_postStencilVertexCount = id;
+    geometry[0].d_vertexData.assign(9, 1.0f);
+
+    data.addCachedTesselation(glm::vec2(scale, scale), anti_aliasing, geometry);
+
+    // the geometry is moved into the cache, if it is enabled.
+    BOOST_CHECK_EQUAL(geometry.empty(), data.getTesselationCacheSize() != 0);
+}
+
+static unsigned int getTesselationId(SVGData& data, float scale,
+                                     bool anti_aliasing)
+{
+    const SVGData::TesselatedGeometryList* geometry =
+        data.getCachedTesselation(glm::vec2(scale, scale), anti_aliasing);
+
+    if (!geometry || geometry->size() != 1)
+        return 0;
+
+    return (*geometry)[0].d_postStencilVertexCount;
+}
+
+BOOST_AUTO_TEST_SUITE(SVGData)
+
+BOOST_AUTO_TEST_CASE(TesselationCache_HitsOnSameScaleAndAntiAliasing)
+{
+    CEGUI::SVGData data("test");
+    addTesselation(data, 1.0f, true, 1);
+
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 1u);
+    BOOST_CHECK_EQUAL((*data.getCachedTesselation(glm::vec2(1.0f, 1.0f), true))[0]
+                          .d_vertexData.size(), 9u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, false), 0u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 2.0f, true), 0u);
+    BOOST_CHECK(!data.getCachedTesselation(glm::vec2(1.0f, 2.0f), true));
+
+    addTesselation(data, 1.0f, false, 2);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 1u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, false), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(TesselationCache_EvictsLeastRecentlyUsed)
+{
+    CEGUI::SVGData data("test");
+    BOOST_REQUIRE_EQUAL(data.getTesselationCacheSize(), 8u);
+
+    for (unsigned int i = 1; i <= 8; ++i)
+        addTesselation(data, static_cast<float>(i), true, i);
+
+    for (unsigned int i = 1; i <= 8; ++i)
+        BOOST_CHECK_EQUAL(getTesselationId(data, static_cast<float>(i), true), i);
+
+    // scale 1 was used least recently until it is used again here.
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 1u);
+    addTesselation(data, 9.0f, true, 9);
+
+    BOOST_CHECK_EQUAL(getTesselationId(data, 2.0f, true), 0u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 1u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 9.0f, true), 9u);
+    for (unsigned int i = 3; i <= 8; ++i)
+        BOOST_CHECK_EQUAL(getTesselationId(data, static_cast<float>(i), true), i);
+}
+
+BOOST_AUTO_TEST_CASE(TesselationCache_Resize)
+{
+    CEGUI::SVGData data("test");
+    for (unsigned int i = 1; i <= 4; ++i)
+        addTesselation(data, static_cast<float>(i), true, i);
+
+    data.setTesselationCacheSize(2);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 0u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 2.0f, true), 0u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 3.0f, true), 3u);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 4.0f, true), 4u);
+
+    data.setTesselationCacheSize(0);
+    addTesselation(data, 5.0f, true, 5);
+    BOOST_CHECK_EQUAL(getTesselationId(data, 5.0f, true), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(TesselationCache_ClearedWhenShapesChange)
+{
+    CEGUI::SVGData data("test");
+
+    addTesselation(data, 1.0f, true, 1);
+    data.addShape(new SVGRect());
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 0u);
+
+    addTesselation(data, 1.0f, true, 2);
+    data.destroyShapes();
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 0u);
+
+    addTesselation(data, 1.0f, true, 3);
+    data.clearTesselationCache();
+    BOOST_CHECK_EQUAL(getTesselationId(data, 1.0f, true), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,395 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderTarget.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <vector>
+
+/*
+ * The expected images in these tests are written as one string per row,
+ * with '.' for a pixel left untouched (transparent black) and '#' for a
+ * pixel of the colour given to checkImage.
+ */
+struct SoftwareRendererFixture
+{
+    SoftwareRendererFixture() :
+        d_renderer(CEGUI::SoftwareRenderer::create(CEGUI::Sizef(8, 8))),
+        d_frameBuffer(d_renderer.getFrameBuffer())
+    {
+    }
+
+    ~SoftwareRendererFixture()
+    {
+        CEGUI::SoftwareRenderer::destroy(d_renderer);
+    }
+
+    CEGUI::GeometryBuffer& createColouredBuffer()
+    {
+        CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBufferColoured(
+            d_renderer.createRenderMaterial(CEGUI::DS_SOLID));
+        buffer.setClippingActive(false);
+        return buffer;
+    }
+
+    CEGUI::GeometryBuffer& createTexturedBuffer(const CEGUI::Texture& texture)
+    {
+        CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBufferTextured(
+            d_renderer.createRenderMaterial(CEGUI::DS_TEXTURED));
+        buffer.setTexture("texture0", &texture);
+        buffer.setClippingActive(false);
+        return buffer;
+    }
+
+    static void addQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Rectf& r,
+                        const glm::vec4& colour)
+    {
+        const CEGUI::ColouredVertex vbuffer[6] = {
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.bottom(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.left(), r.top(), 0), colour),
+            CEGUI::ColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour)
+        };
+        buffer.appendGeometry(vbuffer, 6);
+    }
+
+    static void addTexturedQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Rectf& r,
+                                const glm::vec4& colour,
+                                const CEGUI::Rectf& uv = CEGUI::Rectf(0, 0, 1, 1))
+    {
+        const CEGUI::TexturedColouredVertex vbuffer[6] = {
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.top(), 0), colour, glm::vec2(uv.left(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.bottom(), 0), colour, glm::vec2(uv.left(), uv.bottom())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour, glm::vec2(uv.right(), uv.bottom())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.top(), 0), colour, glm::vec2(uv.right(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.left(), r.top(), 0), colour, glm::vec2(uv.left(), uv.top())),
+            CEGUI::TexturedColouredVertex(glm::vec3(r.right(), r.bottom(), 0), colour, glm::vec2(uv.right(), uv.bottom()))
+        };
+        buffer.appendGeometry(vbuffer, 6);
+    }
+
+    void drawToFrameBuffer(const CEGUI::GeometryBuffer& buffer)
+    {
+        CEGUI::RenderTarget& target = d_renderer.getDefaultRenderTarget();
+        target.activate();
+        target.draw(buffer);
+        target.deactivate();
+    }
+
+    //! return the image as text, so a failing check shows the whole picture.
+    std::string describeImage(CEGUI::argb_t colour) const
+    {
+        std::ostringstream out;
+        const CEGUI::argb_t* pixels = d_frameBuffer.getPixels();
+
+        for (CEGUI::uint y = 0; y < d_frameBuffer.getPixelHeight(); ++y)
+        {
+            out << '\n';
+            for (CEGUI::uint x = 0; x < d_frameBuffer.getPixelWidth(); ++x)
+            {
+                const CEGUI::argb_t pixel = pixels[y * d_frameBuffer.getPixelWidth() + x];
+                out << (pixel == 0 ? '.' : pixel == colour ? '#' : '?');
+            }
+        }
+
+        return out.str();
+    }
+
+    void checkImage(const char* const* rows, CEGUI::argb_t colour) const
+    {
+        std::string expected;
+        for (CEGUI::uint y = 0; y < d_frameBuffer.getPixelHeight(); ++y)
+            expected += std::string("\n") + rows[y];
+
+        BOOST_CHECK_EQUAL(describeImage(colour), expected);
+    }
+
+    CEGUI::argb_t pixel(int x, int y) const
+    {
+        return d_frameBuffer.getPixels()[y * d_frameBuffer.getPixelWidth() + x];
+    }
+
+    CEGUI::SoftwareRenderer& d_renderer;
+    CEGUI::SoftwareTexture& d_frameBuffer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SoftwareRenderer, SoftwareRendererFixture)
+
+BOOST_AUTO_TEST_CASE(QuadCoversPixelCentres)
+{
+    // the bottom edge passes through the centres of row 4, which therefore
+    // belongs to whatever lies below the quad.
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(1, 2, 5, 4.5f), glm::vec4(1, 1, 1, 1));
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "........",
+        "........",
+        ".####...",
+        ".####...",
+        "........",
+        "........",
+        "........",
+        "........"
+    };
+    checkImage(expected, 0xFFFFFFFF);
+}
+
+BOOST_AUTO_TEST_CASE(SharedEdgesAreDrawnOnce)
+{
+    // a translucent quad would show the diagonal if it was blended twice.
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(1, 1, 1, 0.5f));
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "########",
+        "########",
+        "########",
+        "########",
+        "########",
+        "########",
+        "########",
+        "########"
+    };
+    checkImage(expected, pixel(0, 0));
+    BOOST_CHECK(pixel(0, 0) != 0);
+}
+
+BOOST_AUTO_TEST_CASE(NormalBlending)
+{
+    CEGUI::GeometryBuffer& background = createColouredBuffer();
+    addQuad(background, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(0, 0, 1, 1));
+    drawToFrameBuffer(background);
+
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(1, 0, 0, 1));
+    buffer.setAlpha(0.5f);
+    drawToFrameBuffer(buffer);
+
+    BOOST_CHECK_EQUAL(pixel(3, 3), 0xFF80007Fu);
+}
+
+BOOST_AUTO_TEST_CASE(PremultipliedBlending)
+{
+    CEGUI::GeometryBuffer& background = createColouredBuffer();
+    addQuad(background, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(1, 1, 1, 1));
+    drawToFrameBuffer(background);
+
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(0.5f, 0, 0, 0.5f));
+    buffer.setBlendMode(CEGUI::BM_RTT_PREMULTIPLIED);
+    drawToFrameBuffer(buffer);
+
+    BOOST_CHECK_EQUAL(pixel(3, 3), 0xFFFF7F7Fu);
+}
+
+BOOST_AUTO_TEST_CASE(ScissorClipping)
+{
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(1, 1, 1, 1));
+    buffer.setClippingRegion(CEGUI::Rectf(2, 1, 7, 3));
+    buffer.setClippingActive(true);
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "........",
+        "..#####.",
+        "..#####.",
+        "........",
+        "........",
+        "........",
+        "........",
+        "........"
+    };
+    checkImage(expected, 0xFFFFFFFF);
+}
+
+BOOST_AUTO_TEST_CASE(Translation)
+{
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 2, 2), glm::vec4(1, 1, 1, 1));
+    buffer.setTranslation(glm::vec3(5, 1, 0));
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "........",
+        ".....##.",
+        ".....##.",
+        "........",
+        "........",
+        "........",
+        "........",
+        "........"
+    };
+    checkImage(expected, 0xFFFFFFFF);
+}
+
+BOOST_AUTO_TEST_CASE(TexturedQuad)
+{
+    // RGBA bytes of a 2x2 texture
+    const CEGUI::uint8 texels[] = {
+        0xFF, 0x00, 0x00, 0xFF,   0x00, 0xFF, 0x00, 0xFF,
+        0x00, 0x00, 0xFF, 0xFF,   0xFF, 0xFF, 0xFF, 0x80
+    };
+    CEGUI::Texture& texture = d_renderer.createTexture("SoftwareRendererTest");
+    texture.loadFromMemory(texels, CEGUI::Sizef(2, 2), CEGUI::Texture::PF_RGBA);
+
+    CEGUI::GeometryBuffer& buffer = createTexturedBuffer(texture);
+    addTexturedQuad(buffer, CEGUI::Rectf(2, 2, 4, 4), glm::vec4(1, 1, 1, 1));
+    drawToFrameBuffer(buffer);
+
+    BOOST_CHECK_EQUAL(pixel(2, 2), 0xFFFF0000u);
+    BOOST_CHECK_EQUAL(pixel(3, 2), 0xFF00FF00u);
+    BOOST_CHECK_EQUAL(pixel(2, 3), 0xFF0000FFu);
+    BOOST_CHECK_EQUAL(pixel(3, 3), 0x80808080u);
+    BOOST_CHECK_EQUAL(pixel(1, 1), 0u);
+    BOOST_CHECK_EQUAL(pixel(4, 4), 0u);
+
+    // vertex colours modulate the texture
+    d_frameBuffer.clear();
+    buffer.reset();
+    buffer.setClippingActive(false);
+    addTexturedQuad(buffer, CEGUI::Rectf(2, 2, 4, 4), glm::vec4(1, 0, 1, 1));
+    drawToFrameBuffer(buffer);
+
+    BOOST_CHECK_EQUAL(pixel(2, 2), 0xFFFF0000u);
+    BOOST_CHECK_EQUAL(pixel(3, 2), 0xFF000000u);
+    BOOST_CHECK_EQUAL(pixel(2, 3), 0xFF0000FFu);
+}
+
+BOOST_AUTO_TEST_CASE(EvenOddFill)
+{
+    // two overlapping squares fill the stencil; the overlap is outside
+    // under the even-odd rule.  The last quad is drawn through the stencil.
+    CEGUI::GeometryBuffer& buffer = createColouredBuffer();
+    addQuad(buffer, CEGUI::Rectf(0, 0, 5, 5), glm::vec4(1, 1, 1, 1));
+    addQuad(buffer, CEGUI::Rectf(3, 3, 8, 8), glm::vec4(1, 1, 1, 1));
+    addQuad(buffer, CEGUI::Rectf(0, 0, 8, 8), glm::vec4(1, 1, 1, 1));
+    buffer.setStencilRenderingActive(CEGUI::PFR_EVEN_ODD);
+    buffer.setStencilPostRenderingVertexCount(6);
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "#####...",
+        "#####...",
+        "#####...",
+        "###..###",
+        "###..###",
+        "...#####",
+        "...#####",
+        "...#####"
+    };
+    checkImage(expected, 0xFFFFFFFF);
+}
+
+BOOST_AUTO_TEST_CASE(RenderToTexture)
+{
+    CEGUI::TextureTarget* target = d_renderer.createTextureTarget();
+    target->clear();
+    const CEGUI::Sizef& texture_size = target->getTexture().getSize();
+
+    CEGUI::GeometryBuffer& content = createColouredBuffer();
+    addQuad(content, CEGUI::Rectf(0, 0, 2, 4), glm::vec4(1, 1, 1, 1));
+    target->activate();
+    target->draw(content);
+    target->deactivate();
+
+    CEGUI::GeometryBuffer& buffer = createTexturedBuffer(target->getTexture());
+    addTexturedQuad(buffer, CEGUI::Rectf(4, 4, 8, 8), glm::vec4(1, 1, 1, 1),
+                    CEGUI::Rectf(0, 0, 4 / texture_size.d_width, 4 / texture_size.d_height));
+    drawToFrameBuffer(buffer);
+
+    const char* const expected[] = {
+        "........",
+        "........",
+        "........",
+        "........",
+        "....##..",
+        "....##..",
+        "....##..",
+        "....##.."
+    };
+    checkImage(expected, 0xFFFFFFFF);
+
+    d_renderer.destroyTextureTarget(target);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerThreadsMatchCallingThread)
+{
+    // large enough for the bands of each draw to be shared out.
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(256, 512));
+    CEGUI::SoftwareRasteriser& rasteriser = renderer.getRasteriser();
+    std::vector<CEGUI::argb_t> images[2];
+
+    for (int run = 0; run < 2; ++run)
+    {
+        rasteriser.setWorkerThreadCount(run == 0 ? 0 : 3);
+        renderer.getFrameBuffer().clear();
+
+        CEGUI::GeometryBuffer& buffer = renderer.createGeometryBufferColoured(
+            renderer.createRenderMaterial(CEGUI::DS_SOLID));
+        buffer.setClippingActive(false);
+        for (int i = 0; i < 8; ++i)
+            addQuad(buffer, CEGUI::Rectf(i * 7.5f, i * 31.3f, 256 - i * 11.0f, 512 - i * 5.7f),
+                    glm::vec4(i / 8.0f, 1 - i / 8.0f, 0.5f, 0.4f));
+        buffer.setAlpha(0.8f);
+
+        CEGUI::RenderTarget& target = renderer.getDefaultRenderTarget();
+        target.activate();
+        target.draw(buffer);
+        target.deactivate();
+        renderer.destroyGeometryBuffer(buffer);
+
+        const CEGUI::SoftwareTexture& frame_buffer = renderer.getFrameBuffer();
+        images[run].assign(frame_buffer.getPixels(), frame_buffer.getPixels() +
+            frame_buffer.getPixelWidth() * frame_buffer.getPixelHeight());
+    }
+
+    BOOST_CHECK(images[0] == images[1]);
+    BOOST_CHECK(images[0][256 * 256 + 128] != 0);
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
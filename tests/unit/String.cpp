@@ -29,8 +29,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#if __cplusplus >= 201103L
+#   include <type_traits>
+#endif
+
 // it's not worth it to test std::string, is it?
-#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UNICODE
+#if CEGUI_STRING_CLASS != CEGUI_STRING_CLASS_STD
 
 BOOST_AUTO_TEST_SUITE(String)
 
@@ -56,6 +60,105 @@ BOOST_AUTO_TEST_CASE(Operators)
     BOOST_CHECK(a != b);
 }
 
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8
+
+BOOST_AUTO_TEST_CASE(SmallStringOptimisation)
+{
+    CEGUI::String a("short name");
+    const CEGUI::String::size_type small_capacity = a.capacity();
+
+    BOOST_CHECK_EQUAL(small_capacity, CEGUI_STR_SMALL_BUFFER_SIZE - 1);
+
+    a.append(100, 'x');
+    BOOST_CHECK_EQUAL(a.length(), 110);
+    BOOST_CHECK(a.capacity() >= 110);
+
+    a.resize(5);
+    a.shrink_to_fit();
+    BOOST_CHECK_EQUAL(a, "short");
+    BOOST_CHECK_EQUAL(a.capacity(), small_capacity);
+}
+
+BOOST_AUTO_TEST_CASE(CodePointAccess)
+{
+    // "h", e acute, euro sign, U+1F600
+    const CEGUI::String a("h\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+
+    BOOST_CHECK_EQUAL(a.length(), 4);
+    BOOST_CHECK_EQUAL(a.utf8_length(), 10);
+    BOOST_CHECK_EQUAL(a[3], 0x1F600);
+    BOOST_CHECK_EQUAL(a[1], 0xE9);
+    BOOST_CHECK_EQUAL(a[2], 0x20AC);
+    BOOST_CHECK_EQUAL(a[0], 'h');
+    BOOST_CHECK_THROW(a.at(4), std::out_of_range);
+
+    CEGUI::String::size_type count = 0;
+    for (CEGUI::String::const_reverse_iterator iter = a.rbegin(); iter != a.rend(); ++iter)
+        ++count;
+
+    BOOST_CHECK_EQUAL(count, a.length());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidUTF8)
+{
+    // bytes that are not valid utf8 are taken as Latin-1
+    const CEGUI::String a("caf\xE9");
+
+    BOOST_CHECK_EQUAL(a.length(), 4);
+    BOOST_CHECK_EQUAL(a[3], 0xE9);
+    BOOST_CHECK_EQUAL(a, "caf\xC3\xA9");
+}
+
+BOOST_AUTO_TEST_CASE(Modification)
+{
+    CEGUI::String a("one \xE2\x82\xAC two");
+
+    BOOST_CHECK_EQUAL(a.find("two"), 6);
+    BOOST_CHECK_EQUAL(a.find(0x20AC), 4);
+    BOOST_CHECK_EQUAL(a.rfind('o'), 8);
+    BOOST_CHECK_EQUAL(a.substr(4, 1), "\xE2\x82\xAC");
+
+    a.erase(3, 2);
+    BOOST_CHECK_EQUAL(a, "one two");
+
+    a.insert(4, "and ");
+    BOOST_CHECK_EQUAL(a, "one and two");
+
+    a.replace(0, 3, CEGUI::String(1, 0x20AC));
+    BOOST_CHECK_EQUAL(a, "\xE2\x82\xAC and two");
+
+    a.append(a);
+    BOOST_CHECK_EQUAL(a.length(), 18);
+    BOOST_CHECK_EQUAL(a.rfind(0x20AC), 9);
+}
+
+BOOST_AUTO_TEST_CASE(Swap)
+{
+    CEGUI::String a("small");
+    CEGUI::String b(50, 'b');
+
+    a.swap(b);
+    BOOST_CHECK_EQUAL(a, CEGUI::String(50, 'b'));
+    BOOST_CHECK_EQUAL(b, "small");
+
+#ifdef CEGUI_STRING_HAS_MOVE_SEMANTICS
+    CEGUI::String c(std::move(a));
+    BOOST_CHECK_EQUAL(c.length(), 50);
+    BOOST_CHECK(a.empty());
+#endif
+}
+
+#if __cplusplus >= 201103L
+BOOST_AUTO_TEST_CASE(MoveOperationsDoNotThrow)
+{
+    // std::vector only moves elements that can't throw while moving.
+    BOOST_CHECK(std::is_nothrow_move_constructible<CEGUI::String>::value);
+    BOOST_CHECK(std::is_nothrow_move_assignable<CEGUI::String>::value);
+}
+#endif
+
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -544,6 +544,33 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_TreeIsSorted)
         children.at(2)->d_renderedChildren.at(1)->d_renderedChildren.at(2)->d_childId);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemAppended_IsRenderedInSortedPosition)
+{
+    model.addItemAtPosition(InventoryItem::make("C", 1, &model.getRoot()), 0);
+    model.addItemAtPosition(InventoryItem::make("A", 1, &model.getRoot()), 1);
+    model.addItemAtPosition(InventoryItem::make("E", 1, &model.getRoot()), 2);
+    view->setSortMode(VSM_Ascending);
+    view->prepareForRender();
+
+    InventoryItem* appended = InventoryItem::make("B", 1, &model.getRoot());
+    model.addItemAtPosition(appended, 3);
+    view->prepareForRender();
+
+    const std::vector<TreeViewItemRenderingState*>& children =
+        view->getRootItemState().d_renderedChildren;
+    BOOST_REQUIRE_EQUAL(4, children.size());
+    BOOST_CHECK_EQUAL(1, children.at(0)->d_childId);
+    BOOST_CHECK_EQUAL(3, children.at(1)->d_childId);
+    BOOST_CHECK_EQUAL(0, children.at(2)->d_childId);
+    BOOST_CHECK_EQUAL(2, children.at(3)->d_childId);
+
+    ModelIndex index = view->indexAt(glm::vec2(
+        expander_width * 2,
+        font_height + font_height / 2));
+    BOOST_REQUIRE_EQUAL(appended, static_cast<InventoryItem*>(index.d_modelData));
+}
+
 BOOST_AUTO_TEST_CASE(MultipleLevelsHierarchy_RenderedMaxWidthGreaterThanViewSize)
 {
     view->setSize(USize(cegui_absdim(10), cegui_absdim(10)));
@@ -562,4 +589,53 @@ BOOST_AUTO_TEST_CASE(MultipleLevelsHierarchy_RenderedMaxWidthGreaterThanViewSize
     BOOST_REQUIRE(view->getRenderedMaxWidth() > 100);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(VirtualisedRendering_PositionInsideObjectTreeWithScrollbar_ReturnsCorrectIndex)
+{
+    for (int i = 0; i < 500; ++i)
+        model.addRandomItemWithChildren(model.getRootIndex(), 0);
+
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(font_height * 10)));
+    view->setVirtualisedRenderingEnabled(true);
+    view->prepareForRender();
+    BOOST_REQUIRE(!view->getRenderedItems().front()->d_needsUpdate);
+    BOOST_REQUIRE(view->getRenderedItems().back()->d_needsUpdate);
+
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+
+    ModelIndex index = view->indexAt(glm::vec2(
+        expander_width * 2,
+        9 * font_height + font_height / 2.0f));
+
+    BOOST_REQUIRE(index.d_modelData != 0);
+    BOOST_REQUIRE_EQUAL(
+        model.getRoot().getChildren().at(499),
+        static_cast<InventoryItem*>(index.d_modelData));
+    BOOST_REQUIRE(!view->getRenderedItems().back()->d_needsUpdate);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetIndexRect_ItemInExpandedSubtree_ReturnsItemArea)
+{
+    model.addRandomItemWithChildren(model.getRootIndex(), 0, 3);
+    model.addRandomItemWithChildren(model.getRootIndex(), 0, 3);
+    view->prepareForRender();
+    ItemView* item_view = view;
+
+    ModelIndex first_node = model.makeIndex(0, model.getRootIndex());
+    ModelIndex child_node = model.makeIndex(1, first_node);
+    BOOST_REQUIRE_EQUAL(0, item_view->getIndexRect(child_node).getHeight());
+
+    view->expandSubtreeRecursive(
+        *view->getRootItemState().d_renderedChildren.at(0));
+    Rectf rect = item_view->getIndexRect(child_node);
+
+    const std::vector<TreeViewItemRenderingState*>& items = view->getRenderedItems();
+    BOOST_REQUIRE_EQUAL(5, items.size());
+    BOOST_REQUIRE_CLOSE(items.at(0)->d_size.d_height + items.at(1)->d_size.d_height,
+        rect.top(), 0.01f);
+    BOOST_REQUIRE_CLOSE(items.at(2)->d_size.d_height, rect.getHeight(), 0.01f);
+    BOOST_REQUIRE(rect.left() > item_view->getIndexRect(first_node).left());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,8 @@
 
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -70,6 +72,20 @@ struct LayoutSetupFixture
     CEGUI::Window* d_insideInsideRoot;
 };
 
+//! counts how often the geometry of the windows it is subscribed to is rebuilt.
+struct RenderingCounter
+{
+    RenderingCounter() : d_count(0) {}
+
+    bool onRenderingStarted(const CEGUI::EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count;
+};
+
 BOOST_FIXTURE_TEST_SUITE(Window, LayoutSetupFixture)
 
 BOOST_AUTO_TEST_CASE(Defaults)
@@ -140,6 +156,79 @@ BOOST_AUTO_TEST_CASE(HitTesting)
     d_root->setDisabled(false);
 }
 
+BOOST_AUTO_TEST_CASE(ChildAtPosition)
+{
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(300, 150)), d_insideInsideRoot);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(150, 75)), d_insideRoot);
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(600, 500)));
+
+    // a child not clipped by its parent can be hit outside of the parent
+    d_insideInsideRoot->setClippedByParent(false);
+    d_insideInsideRoot->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 450), CEGUI::UDim(0, 50)));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(600, 150)), d_insideInsideRoot);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(300, 150)), d_insideRoot);
+
+    d_insideRoot->hide();
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(600, 150)));
+    d_insideRoot->show();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(600, 150)), d_insideInsideRoot);
+
+    d_insideInsideRoot->setClippedByParent(true);
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(600, 150)));
+
+    // newly added children are found
+    CEGUI::Window* added = d_root->createChild("DefaultWindow");
+    added->setArea(CEGUI::UVector2(CEGUI::UDim(0, 600), CEGUI::UDim(0, 400)),
+                   CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 100)));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(650, 450)), added);
+    d_root->destroyChild(added);
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(650, 450)));
+}
+
+BOOST_AUTO_TEST_CASE(ChildAtPosition_ManyChildren)
+{
+    // enough children for getChildAtPosition to use a hit test grid
+    CEGUI::Window* cells[8][8];
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int column = 0; column < 8; ++column)
+        {
+            cells[row][column] = d_root->createChild("DefaultWindow");
+            cells[row][column]->setArea(
+                CEGUI::UVector2(CEGUI::UDim(0, 500.0f + column * 30), CEGUI::UDim(0, 350.0f + row * 30)),
+                CEGUI::USize(CEGUI::UDim(0, 30), CEGUI::UDim(0, 30)));
+        }
+    }
+
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(515, 365)), cells[0][0]);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(635, 425)), cells[2][4]);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(735, 585)), cells[7][7]);
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(760, 585)));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(300, 150)), d_insideInsideRoot);
+
+    // the draw order decides between overlapping children
+    CEGUI::Window* cover = d_root->createChild("DefaultWindow");
+    cover->setArea(CEGUI::UVector2(CEGUI::UDim(0, 520), CEGUI::UDim(0, 370)),
+                   CEGUI::USize(CEGUI::UDim(0, 60), CEGUI::UDim(0, 60)));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(545, 395)), cover);
+    cover->moveToBack();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(545, 395)), cells[1][1]);
+    cover->moveToFront();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(545, 395)), cover);
+
+    // moved and hidden children are picked up
+    cover->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 700), CEGUI::UDim(0, 500)));
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(545, 395)), cells[1][1]);
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(glm::vec2(745, 545)), cover);
+    cells[1][1]->hide();
+    BOOST_CHECK(!d_root->getTargetChildAtPosition(glm::vec2(545, 395)));
+
+    d_root->destroyChild(cover);
+    for (int row = 0; row < 8; ++row)
+        for (int column = 0; column < 8; ++column)
+            d_root->destroyChild(cells[row][column]);
+}
+
 BOOST_AUTO_TEST_CASE(Hierarchy)
 {
     CEGUI::Window* child = d_insideInsideRoot->createChild("DefaultWindow");
@@ -177,4 +266,40 @@ BOOST_AUTO_TEST_CASE(RecursiveSearch)
     d_insideInsideRoot->setID(previousID[2]);
 }
 
+BOOST_AUTO_TEST_CASE(GeometrySurvivesTranslation)
+{
+    RenderingCounter counter;
+    d_insideRoot->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+        CEGUI::Event::Subscriber(&RenderingCounter::onRenderingStarted, &counter));
+    d_insideInsideRoot->subscribeEvent(CEGUI::Window::EventRenderingStarted,
+        CEGUI::Event::Subscriber(&RenderingCounter::onRenderingStarted, &counter));
+
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+    context.draw();
+    const int initial_count = counter.d_count;
+    BOOST_CHECK_EQUAL(initial_count, 2);
+
+    d_insideRoot->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 120), CEGUI::UDim(0, 70)));
+    context.draw();
+    BOOST_CHECK_EQUAL(counter.d_count, initial_count);
+
+    d_insideRoot->setAlpha(0.5f);
+    context.draw();
+    BOOST_CHECK_EQUAL(counter.d_count, initial_count);
+
+    d_insideInsideRoot->setInheritsAlpha(false);
+    context.draw();
+    BOOST_CHECK_EQUAL(counter.d_count, initial_count);
+    BOOST_CHECK_EQUAL(d_insideInsideRoot->getEffectiveAlpha(), 1.0f);
+
+    d_insideInsideRoot->setClippedByParent(false);
+    context.draw();
+    BOOST_CHECK_EQUAL(counter.d_count, initial_count);
+
+    // a size change affects the content, so that must still be redrawn.
+    d_insideRoot->setSize(CEGUI::USize(CEGUI::UDim(0.25f, 0), CEGUI::UDim(0.25f, 0)));
+    context.draw();
+    BOOST_CHECK(counter.d_count > initial_count);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
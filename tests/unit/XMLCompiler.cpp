@@ -0,0 +1,142 @@
+/***********************************************************************
+ *    created:    Fri Oct 16 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/XMLCompiler.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
+
+#include <cstring>
+#include <sstream>
+
+using namespace CEGUI;
+
+/*
+ * Handler that logs every notification, joining consecutive text pieces
+ * since parsers are free to split text nodes.
+ */
+class RecordingXMLHandler : public XMLHandler
+{
+public:
+    const String& getDefaultResourceGroup() const
+    {
+        static const String group;
+        return group;
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes)
+    {
+        String entry = "start " + element;
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+            entry += " " + attributes.getName(i) + "=" + attributes.getValue(i);
+
+        d_log.push_back(entry);
+    }
+
+    void elementEnd(const String& element)
+    {
+        d_log.push_back("end " + element);
+    }
+
+    void text(const String& text)
+    {
+        if (!d_log.empty() && d_log.back().substr(0, 5) == "text ")
+            d_log.back() += text;
+        else
+            d_log.push_back("text " + text);
+    }
+
+    std::vector<String> d_log;
+};
+
+static void setContainerData(RawDataContainer& container, const std::string& data)
+{
+    uint8* const buffer = new uint8[data.size()];
+    std::memcpy(buffer, data.data(), data.size());
+    container.setData(buffer);
+    container.setSize(data.size());
+}
+
+static const char* const SampleXML =
+    "<?xml version=\"1.0\" ?>"
+    "<Root version=\"3\">"
+    "<Item Name=\"First\" Value=\"1\" />"
+    "<Item Name=\"Second\" Value=\"1\">some text</Item>"
+    "<Group><Item Name=\"First\" Value=\"2\" />"
+    "<Item Name=\"First\" Value=\"1\" /></Group>"
+    "</Root>";
+
+BOOST_AUTO_TEST_SUITE(XMLCompilerTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ParseCompiled_ReplaysSameNotificationsAsXML)
+{
+    RecordingXMLHandler parsed;
+    System::getSingleton().getXMLParser()->parseXMLString(parsed, SampleXML, "", false);
+
+    std::ostringstream compiled(std::ios::out | std::ios::binary);
+    XMLCompiler::compileString(SampleXML, compiled);
+
+    RawDataContainer container;
+    setContainerData(container, compiled.str());
+    BOOST_REQUIRE(XMLCompiler::isCompiled(container));
+
+    RecordingXMLHandler replayed;
+    replayed.handleContainer(container);
+
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(parsed.d_log.begin(), parsed.d_log.end(),
+                                    replayed.d_log.begin(), replayed.d_log.end());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IsCompiled_XMLSource_ReturnsFalse)
+{
+    RawDataContainer container;
+    setContainerData(container, SampleXML);
+
+    BOOST_REQUIRE(!XMLCompiler::isCompiled(container));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ParseCompiled_TruncatedData_Throws)
+{
+    std::ostringstream compiled(std::ios::out | std::ios::binary);
+    XMLCompiler::compileString(SampleXML, compiled);
+    const std::string data(compiled.str());
+
+    RawDataContainer container;
+    setContainerData(container, data.substr(0, data.size() - 3));
+
+    RecordingXMLHandler handler;
+    BOOST_REQUIRE_THROW(XMLCompiler::parseCompiled(handler, container),
+                        GenericException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()